@@ -0,0 +1,168 @@
+/**************************************************************************************************
+    Filename:       bench_dispatch.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The pick of the next task to run, built with OSAL_MAX_TASKS of 16
+    and a full table of tasks of distinct priorities. With one task
+    ready, of each priority rank from the highest to the lowest, and
+    with none ready, as at each idle pass and before each sleep,
+    osalNextActiveTask() is single-stepped.
+
+    For comparison, 'walk' is the pick as osalNextActiveTask() did it
+    before the ready bitmap: a walk of the task list in priority order
+    until a task with events, here over the same tasks.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BENCH_TASKS   OSAL_MAX_TASKS
+#define BENCH_OPS     1000L   // Picks stepped per rank.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  byte idx;
+
+  // Added from the lowest priority up, so that each one goes to the head of the list.
+  for ( idx = 0; idx < BENCH_TASKS; idx++ )
+  {
+    osalTaskAdd( appInit, appEvents, (byte)(10 + 10 * idx) );
+  }
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          walkNext
+ *
+ * @brief       Find the next task to run by walking the list, as osalNextActiveTask() did.
+ *
+ * @param       none
+ *
+ * @return      Task, or NULL.
+ **************************************************************************************************
+ */
+static osalTaskRec_t *walkNext( void )
+{
+  osalTaskRec_t *srchTask = osalTaskCtx.tasksHead;
+
+  while ( srchTask )
+  {
+    if ( srchTask->events )
+      break;
+
+    srchTask = srchTask->next;
+  }
+
+  return ( srchTask );
+}
+
+
+/**************************************************************************************************
+ * @fn          benchRank
+ *
+ * @brief       Step the picks with the task of priority rank 'rank' ready, or none.
+ *
+ * @param       rank - 0 for the highest priority task, BENCH_TASKS for no task ready.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchRank( byte rank )
+{
+  unsigned long next = 0, walk = 0;
+  osalTaskRec_t *task = NULL;
+  long n;
+
+  if ( rank < BENCH_TASKS )
+  {
+    task = osalTaskCtx.ranked[rank];
+    osal_set_event( task->taskID, 0x0001 );
+  }
+
+  for ( n = 0; n < BENCH_OPS; n++ )
+  {
+    host_steps_begin();
+    osalNextActiveTask();
+    next += host_steps_end();
+
+    host_steps_begin();
+    walkNext();
+    walk += host_steps_end();
+  }
+
+  if ( task != NULL )
+  {
+    task->events = 0;
+    OSAL_TASK_IDLE( task );
+    printf( "%6u %10lu %10lu\n", rank, next / BENCH_OPS, walk / BENCH_OPS );
+  }
+  else
+  {
+    printf( "  none %10lu %10lu\n", next / BENCH_OPS, walk / BENCH_OPS );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the pick benchmark for each rank.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  byte rank;
+
+  osal_init_system();
+
+  printf( "  rank       next       walk\n" );
+  printf( "           (instr)    (instr)\n" );
+
+  for ( rank = 0; rank <= BENCH_TASKS; rank++ )
+  {
+    benchRank( rank );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,205 @@
+/**************************************************************************************************
+    Filename:       bench_events.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Event posting against the task table, built with OSAL_MAX_TASKS of
+    BENCH_MAX. osal_set_event() and osalFindTask() of a random task
+    among the first 'n' are single-stepped, for 3 tasks, as msa_Osal.c
+    adds, up to BENCH_MAX.
+
+    For comparison, 'walk' is the lookup as osalFindTask() did it before
+    the table: a walk of the task list in priority order, comparing the
+    ID of every task until the one asked for, here over a list of the
+    same 'n' tasks in the order the OSAL keeps them.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BENCH_MAX     OSAL_MAX_TASKS
+#define BENCH_OPS     2000L   // Posts stepped per count.
+
+static const byte benchCnt[] = { 3, 8, 16 };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Typedefs
+ * ------------------------------------------------------------------------------------------------
+ */
+// A task of the list before the table.
+typedef struct walkTask
+{
+  struct walkTask *next;
+  byte taskID;
+} walkTask_t;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static walkTask_t walk[BENCH_MAX];
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  static const byte priority[3] =
+    { OSAL_TASK_PRIORITY_LOW, OSAL_TASK_PRIORITY_HIGH, OSAL_TASK_PRIORITY_MED };
+  byte idx;
+
+  // The HAL, MAC and MSA order of msa_Osal.c, over and over.
+  for ( idx = 0; idx < BENCH_MAX; idx++ )
+  {
+    osalTaskAdd( appInit, appEvents, priority[idx % 3] );
+  }
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          walkFind
+ *
+ * @brief       Find a task by walking the list, as osalFindTask() did.
+ *
+ * @param       head - first task.
+ * @param       taskID - task.
+ *
+ * @return      Task, or NULL.
+ **************************************************************************************************
+ */
+static walkTask_t *walkFind( walkTask_t *head, byte taskID )
+{
+  walkTask_t *srchTask = head;
+
+  while ( srchTask )
+  {
+    if ( srchTask->taskID == taskID )
+      break;
+
+    srchTask = srchTask->next;
+  }
+
+  return ( srchTask );
+}
+
+
+/**************************************************************************************************
+ * @fn          benchCount
+ *
+ * @brief       Step the posts to 'cnt' tasks.
+ *
+ * @param       cnt - tasks.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchCount( byte cnt )
+{
+  unsigned long post = 0, find = 0, walkFound = 0;
+  walkTask_t * volatile head = NULL;
+  walkTask_t **ptr;
+  osalTaskRec_t *srchTask;
+  long n;
+
+  host_srand( cnt );
+
+  // The first 'cnt' tasks, in the priority order of the OSAL list.
+  ptr = (walkTask_t **)&head;
+  for ( srchTask = osalTaskCtx.tasksHead; srchTask; srchTask = srchTask->next )
+  {
+    if ( srchTask->taskID < cnt )
+    {
+      walk[srchTask->taskID].taskID = srchTask->taskID;
+      *ptr = &walk[srchTask->taskID];
+      ptr = &walk[srchTask->taskID].next;
+    }
+  }
+  *ptr = NULL;
+
+  for ( n = 0; n < BENCH_OPS; n++ )
+  {
+    byte taskID = (byte)(host_rand() % cnt);
+
+    host_steps_begin();
+    osal_set_event( taskID, 0x0001 );
+    post += host_steps_end();
+
+    host_steps_begin();
+    osalFindTask( taskID );
+    find += host_steps_end();
+
+    host_steps_begin();
+    walkFind( head, taskID );
+    walkFound += host_steps_end();
+
+    srchTask = osalFindTask( taskID );
+    srchTask->events = 0;
+    OSAL_TASK_IDLE( srchTask );
+  }
+
+  printf( "%6u %10lu %10lu %10lu\n", cnt,
+          post / BENCH_OPS, find / BENCH_OPS, walkFound / BENCH_OPS );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the posting benchmark for each count.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  byte idx;
+
+  osal_init_system();
+
+  printf( " tasks  set_event       find  walk find\n" );
+  printf( "           (instr)    (instr)    (instr)\n" );
+
+  for ( idx = 0; idx < sizeof( benchCnt ) / sizeof( benchCnt[0] ); idx++ )
+  {
+    benchCount( benchCnt[idx] );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
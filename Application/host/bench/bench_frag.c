@@ -0,0 +1,214 @@
+/**************************************************************************************************
+    Filename:       bench_frag.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Heap fragmentation over a long UART / MAC traffic trace, built once
+    per allocator and once with first-fit coalescing deferred to the
+    allocation walk (OSALMEM_FREE_COALESCE FALSE). The trace mixes MAC
+    data indications and requests that live a few ticks, UART receive
+    buffers that live much longer, and OSAL timers, with the live bytes
+    kept under BENCH_LOAD percent of the heap.
+
+    Every BENCH_SAMPLE steps osal_heap_largest_free() is sampled:
+    the largest free block as the heap holds it, so blocks a deferred
+    merge has not joined yet do not count. Reported are its lowest and
+    average value, the failed allocations and the average cycles of an
+    allocation.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BENCH_OPS     1000000L  // Operations per trace.
+#define BENCH_LOAD    60        // Most live bytes, percent of the heap.
+#define BENCH_SLOTS   64        // Blocks live at once.
+#define BENCH_HDR     4         // Overhead assumed per block by the generator.
+#define BENCH_SAMPLE  100       // Trace steps between samples of the largest free block.
+
+// OSAL_Memory.c defaults OSALMEM_FREE_COALESCE to TRUE.
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_FIRSTFIT ) && defined ( OSALMEM_FREE_COALESCE ) && \
+    !( OSALMEM_FREE_COALESCE )
+  #define BENCH_NAME  "ff-defer"
+#else
+  static const char *allocName[] = { "first-fit", "segfit", "tlsf" };
+  #define BENCH_NAME  allocName[OSALMEM_ALLOCATOR]
+#endif
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static void *slotPtr[BENCH_SLOTS];
+static uint16 slotSize[BENCH_SLOTS];
+static long slotEnd[BENCH_SLOTS];
+
+
+/**************************************************************************************************
+ * @fn          benchSize
+ *
+ * @brief       Pick the size and lifetime, in steps, of the next block of the traffic mix.
+ *
+ * @param       life - returns the lifetime.
+ *
+ * @return      Bytes to allocate.
+ **************************************************************************************************
+ */
+static uint16 benchSize( long *life )
+{
+  unsigned long kind = host_rand() % 100;
+
+  if ( kind < 40 )         // MAC data indication: header plus up to 102 bytes payload.
+  {
+    *life = 1 + host_rand() % 4;
+    return (uint16)(24 + host_rand() % 103);
+  }
+  else if ( kind < 60 )    // MAC data request on its way to the radio.
+  {
+    *life = 1 + host_rand() % 3;
+    return (uint16)(20 + host_rand() % 100);
+  }
+  else if ( kind < 75 )    // UART receive buffer, held until the frame is complete.
+  {
+    *life = 20 + host_rand() % 100;
+    return (uint16)(32 + host_rand() % 224);
+  }
+  else if ( kind < 90 )    // OSAL timer.
+  {
+    *life = 5 + host_rand() % 200;
+    return 10;
+  }
+  else                     // LCD string, OSAL event message.
+  {
+    *life = 1 + host_rand() % 2;
+    return (uint16)(4 + host_rand() % 28);
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run three traces and report the largest free block.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  unsigned long seed;
+
+  printf( "%-9s seed  largest free min/avg  failed allocs     alloc avg cycles\n", BENCH_NAME );
+
+  for ( seed = 1; seed <= 3; seed++ )
+  {
+    unsigned long long cycles = 0;
+    unsigned long long sum = 0;
+    uint16 low = MAXMEMHEAP;
+    uint16 liveBytes = 0;
+    long allocs = 0;
+    long fails = 0;
+    long samples = 0;
+    long step = 0;
+    long n = 0;
+    byte slot;
+
+    osal_mem_init();
+    host_srand( seed );
+    memset( slotSize, 0, sizeof( slotSize ) );
+
+    while ( n < BENCH_OPS )
+    {
+      long life;
+      uint16 size = benchSize( &life );
+
+      step++;
+
+      for ( slot = 0; slot < BENCH_SLOTS; slot++ )
+      {
+        if ( (slotSize[slot] != 0) && (slotEnd[slot] <= step) )
+        {
+          if ( slotPtr[slot] != NULL )
+          {
+            osal_mem_free( slotPtr[slot] );
+            slotPtr[slot] = NULL;
+          }
+          liveBytes -= (slotSize[slot] + BENCH_HDR);
+          slotSize[slot] = 0;
+          n++;
+        }
+      }
+
+      for ( slot = 0; (slot < BENCH_SLOTS) && (slotSize[slot] != 0); slot++ )
+      {
+      }
+
+      if ( (slot < BENCH_SLOTS) &&
+           ((liveBytes + size + BENCH_HDR) <= ((uint32)MAXMEMHEAP * BENCH_LOAD / 100)) )
+      {
+        unsigned long long t0 = host_cycles();
+
+        slotPtr[slot] = osal_mem_alloc( size );
+        cycles += host_cycles() - t0;
+        allocs++;
+
+        if ( slotPtr[slot] == NULL )
+        {
+          fails++;
+        }
+        slotSize[slot] = size;
+        slotEnd[slot] = step + life;
+        liveBytes += (size + BENCH_HDR);
+        n++;
+      }
+
+      if ( (step % BENCH_SAMPLE) == 0 )
+      {
+        uint16 largest = osal_heap_largest_free();
+
+        if ( low > largest )
+        {
+          low = largest;
+        }
+        sum += largest;
+        samples++;
+      }
+    }
+
+    for ( slot = 0; slot < BENCH_SLOTS; slot++ )
+    {
+      if ( slotPtr[slot] != NULL )
+      {
+        osal_mem_free( slotPtr[slot] );
+        slotPtr[slot] = NULL;
+      }
+    }
+
+    printf( "%-9s %4lu  %9u/%-10llu  %6ld of %-7ld  %9llu\n", BENCH_NAME, seed,
+            low, sum / (samples ? samples : 1), fails, allocs,
+            cycles / (allocs ? allocs : 1) );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
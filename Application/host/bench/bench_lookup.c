@@ -0,0 +1,231 @@
+/**************************************************************************************************
+    Filename:       bench_lookup.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Timer lookup at the timer counts of a real build, built once per
+    timer backend. 1 to 32 timers run, spread over three tasks as the
+    HAL, MAC and MSA tasks hold them, and the lookups are single-stepped:
+    osalFindTimer() of a running timer and of an event with no timer,
+    and osal_stop_timerEx() with the restart after it.
+
+    For comparison, 'walk' is the lookup as osalFindTimer() did it before
+    the index: a walk of the whole timer list, comparing task and event
+    of every record until the one asked for, here over a list of the
+    same timers.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BENCH_TASKS   3
+#define BENCH_MAX     32
+#define BENCH_OPS     2000L   // Lookups stepped per count.
+
+#if ( OSAL_TIMER_WHEEL )
+  #define BENCH_NAME  "wheel"
+#else
+  #define BENCH_NAME  "list"
+#endif
+
+static const byte benchCnt[] = { 1, 2, 4, 8, 16, 32 };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       External Functions
+ * ------------------------------------------------------------------------------------------------
+ */
+extern osalTimerRec_t *osalFindTimer( byte task_id, uint16 event_flag );
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Typedefs
+ * ------------------------------------------------------------------------------------------------
+ */
+// A record of the timer list before the index.
+typedef struct walkRec
+{
+  struct walkRec *next;
+  uint16 event_flag;
+  byte task_id;
+} walkRec_t;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static osalTimerRec_t rec[BENCH_MAX];
+static walkRec_t walk[BENCH_MAX];
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  byte idx;
+
+  for ( idx = 0; idx < BENCH_TASKS; idx++ )
+  {
+    osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+  }
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          walkFind
+ *
+ * @brief       Find a timer by walking the list, as osalFindTimer() did.
+ *
+ * @param       head - first record.
+ * @param       task_id - task.
+ * @param       event_flag - event.
+ *
+ * @return      Record, or NULL.
+ **************************************************************************************************
+ */
+static walkRec_t *walkFind( walkRec_t *head, byte task_id, uint16 event_flag )
+{
+  walkRec_t *srchTimer = head;
+
+  while ( srchTimer )
+  {
+    if ( srchTimer->event_flag == event_flag && srchTimer->task_id == task_id )
+      break;
+
+    srchTimer = srchTimer->next;
+  }
+
+  return ( srchTimer );
+}
+
+
+/**************************************************************************************************
+ * @fn          benchCount
+ *
+ * @brief       Step the lookups with 'cnt' timers running.
+ *
+ * @param       cnt - timers.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchCount( byte cnt )
+{
+  unsigned long hit = 0, miss = 0, restart = 0, walkHit = 0, walkMiss = 0;
+  walkRec_t * volatile head = walk;
+  long n;
+  byte idx;
+
+  host_srand( cnt );
+
+  // Timer i: task i % 3, event bit i / 3.
+  for ( idx = 0; idx < cnt; idx++ )
+  {
+    osal_start_timerRec( &rec[idx], idx % BENCH_TASKS, (uint16)1 << (idx / BENCH_TASKS), 1000 );
+
+    walk[idx].task_id = idx % BENCH_TASKS;
+    walk[idx].event_flag = (uint16)1 << (idx / BENCH_TASKS);
+    walk[idx].next = ( idx + 1 < cnt ) ? &walk[idx + 1] : NULL;
+  }
+
+  for ( n = 0; n < BENCH_OPS; n++ )
+  {
+    byte pick = (byte)(host_rand() % cnt);
+    byte task = pick % BENCH_TASKS;
+    uint16 event = (uint16)1 << (pick / BENCH_TASKS);
+    uint16 none = 0x8000;
+
+    host_steps_begin();
+    osalFindTimer( task, event );
+    hit += host_steps_end();
+
+    host_steps_begin();
+    osalFindTimer( task, none );
+    miss += host_steps_end();
+
+    host_steps_begin();
+    osal_stop_timerEx( task, event );
+    osal_start_timerRec( &rec[pick], task, event, 1000 );
+    restart += host_steps_end();
+
+    host_steps_begin();
+    walkFind( head, task, event );
+    walkHit += host_steps_end();
+
+    host_steps_begin();
+    walkFind( head, task, none );
+    walkMiss += host_steps_end();
+  }
+
+  printf( "%-6s %6u  %8lu %8lu %10lu  %8lu %8lu\n", BENCH_NAME, cnt,
+          hit / BENCH_OPS, miss / BENCH_OPS, restart / BENCH_OPS,
+          walkHit / BENCH_OPS, walkMiss / BENCH_OPS );
+
+  for ( idx = 0; idx < cnt; idx++ )
+  {
+    osal_stop_timerRec( &rec[idx] );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the lookup benchmark for each count.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  byte idx;
+
+  osal_init_system();
+
+  printf( "%-6s timers       hit     miss stop+start  walk hit walk miss\n", BENCH_NAME );
+  printf( "                (instr)  (instr)    (instr)   (instr)  (instr)\n" );
+
+  for ( idx = 0; idx < sizeof( benchCnt ) / sizeof( benchCnt[0] ); idx++ )
+  {
+    benchCount( benchCnt[idx] );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
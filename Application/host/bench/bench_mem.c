@@ -0,0 +1,286 @@
+/**************************************************************************************************
+    Filename:       bench_mem.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Cost of osal_mem_alloc() and osal_mem_free(), built once per
+    OSALMEM_ALLOCATOR so that the allocators can be compared on the same
+    traces. A trace is generated from a seed to look like the MSA
+    application: MAC data indications freed within a few ticks, timers,
+    LCD strings and longer-lived UART buffers, with the live bytes kept
+    under BENCH_LOAD percent of the heap.
+
+    Every trace is replayed BENCH_REPS times on a fresh heap; since the
+    replay is deterministic, the cheapest of the repetitions is kept for
+    every operation, which takes out cache misses and host interrupts.
+    Average and worst case of those are reported in host cycles.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BENCH_OPS    100000L  // Operations per trace.
+#define BENCH_REPS   5        // Replays per trace.
+#define BENCH_LOAD   50       // Most live bytes, percent of the heap.
+#define BENCH_SLOTS  64       // Blocks live at once.
+#define BENCH_HDR    4        // Overhead assumed per block by the generator.
+
+#define OP_ALLOC     0
+#define OP_FREE      1
+
+static const char *allocName[] = { "first-fit", "segfit", "tlsf" };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Typedefs
+ * ------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+  byte op;      // OP_ALLOC or OP_FREE.
+  byte slot;    // Block the operation is on.
+  uint16 size;  // Bytes requested by an OP_ALLOC.
+} benchOp_t;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static benchOp_t trace[BENCH_OPS];
+static unsigned long long cost[BENCH_OPS];
+static void *slotPtr[BENCH_SLOTS];
+
+
+/**************************************************************************************************
+ * @fn          benchGen
+ *
+ * @brief       Generate a trace. Each step frees the blocks whose lifetime is up and starts
+ *              at most one new block.
+ *
+ * @param       seed - random seed of the trace.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchGen( unsigned long seed )
+{
+  static uint16 slotSize[BENCH_SLOTS];
+  static long slotEnd[BENCH_SLOTS];
+  uint16 liveBytes = 0;
+  long step = 0;
+  long n = 0;
+  byte slot;
+
+  host_srand( seed );
+  memset( slotSize, 0, sizeof( slotSize ) );
+
+  while ( n < BENCH_OPS )
+  {
+    unsigned long kind = host_rand() % 100;
+    uint16 size;
+    long life;
+
+    step++;
+
+    for ( slot = 0; (slot < BENCH_SLOTS) && (n < BENCH_OPS); slot++ )
+    {
+      if ( (slotSize[slot] != 0) && (slotEnd[slot] <= step) )
+      {
+        trace[n].op = OP_FREE;
+        trace[n++].slot = slot;
+        liveBytes -= (slotSize[slot] + BENCH_HDR);
+        slotSize[slot] = 0;
+      }
+    }
+
+    if ( kind < 45 )         // MAC data indication: header plus up to 102 bytes payload.
+    {
+      size = (uint16)(24 + host_rand() % 103);
+      life = 1 + host_rand() % 4;
+    }
+    else if ( kind < 70 )    // OSAL timer.
+    {
+      size = 10;
+      life = 5 + host_rand() % 200;
+    }
+    else if ( kind < 90 )    // LCD string, OSAL event message.
+    {
+      size = (uint16)(4 + host_rand() % 28);
+      life = 1 + host_rand() % 2;
+    }
+    else                     // UART receive buffer.
+    {
+      size = (uint16)(32 + host_rand() % 224);
+      life = 20 + host_rand() % 100;
+    }
+
+    for ( slot = 0; (slot < BENCH_SLOTS) && (slotSize[slot] != 0); slot++ )
+    {
+    }
+
+    if ( (slot < BENCH_SLOTS) && (n < BENCH_OPS) &&
+         ((liveBytes + size + BENCH_HDR) <= ((uint32)MAXMEMHEAP * BENCH_LOAD / 100)) )
+    {
+      trace[n].op = OP_ALLOC;
+      trace[n].slot = slot;
+      trace[n++].size = size;
+      slotSize[slot] = size;
+      slotEnd[slot] = step + life;
+      liveBytes += (size + BENCH_HDR);
+    }
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          benchRun
+ *
+ * @brief       Replay the trace on a fresh heap, keeping the cheapest cost of every operation.
+ *
+ * @param       first - TRUE on the first replay of the trace.
+ *
+ * @return      Number of failed allocations.
+ **************************************************************************************************
+ */
+static long benchRun( byte first )
+{
+  unsigned long long t0;
+  unsigned long long t;
+  long fails = 0;
+  long n;
+
+  osal_mem_init();
+  memset( slotPtr, 0, sizeof( slotPtr ) );
+
+  for ( n = 0; n < BENCH_OPS; n++ )
+  {
+    benchOp_t *op = &trace[n];
+
+    if ( op->op == OP_ALLOC )
+    {
+      t0 = host_cycles();
+      slotPtr[op->slot] = osal_mem_alloc( op->size );
+      t = host_cycles() - t0;
+
+      if ( slotPtr[op->slot] == NULL )
+      {
+        fails++;
+      }
+    }
+    else if ( slotPtr[op->slot] != NULL )
+    {
+      t0 = host_cycles();
+      osal_mem_free( slotPtr[op->slot] );
+      t = host_cycles() - t0;
+
+      slotPtr[op->slot] = NULL;
+    }
+    else
+    {
+      t = 0;  // Free of a failed allocation, not timed.
+    }
+
+    if ( first || (cost[n] > t) )
+    {
+      cost[n] = t;
+    }
+  }
+
+  return fails;
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Replay three traces and report per-operation cycles.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  unsigned long seed;
+
+  printf( "%-9s seed  alloc avg/max cycles  free avg/max cycles  failed allocs\n",
+          allocName[OSALMEM_ALLOCATOR] );
+
+  for ( seed = 1; seed <= 3; seed++ )
+  {
+    unsigned long long sum[2] = { 0, 0 };
+    unsigned long long max[2] = { 0, 0 };
+    long cnt[2] = { 0, 0 };
+    long fails = 0;
+    byte rep;
+    long n;
+
+    benchGen( seed );
+
+    for ( rep = 0; rep < BENCH_REPS; rep++ )
+    {
+      fails = benchRun( rep == 0 );
+    }
+
+    // Replay once more to know which frees were of real blocks.
+    osal_mem_init();
+    memset( slotPtr, 0, sizeof( slotPtr ) );
+    for ( n = 0; n < BENCH_OPS; n++ )
+    {
+      benchOp_t *op = &trace[n];
+
+      if ( op->op == OP_ALLOC )
+      {
+        slotPtr[op->slot] = osal_mem_alloc( op->size );
+        if ( slotPtr[op->slot] == NULL )
+        {
+          continue;
+        }
+      }
+      else if ( slotPtr[op->slot] != NULL )
+      {
+        osal_mem_free( slotPtr[op->slot] );
+        slotPtr[op->slot] = NULL;
+      }
+      else
+      {
+        continue;
+      }
+
+      sum[op->op] += cost[n];
+      cnt[op->op]++;
+      if ( max[op->op] < cost[n] )
+      {
+        max[op->op] = cost[n];
+      }
+    }
+
+    printf( "%-9s %4lu  %9llu/%-9llu  %9llu/%-9llu  %ld of %ld\n",
+            allocName[OSALMEM_ALLOCATOR], seed,
+            sum[OP_ALLOC] / (cnt[OP_ALLOC] ? cnt[OP_ALLOC] : 1), max[OP_ALLOC],
+            sum[OP_FREE] / (cnt[OP_FREE] ? cnt[OP_FREE] : 1), max[OP_FREE],
+            fails, cnt[OP_ALLOC] + fails );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,244 @@
+/**************************************************************************************************
+    Filename:       bench_msg_queue.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Message sends and receives with deep queues, on the 3 tasks of
+    msa_Osal.c. With 'depth' messages queued for the MSA task, as when
+    it falls behind a burst of MAC indications, osal_msg_send() to the
+    MSA task and osal_msg_receive() by the MAC task of its one message
+    are single-stepped, and the queue counters of the MSA task shown.
+
+    For comparison, 'walk' is the send and receive as they were done
+    before the per-task queues: one list for all tasks, a send walked to
+    its end, and a receive walked it for the first message of the task,
+    here with the MAC message behind the same 'depth' MSA messages.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Macros
+ * ------------------------------------------------------------------------------------------------
+ */
+// Destination of a message, from its header, as OSAL.c keeps it.
+#define WALK_MSG_ID(msg_ptr)  ((osal_msg_hdr_t *) (msg_ptr) - 1)->dest_id
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BENCH_MAC     1
+#define BENCH_MSA     2
+#define BENCH_OPS     1000L   // Sends and receives stepped per depth.
+
+static const byte benchDepth[] = { 1, 4, 16, 64 };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_LOW );
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_HIGH );
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          walkReceive
+ *
+ * @brief       Take the first message of a task out of one list of all, as osal_msg_receive()
+ *              did.
+ *
+ * @param       q_ptr - list of all messages.
+ * @param       task_id - receiving task.
+ *
+ * @return      Message, or NULL.
+ **************************************************************************************************
+ */
+static byte *walkReceive( osal_msg_q_t *q_ptr, byte task_id )
+{
+  void *listHdr;
+  void *prevHdr = NULL;
+  halIntState_t intState;
+
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  listHdr = *q_ptr;
+  while ( listHdr != NULL )
+  {
+    if ( WALK_MSG_ID( listHdr ) == task_id )
+      break;
+
+    prevHdr = listHdr;
+    listHdr = OSAL_MSG_NEXT( listHdr );
+  }
+
+  if ( listHdr != NULL )
+  {
+    osal_msg_extract( q_ptr, listHdr, prevHdr );
+  }
+
+  HAL_EXIT_CRITICAL_SECTION(intState);
+
+  return ( (byte *)listHdr );
+}
+
+
+/**************************************************************************************************
+ * @fn          walkMsg
+ *
+ * @brief       Allocate a message for the list of all, addressed to a task.
+ *
+ * @param       task_id - destination.
+ *
+ * @return      Message.
+ **************************************************************************************************
+ */
+static byte *walkMsg( byte task_id )
+{
+  byte *msg = osal_msg_allocate( sizeof( uint16 ) );
+
+  WALK_MSG_ID( msg ) = task_id;
+
+  return ( msg );
+}
+
+
+/**************************************************************************************************
+ * @fn          benchDepthOf
+ *
+ * @brief       Step the sends and receives with 'depth' messages queued for the MSA task.
+ *
+ * @param       depth - MSA messages.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchDepthOf( byte depth )
+{
+  unsigned long send = 0, recv = 0, walkSend = 0, walkRecv = 0;
+  osal_msg_q_t walkQ = NULL;
+  const osal_msg_q_stats_t *stats;
+  byte *msg;
+  byte *mac;
+  byte idx;
+  long n;
+
+  for ( idx = 0; idx < depth; idx++ )
+  {
+    osal_msg_send( BENCH_MSA, osal_msg_allocate( sizeof( uint16 ) ) );
+    osal_msg_enqueue( &walkQ, walkMsg( BENCH_MSA ) );
+  }
+  msg = osal_msg_allocate( sizeof( uint16 ) );
+  mac = osal_msg_allocate( sizeof( uint16 ) );
+
+  for ( n = 0; n < BENCH_OPS; n++ )
+  {
+    // One more MSA message, at the tail; the one at the head is taken for the next turn.
+    host_steps_begin();
+    osal_msg_send( BENCH_MSA, msg );
+    send += host_steps_end();
+    msg = osal_msg_receive( BENCH_MSA );
+
+    // The MAC message, behind the MSA messages in the list of all.
+    osal_msg_send( BENCH_MAC, mac );
+    host_steps_begin();
+    mac = osal_msg_receive( BENCH_MAC );
+    recv += host_steps_end();
+
+    WALK_MSG_ID( msg ) = BENCH_MSA;
+    host_steps_begin();
+    osal_msg_enqueue( &walkQ, msg );
+    walkSend += host_steps_end();
+    msg = osal_msg_dequeue( &walkQ );
+
+    WALK_MSG_ID( mac ) = BENCH_MAC;
+    osal_msg_enqueue( &walkQ, mac );
+    host_steps_begin();
+    mac = walkReceive( &walkQ, BENCH_MAC );
+    walkRecv += host_steps_end();
+    if ( mac == NULL )
+      break;
+
+    WALK_MSG_ID( msg ) = TASK_NO_TASK;
+    WALK_MSG_ID( mac ) = TASK_NO_TASK;
+  }
+
+  stats = osal_msg_q_stats( BENCH_MSA );
+  printf( "%6u %6u %6u %10lu %10lu %10lu %10lu\n", depth, stats->depth, stats->highWater,
+          send / BENCH_OPS, recv / BENCH_OPS, walkSend / BENCH_OPS, walkRecv / BENCH_OPS );
+
+  // Free them all for the next depth.
+  osal_msg_deallocate( msg );
+  osal_msg_deallocate( mac );
+  while ( (msg = osal_msg_receive( BENCH_MSA )) != NULL )
+  {
+    osal_msg_deallocate( msg );
+  }
+  while ( (msg = osal_msg_dequeue( &walkQ )) != NULL )
+  {
+    WALK_MSG_ID( msg ) = TASK_NO_TASK;
+    osal_msg_deallocate( msg );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the message queue benchmark for each depth.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  byte idx;
+
+  osal_init_system();
+
+  printf( " depth queued   high       send    receive  walk send  walk recv\n" );
+  printf( "                          (instr)    (instr)    (instr)    (instr)\n" );
+
+  for ( idx = 0; idx < sizeof( benchDepth ) / sizeof( benchDepth[0] ); idx++ )
+  {
+    benchDepthOf( benchDepth[idx] );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,231 @@
+/**************************************************************************************************
+    Filename:       bench_realloc.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Cost of building a UART frame a chunk at a time, built once per
+    OSALMEM_ALLOCATOR. Each frame of up to FRAME_LEN bytes arrives in
+    chunks of 1 to CHUNK_MAX bytes, with MAC traffic allocating and
+    freeing between two chunks, and is appended to in three ways:
+
+      realloc  - osal_mem_realloc() per chunk, as Msa_Uart_Append()
+      copy     - a new block per chunk, the old contents copied and the
+                 old block freed
+      whole    - the chunks kept in the UART buffer and one block taken
+                 when the frame is complete, as MSA did before
+
+    Reported per frame are the average host cycles spent in the heap and
+    in copying, the bytes copied, and the frames that did not get their
+    memory. 'whole' copies nothing on the heap side, but holds the UART
+    buffer for the whole frame.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BENCH_FRAMES  20000L  // Frames per way.
+#define BENCH_SLOTS   16      // MAC blocks live at once.
+#define FRAME_LEN     128     // MSA_PACKET_LENGTH.
+#define CHUNK_MAX     16      // Most bytes read off the UART per append.
+
+#define WAY_REALLOC   0
+#define WAY_COPY      1
+#define WAY_WHOLE     2
+
+static const char *allocName[] = { "first-fit", "segfit", "tlsf" };
+static const char *wayName[] = { "realloc", "copy", "whole" };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static void *slotPtr[BENCH_SLOTS];
+static byte uart[FRAME_LEN];
+
+
+/**************************************************************************************************
+ * @fn          benchTraffic
+ *
+ * @brief       Allocate or free one MAC block, as other tasks do between two UART reads.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchTraffic( void )
+{
+  byte slot = (byte)(host_rand() % BENCH_SLOTS);
+
+  if ( slotPtr[slot] == NULL )
+  {
+    slotPtr[slot] = osal_mem_alloc( (uint16)(8 + host_rand() % 40) );
+  }
+  else
+  {
+    osal_mem_free( slotPtr[slot] );
+    slotPtr[slot] = NULL;
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          benchWay
+ *
+ * @brief       Build BENCH_FRAMES frames one way and report the cost.
+ *
+ * @param       way - WAY_REALLOC, WAY_COPY or WAY_WHOLE.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchWay( byte way )
+{
+  unsigned long long cycles = 0;
+  unsigned long long copied = 0;
+  long fails = 0;
+  long frame;
+  byte slot;
+
+  osal_mem_init();
+  host_srand( 11 );
+
+  for ( frame = 0; frame < BENCH_FRAMES; frame++ )
+  {
+    uint16 total = (uint16)(16 + host_rand() % (FRAME_LEN - 15));
+    byte *buf = NULL;
+    uint16 len = 0;
+    byte failed = FALSE;
+
+    while ( len < total )
+    {
+      uint16 chunk = (uint16)(1 + host_rand() % CHUNK_MAX);
+      unsigned long long t0;
+
+      if ( chunk > (total - len) )
+      {
+        chunk = total - len;
+      }
+      benchTraffic();
+
+      t0 = host_cycles();
+      if ( way == WAY_REALLOC )
+      {
+        byte *grown = osal_mem_realloc( buf, len + chunk );
+
+        if ( grown == NULL )
+        {
+          failed = TRUE;
+          break;
+        }
+        if ( (buf != NULL) && (grown != buf) )
+        {
+          copied += len;
+        }
+        buf = grown;
+        osal_memcpy( buf + len, uart, chunk );
+      }
+      else if ( way == WAY_COPY )
+      {
+        byte *grown = osal_mem_alloc( len + chunk );
+
+        if ( grown == NULL )
+        {
+          failed = TRUE;
+          break;
+        }
+        if ( buf != NULL )
+        {
+          osal_memcpy( grown, buf, len );
+          osal_mem_free( buf );
+          copied += len;
+        }
+        buf = grown;
+        osal_memcpy( buf + len, uart, chunk );
+      }
+      cycles += host_cycles() - t0;
+      len += chunk;
+    }
+
+    if ( way == WAY_WHOLE )
+    {
+      unsigned long long t0 = host_cycles();
+
+      buf = osal_mem_alloc( total );
+      if ( buf != NULL )
+      {
+        osal_memcpy( buf, uart, total );
+      }
+      else
+      {
+        failed = TRUE;
+      }
+      cycles += host_cycles() - t0;
+    }
+
+    if ( failed )
+    {
+      fails++;
+    }
+    if ( buf != NULL )
+    {
+      osal_mem_free( buf );
+    }
+  }
+
+  for ( slot = 0; slot < BENCH_SLOTS; slot++ )
+  {
+    if ( slotPtr[slot] != NULL )
+    {
+      osal_mem_free( slotPtr[slot] );
+      slotPtr[slot] = NULL;
+    }
+  }
+
+  printf( "%-9s %-8s %12llu %12llu %8ld\n", allocName[OSALMEM_ALLOCATOR], wayName[way],
+          cycles / BENCH_FRAMES, copied / BENCH_FRAMES, fails );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the three ways of appending.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  byte way;
+
+  printf( "%-9s way       cycles/frame  bytes copied   failed\n", allocName[OSALMEM_ALLOCATOR] );
+
+  for ( way = WAY_REALLOC; way <= WAY_WHOLE; way++ )
+  {
+    benchWay( way );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
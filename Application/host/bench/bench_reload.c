@@ -0,0 +1,203 @@
+/**************************************************************************************************
+    Filename:       bench_reload.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    A periodic event kept two ways, built once per timer backend: a
+    one-shot timer started again by the task when it handles the event,
+    as Hal_ProcessEvent() and printenergy() did, and a reload timer that
+    OSAL starts again from its deadline. The task handles each event
+    0 to BENCH_LATENCY ms after it is set, as it would behind the other
+    tasks.
+
+    Per period, for the 100 ms HAL_KEY_EVENT poll and the 1 s
+    PRINT_NEXT_ENERGY print, reported are the shortest and longest time
+    between two events, how far the last event is from its schedule
+    after BENCH_PERIODS periods, the average host cycles of the ticks
+    that expire nothing, and the average instructions, single-stepped,
+    of the tick that expires the timer plus, for the one-shot, the
+    restart. The one-shot also takes and frees a heap block per period.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BENCH_PERIODS  2000L  // Events per run.
+#define BENCH_LATENCY  3      // Longest wait for the task, ms.
+#define BENCH_EVENT    0x0001
+
+#define WAY_ONESHOT    0
+#define WAY_RELOAD     1
+
+#if ( OSAL_TIMER_WHEEL )
+  #define BENCH_NAME   "wheel"
+#else
+  #define BENCH_NAME   "list"
+#endif
+
+static const char *wayName[] = { "one-shot", "reload" };
+static const uint16 benchPeriod[] = { 100, 1000 };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          benchWay
+ *
+ * @brief       Keep an event of 'period' ms for BENCH_PERIODS periods one way and report.
+ *
+ * @param       way - WAY_ONESHOT or WAY_RELOAD.
+ * @param       period - ms.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchWay( byte way, uint16 period )
+{
+  osalTaskRec_t *task = osalFindTask( 0 );
+  unsigned long long cycles = 0;
+  unsigned long long t0;
+  unsigned long steps = 0;
+  uint32 now = 0, last = 0;
+  uint32 gapMin = 0xFFFFFFFFUL, gapMax = 0;
+  uint16 wait = 0;
+  long events = 0;
+
+  host_srand( period );
+
+  t0 = host_cycles();
+  if ( way == WAY_ONESHOT )
+  {
+    osal_start_timerEx( 0, BENCH_EVENT, period );
+  }
+  else
+  {
+    osal_start_reload_timerEx( 0, BENCH_EVENT, period );
+  }
+  cycles += host_cycles() - t0;
+
+  while ( events < BENCH_PERIODS )
+  {
+    if ( osal_get_timeoutEx( 0, BENCH_EVENT ) == 1 )
+    {
+      // The tick that expires the timer.
+      host_steps_begin();
+      osal_update_timers();
+      steps += host_steps_end();
+    }
+    else
+    {
+      t0 = host_cycles();
+      osal_update_timers();
+      cycles += host_cycles() - t0;
+    }
+    now++;
+
+    if ( task->events & BENCH_EVENT )
+    {
+      if ( wait == 0 )
+      {
+        // Set on this tick: the task gets to it a little later.
+        wait = (uint16)(1 + host_rand() % (BENCH_LATENCY + 1));
+        events++;
+
+        if ( events > 1 )
+        {
+          uint32 gap = now - last;
+
+          gapMin = ( gap < gapMin ) ? gap : gapMin;
+          gapMax = ( gap > gapMax ) ? gap : gapMax;
+        }
+        last = now;
+      }
+
+      if ( --wait == 0 )
+      {
+        task->events &= ~BENCH_EVENT;
+        if ( way == WAY_ONESHOT )
+        {
+          host_steps_begin();
+          osal_start_timerEx( 0, BENCH_EVENT, period );
+          steps += host_steps_end();
+        }
+      }
+    }
+  }
+
+  osal_stop_timerEx( 0, BENCH_EVENT );
+  task->events = 0;
+
+  printf( "%-6s %-9s %6u %8lu %8lu %8ld %8llu %8lu\n", BENCH_NAME, wayName[way], period,
+          (unsigned long)gapMin, (unsigned long)gapMax,
+          (long)(last - (uint32)BENCH_PERIODS * period), cycles / BENCH_PERIODS,
+          steps / BENCH_PERIODS );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run both ways for each period.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  byte idx;
+
+  osal_init_system();
+
+  printf( "%-6s way       period  min gap  max gap  late by   cycles    instr\n", BENCH_NAME );
+  printf( "                   (ms)     (ms)     (ms)     (ms) (period) (expiry)\n" );
+
+  for ( idx = 0; idx < sizeof( benchPeriod ) / sizeof( benchPeriod[0] ); idx++ )
+  {
+    benchWay( WAY_ONESHOT, benchPeriod[idx] );
+    benchWay( WAY_RELOAD, benchPeriod[idx] );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,255 @@
+/**************************************************************************************************
+    Filename:       bench_timers.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Cost of the OSAL timers against the number of timers running, built
+    once per timer backend. Up to BENCH_MAX reload timers in caller storage,
+    periods of 1 to 60 s, are kept running on one task while the timers
+    are ticked through osal_update_timers(), restarted, stopped and
+    looked up. Reported are the average host cycles of a tick, then the
+    average and worst instructions of a tick, single-stepped so that the
+    worst case is not a host interrupt, and the average cycles of a
+    restart with a new timeout, of a stop and start again, and of
+    osal_get_timeoutEx(). Built with OSAL_TICKLESS, OSAL_TIMER is
+    advanced by hand, and an update that catches up TICK_HW_MAX ticks at
+    once, as after the longest compare, is timed too.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#if !defined ( BENCH_MAX )
+  #define BENCH_MAX   500     // Most timers running.
+#endif
+#define BENCH_TICKS   20000L  // Ticks timed per count.
+#define BENCH_STEPPED 4000L   // Ticks single-stepped per count.
+#define BENCH_OPS     5000L   // Starts, stops and lookups timed per count.
+
+#if ( OSAL_TIMER_WHEEL ) && ( OSAL_TICKLESS )
+  #define BENCH_NAME  "wheel-tl"
+#elif ( OSAL_TIMER_WHEEL )
+  #define BENCH_NAME  "wheel"
+#else
+  #define BENCH_NAME  "list"
+#endif
+
+static const uint16 benchCnt[] = { 10, 50, 100, 250, 500, 1000, 2500, 5000, 10000 };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static osalTimerRec_t rec[BENCH_MAX];
+
+
+/**************************************************************************************************
+ * @fn          benchTick
+ *
+ * @brief       Update the timers for 'ms' milliseconds; without OSAL_TICKLESS only 1 ms.
+ *
+ * @param       ms - milliseconds.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchTick( uint16 ms )
+{
+#if ( OSAL_TICKLESS )
+  hostTimerCount += ms * TICK_HW_COUNT;
+#endif
+  osal_update_timers();
+}
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          benchPeriod
+ *
+ * @brief       Random period of a benchmark timer.
+ *
+ * @param       none
+ *
+ * @return      ms, 1000 to 60999.
+ **************************************************************************************************
+ */
+static uint16 benchPeriod( void )
+{
+  return (uint16)(1000 + host_rand() % 60000);
+}
+
+
+/**************************************************************************************************
+ * @fn          benchCount
+ *
+ * @brief       Time the timer operations with 'cnt' timers running.
+ *
+ * @param       cnt - timers.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void benchCount( uint16 cnt )
+{
+  unsigned long long tick = 0;
+  unsigned long steps = 0, stepsMax = 0;
+  unsigned long long start = 0, restart = 0, lookup = 0;
+#if ( OSAL_TICKLESS )
+  unsigned long long gap = 0;
+#endif
+  long n;
+  uint16 idx;
+
+  host_srand( cnt );
+
+  // Event i + 1: one task holds them all.
+  for ( idx = 0; idx < cnt; idx++ )
+  {
+    osal_start_reload_timerRec( &rec[idx], 0, (uint16)(idx + 1), benchPeriod() );
+  }
+
+  for ( n = 0; n < BENCH_TICKS; n++ )
+  {
+    unsigned long long t0 = host_cycles();
+
+    benchTick( 1 );
+    tick += host_cycles() - t0;
+  }
+
+#if ( OSAL_TICKLESS )
+  for ( n = 0; n < BENCH_OPS; n++ )
+  {
+    unsigned long long t0 = host_cycles();
+
+    benchTick( TICK_HW_MAX );
+    gap += host_cycles() - t0;
+  }
+#endif
+
+  for ( n = 0; n < BENCH_STEPPED; n++ )
+  {
+    unsigned long dt;
+
+    host_steps_begin();
+    benchTick( 1 );
+    dt = host_steps_end();
+    steps += dt;
+    if ( stepsMax < dt )
+    {
+      stepsMax = dt;
+    }
+  }
+
+  for ( n = 0; n < BENCH_OPS; n++ )
+  {
+    uint16 pick = (uint16)(host_rand() % cnt);
+    uint16 period = benchPeriod();
+    unsigned long long t0 = host_cycles();
+
+    osal_start_reload_timerRec( &rec[pick], 0, (uint16)(pick + 1), period );
+    start += host_cycles() - t0;
+
+    pick = (uint16)(host_rand() % cnt);
+    period = benchPeriod();
+    t0 = host_cycles();
+    osal_stop_timerRec( &rec[pick] );
+    osal_start_reload_timerRec( &rec[pick], 0, (uint16)(pick + 1), period );
+    restart += host_cycles() - t0;
+
+    pick = (uint16)(host_rand() % cnt);
+    t0 = host_cycles();
+    osal_get_timeoutEx( 0, (uint16)(pick + 1) );
+    lookup += host_cycles() - t0;
+  }
+
+  if ( osal_timer_num_active() != cnt )
+  {
+    printf( "%-8s %6u  timers lost: %u running\n", BENCH_NAME, cnt, osal_timer_num_active() );
+  }
+
+  printf( "%-8s %6u  %8llu %8lu %8lu  %8llu %10llu %8llu", BENCH_NAME, cnt,
+          tick / BENCH_TICKS, steps / BENCH_STEPPED, stepsMax,
+          start / BENCH_OPS, restart / BENCH_OPS, lookup / BENCH_OPS );
+#if ( OSAL_TICKLESS )
+  printf( " %8llu\n", gap / BENCH_OPS );
+#else
+  printf( "        -\n" );
+#endif
+
+  for ( idx = 0; idx < cnt; idx++ )
+  {
+    osal_stop_timerRec( &rec[idx] );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the timer benchmark for each count up to BENCH_MAX.
+ *
+ * @param       none
+ *
+ * @return      0
+ **************************************************************************************************
+ */
+int main( void )
+{
+  byte idx;
+
+  osal_init_system();
+
+  printf( "%-8s timers    cycles    instr max instr     start stop+start   lookup catch-up\n",
+          BENCH_NAME );
+  printf( "                 (tick)   (tick)   (tick)  (cycles)   (cycles) (cycles) (cycles)\n" );
+
+  for ( idx = 0; (idx < sizeof( benchCnt ) / sizeof( benchCnt[0] )) &&
+                 (benchCnt[idx] <= BENCH_MAX); idx++ )
+  {
+    benchCount( benchCnt[idx] );
+  }
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
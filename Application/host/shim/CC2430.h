@@ -0,0 +1,27 @@
+/**************************************************************************************************
+    Filename:       CC2430.h
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Host stand-in for the Keil CC2430 SFR header. Only the registers the
+    OSAL modules and mac_backoff_timer.c touch are declared; they are
+    plain variables defined in host_stubs.c and mac_stubs.c. EA is
+    reached through host_ea(), where a test can take an interrupt, see
+    hostIsr.
+**************************************************************************************************/
+
+#ifndef CC2430_H
+#define CC2430_H
+
+extern unsigned char *host_ea( void );
+#define EA  (*host_ea())   // Global interrupt enable.
+extern unsigned char ST0;  // Sleep timer, low byte.
+extern unsigned char ST1;  // Sleep timer, middle byte.
+
+extern unsigned char T2CNF;  // MAC timer configuration.
+extern unsigned char T2TLD;  // MAC timer delay, low byte.
+extern unsigned char T2THD;  // MAC timer delay, high byte.
+
+#endif
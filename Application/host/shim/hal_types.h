@@ -0,0 +1,76 @@
+/**************************************************************************************************
+    Filename:       hal_types.h
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Host build of the CC2430 types. Found ahead of the target copy, it
+    keeps the Keil C51 sizes on a 64-bit host: long is 32 bits there, so
+    uint32 is an unsigned int here and the 32-bit clocks wrap as they do
+    on the target. Memory attributes are dropped.
+**************************************************************************************************/
+
+#ifndef HAL_TYPES_H
+#define HAL_TYPES_H
+
+#include <stddef.h>
+
+/* ------------------------------------------------------------------------------------------------
+ *                                               Types
+ * ------------------------------------------------------------------------------------------------
+ */
+typedef signed   char   int8;
+typedef unsigned char   uint8;
+
+typedef signed   short  int16;
+typedef unsigned short  uint16;
+
+typedef signed   int    int32;
+typedef unsigned int    uint32;
+
+typedef unsigned char   bool;
+
+// Tests of buffer alignment build with a wider type, as a 16- or 32-bit target has.
+#if !defined ( HOST_DATA_ALIGN )
+typedef uint8           halDataAlign_t;
+#else
+typedef HOST_DATA_ALIGN halDataAlign_t;
+#endif
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Memory Attributes
+ * ------------------------------------------------------------------------------------------------
+ */
+#define  CODE
+#define  XDATA
+#define  code
+#define  xdata
+#define  interrupt
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Standard Defines
+ * ------------------------------------------------------------------------------------------------
+ */
+#ifndef TRUE
+#define TRUE 1
+#endif
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       C Library Gaps
+ * ------------------------------------------------------------------------------------------------
+ */
+// Used by the GNU build of _ltoa() in OSAL.c; glibc has none (osal_stubs.c).
+extern char *ltoa( long value, char *buf, int radix );
+
+
+/**************************************************************************************************
+ */
+#endif
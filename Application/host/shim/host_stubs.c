@@ -0,0 +1,285 @@
+/**************************************************************************************************
+    Filename:       host_stubs.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The CC2430 registers and HAL hooks the OSAL modules need on the host,
+    and the helpers of host_test.h.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#if !defined ( _GNU_SOURCE )
+  #define _GNU_SOURCE
+#endif
+#include <signal.h>
+#include <time.h>
+#include <ucontext.h>
+#include "hal_types.h"
+#include "hal_assert.h"
+#include "host_test.h"
+
+#if defined ( __x86_64__ ) || defined ( __i386__ )
+  #include <x86intrin.h>
+#endif
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Global Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+unsigned char ST0;
+unsigned char ST1;
+
+unsigned long hostFailures;
+
+void (*hostIsr)( void );    // Interrupt raised by the test.
+unsigned short hostIsrSkip; // EA accesses to let pass before it is taken.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static unsigned long hostSeed = 1;
+static unsigned char hostEA = 1;
+
+static volatile unsigned long hostSteps;
+static volatile unsigned char hostStepsStop;
+
+
+/**************************************************************************************************
+ * @fn          host_ea
+ *
+ * @brief       Access to EA. A raised interrupt is taken here while interrupts are enabled,
+ *              once hostIsrSkip accesses have passed: every critical section entry and exit is
+ *              a point where the interrupt can land.
+ *
+ * @param       none
+ *
+ * @return      The interrupt enable flag.
+ **************************************************************************************************
+ */
+unsigned char *host_ea( void )
+{
+  if ( (hostIsr != NULL) && hostEA )
+  {
+    if ( hostIsrSkip != 0 )
+    {
+      hostIsrSkip--;
+    }
+    else
+    {
+      void (*isr)( void ) = hostIsr;
+
+      hostIsr = NULL;
+      isr();
+    }
+  }
+
+  return &hostEA;
+}
+
+
+/**************************************************************************************************
+ * @fn          halAssertFatalError
+ *
+ * @brief       A failed HAL_ASSERT() ends the test program.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void halAssertFatalError( void )
+{
+  printf( "HAL_ASSERT failed\n" );
+  exit( 2 );
+}
+
+
+/**************************************************************************************************
+ * @fn          host_srand
+ *
+ * @brief       Seed host_rand(), so that every run of a test sees the same sequence.
+ *
+ * @param       seed - any value.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void host_srand( unsigned long seed )
+{
+  hostSeed = seed;
+}
+
+
+/**************************************************************************************************
+ * @fn          host_rand
+ *
+ * @brief       Linear congruential generator, independent of the C library.
+ *
+ * @param       none
+ *
+ * @return      31 random bits.
+ **************************************************************************************************
+ */
+unsigned long host_rand( void )
+{
+  hostSeed = (hostSeed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+
+  return ( hostSeed >> 1 );
+}
+
+
+/**************************************************************************************************
+ * @fn          host_cycles
+ *
+ * @brief       Read the CPU time stamp counter; nanoseconds where there is none.
+ *
+ * @param       none
+ *
+ * @return      Free-running count.
+ **************************************************************************************************
+ */
+unsigned long long host_cycles( void )
+{
+#if defined ( __x86_64__ ) || defined ( __i386__ )
+  return __rdtsc();
+#else
+  struct timespec ts;
+
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ( (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec );
+#endif
+}
+
+
+/**************************************************************************************************
+ * @fn          hostStepTrap
+ *
+ * @brief       SIGTRAP handler: one call per instruction executed with the trap flag set.
+ *              Clears the flag in the interrupted context once host_steps_end() ran.
+ *
+ * @param       sig - SIGTRAP.
+ * @param       info - unused.
+ * @param       ctx - interrupted context.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+#if defined ( __x86_64__ )
+static void hostStepTrap( int sig, siginfo_t *info, void *ctx )
+{
+  (void)sig;
+  (void)info;
+
+  hostSteps++;
+  if ( hostStepsStop )
+  {
+    ((ucontext_t *)ctx)->uc_mcontext.gregs[REG_EFL] &= ~0x100;
+  }
+}
+#endif
+
+
+/**************************************************************************************************
+ * @fn          host_steps_begin
+ *
+ * @brief       Start counting executed instructions by single-stepping. Unlike host_cycles()
+ *              the count does not depend on caches or host interrupts, so it can bound a code
+ *              path exactly. About ten thousand times slower than running free.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void host_steps_begin( void )
+{
+#if defined ( __x86_64__ )
+  static unsigned char installed;
+
+  if ( !installed )
+  {
+    struct sigaction sa;
+
+    memset( &sa, 0, sizeof( sa ) );
+    sa.sa_sigaction = hostStepTrap;
+    sa.sa_flags = SA_SIGINFO;
+    sigaction( SIGTRAP, &sa, NULL );
+    installed = 1;
+  }
+
+  hostStepsStop = 0;
+  hostSteps = 0;
+  __asm__ volatile ( "pushfq; orq $0x100, (%%rsp); popfq" ::: "memory", "cc" );
+#endif
+}
+
+
+/**************************************************************************************************
+ * @fn          host_steps_end
+ *
+ * @brief       Stop counting instructions.
+ *
+ * @param       none
+ *
+ * @return      Instructions since host_steps_begin(), plus a constant overhead; 0 where
+ *              single-stepping is not supported.
+ **************************************************************************************************
+ */
+unsigned long host_steps_end( void )
+{
+  hostStepsStop = 1;
+
+  return hostSteps;
+}
+
+
+/**************************************************************************************************
+ * @fn          host_steps_now
+ *
+ * @brief       Read the instruction count while stepping, e.g. as the clock of
+ *              OSALMEM_IRQOFF_NOW() so that interrupt-off windows are timed in instructions.
+ *
+ * @param       none
+ *
+ * @return      Instructions since host_steps_begin().
+ **************************************************************************************************
+ */
+unsigned long host_steps_now( void )
+{
+  return hostSteps;
+}
+
+
+/**************************************************************************************************
+ * @fn          host_result
+ *
+ * @brief       Report the outcome of a test program.
+ *
+ * @param       name - test name.
+ *
+ * @return      Exit code: 0 if every check passed.
+ **************************************************************************************************
+ */
+int host_result( const char *name )
+{
+  if ( hostFailures != 0 )
+  {
+    printf( "%s: FAIL (%lu)\n", name, hostFailures );
+    return 1;
+  }
+
+  printf( "%s: PASS\n", name );
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,82 @@
+/**************************************************************************************************
+    Filename:       host_test.h
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Checks, a seeded random source and a cycle counter shared by the
+    host tests and benchmarks. Every test program counts its failed
+    checks and exits with HOST_RESULT(), non-zero on any failure.
+**************************************************************************************************/
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ------------------------------------------------------------------------------------------------
+ *                                             Macros
+ * ------------------------------------------------------------------------------------------------
+ */
+#define HOST_CHECK( expr )                                                             \
+  do {                                                                                 \
+    if ( !(expr) )                                                                     \
+    {                                                                                  \
+      printf( "%s:%d: check failed: %s\n", __FILE__, __LINE__, #expr );              \
+      hostFailures++;                                                                  \
+    }                                                                                  \
+  } while ( 0 )
+
+#define HOST_RESULT( name )  host_result( name )
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Global Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+extern unsigned long hostFailures;
+
+// Running task and system clock seen by the heap (mem_stubs.c).
+extern unsigned char hostTask;
+extern unsigned int hostClock;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Functions
+ * ------------------------------------------------------------------------------------------------
+ */
+void host_srand( unsigned long seed );
+unsigned long host_rand( void );
+unsigned long long host_cycles( void );
+void host_steps_begin( void );
+unsigned long host_steps_end( void );
+unsigned long host_steps_now( void );
+int host_result( const char *name );
+
+// host_stubs.c: interrupt taken at the next EA access with interrupts enabled.
+extern void (*hostIsr)( void );
+extern unsigned short hostIsrSkip;
+
+// mem_stubs.c
+unsigned short host_mem_largest( void );
+
+// osal_stubs.c: HAL poll hook, OSAL_TIMER, halSleep() and TimerElapsed() state.
+extern void (*hostPollHook)( void );
+extern unsigned short hostTimerCount;
+extern unsigned short hostTimerCompare;
+extern unsigned char hostTimerOn;
+extern unsigned short hostSleepCnt;
+extern unsigned short hostSleepMs;
+extern unsigned int hostTimerElapsed;
+
+// mac_stubs.c: MAC backoff counter, stepped one backoff at a time.
+void host_backoff_step( void );
+extern unsigned int hostBackoffCount;
+extern unsigned int hostBackoffCompare;
+extern unsigned short hostRollovers;
+extern unsigned short hostTriggers;
+
+#endif
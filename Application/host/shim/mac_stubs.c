@@ -0,0 +1,111 @@
+/**************************************************************************************************
+    Filename:       mac_stubs.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The MCU and low-level MAC services used by mac_backoff_timer.c, for
+    the tests that build it on its own. The backoff counter of the MAC
+    timer is simulated: host_backoff_step() moves it on one 320 usec
+    backoff and takes the compare interrupt when the count reaches the
+    compare with the interrupt enabled, as the overflow counter does.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "hal_types.h"
+#include "mac_mcu.h"
+#include "mac_low_level.h"
+#include "mac_backoff_timer.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Global Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+unsigned char T2CNF;
+unsigned char T2TLD;
+unsigned char T2THD;
+
+uint8 macTxActive;
+
+uint32 hostBackoffCount;     // Overflow count.
+uint32 hostBackoffCompare;   // Overflow compare.
+uint16 hostRollovers;        // Calls of macBackoffTimerRolloverCallback().
+uint16 hostTriggers;         // Calls of macBackoffTimerTriggerCallback().
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static uint8 hostT2PEROF2;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                   mac_mcu.c / MAC Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+uint32 macMcuOverflowCount( void )
+{
+  return hostBackoffCount;
+}
+
+void macMcuOverflowSetCount( uint32 count )
+{
+  hostBackoffCount = count;
+}
+
+void macMcuOverflowSetCompare( uint32 count )
+{
+  hostBackoffCompare = count;
+}
+
+void macMcuOrT2PEROF2( uint8 value )
+{
+  hostT2PEROF2 |= value;
+}
+
+void macMcuAndT2PEROF2( uint8 value )
+{
+  hostT2PEROF2 &= value;
+}
+
+void macBackoffTimerRolloverCallback( void )
+{
+  hostRollovers++;
+}
+
+void macBackoffTimerTriggerCallback( void )
+{
+  hostTriggers++;
+}
+
+
+/**************************************************************************************************
+ * @fn          host_backoff_step
+ *
+ * @brief       Move the backoff counter on one backoff, taking the compare interrupt if due.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void host_backoff_step( void )
+{
+  hostBackoffCount++;
+
+  if ( (hostBackoffCount == hostBackoffCompare) && (hostT2PEROF2 & OFCMPIM) )
+  {
+    macBackoffTimerCompareIsr();
+  }
+}
+
+
+/**************************************************************************************************
+*/
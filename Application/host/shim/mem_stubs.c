@@ -0,0 +1,97 @@
+/**************************************************************************************************
+    Filename:       mem_stubs.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The OSAL.c and OSAL_Timers.c services used by OSAL_Memory.c, for the
+    tests that build the heap on its own. The running task and the clock
+    are set by the test through hostTask and hostClock.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include <string.h>
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Global Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+byte hostTask = TASK_NO_TASK;
+uint32 hostClock;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                  OSAL.c / OSAL_Timers.c Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+void *osal_memset( void *dest, byte value, int len )
+{
+  return memset( dest, value, len );
+}
+
+void *osal_memcpy( void *dst, const void GENERIC *src, unsigned int len )
+{
+  return memcpy( dst, src, len );
+}
+
+byte osal_self( void )
+{
+  return hostTask;
+}
+
+uint32 osal_GetSystemClock( void )
+{
+  return hostClock;
+}
+
+
+/**************************************************************************************************
+ * @fn          host_mem_largest
+ *
+ * @brief       Find the largest block the heap can hand out now, by bisecting on trial
+ *              allocations that are freed again at once.
+ *
+ * @param       none
+ *
+ * @return      Largest request, in bytes, that succeeds.
+ **************************************************************************************************
+ */
+uint16 host_mem_largest( void )
+{
+  uint16 lo = 0;
+  uint16 hi = MAXMEMHEAP;
+
+  while ( lo < hi )
+  {
+    uint16 mid = (uint16)((lo + hi + 1) / 2);
+    void *ptr = osal_mem_alloc( mid );
+
+    if ( ptr != NULL )
+    {
+      osal_mem_free( ptr );
+      lo = mid;
+    }
+    else
+    {
+      hi = mid - 1;
+    }
+  }
+
+  return lo;
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,107 @@
+/**************************************************************************************************
+    Filename:       osal_stubs.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The HAL and board services used by OSAL.c and its modules, for the
+    tests that build the whole OSAL. OSAL_TIMER is a free-running
+    16-bit count that the test advances through hostTimerCount; the
+    main loop's HAL poll calls the test's hostPollHook.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include <stdio.h>
+#include "ZComDef.h"
+#include "hal_timer.h"
+#include "hal_uart.h"
+#include "hal_sleep.h"
+#include "hal_drivers.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Global Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+void (*hostPollHook)( void );
+
+uint16 hostTimerCount;    // OSAL_TIMER count.
+uint16 hostTimerCompare;  // OSAL_TIMER compare value.
+byte hostTimerOn;         // OSAL_TIMER started.
+
+uint16 hostSleepCnt;      // Calls of halSleep().
+uint16 hostSleepMs;       // Timeout of the last halSleep().
+uint32 hostTimerElapsed;  // TimerElapsed() after a sleep, in TICK_COUNT units.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        HAL Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+void Hal_ProcessPoll( void )
+{
+  if ( hostPollHook != NULL )
+  {
+    hostPollHook();
+  }
+}
+
+uint8 HalTimerStart( uint8 timerId, uint32 timePerTick )
+{
+  hostTimerOn = TRUE;
+  return HAL_TIMER_OK;
+}
+
+uint8 HalTimerStop( uint8 timerId )
+{
+  hostTimerOn = FALSE;
+  return HAL_TIMER_OK;
+}
+
+uint16 HalTimerCount( uint8 timerId )
+{
+  return hostTimerCount;
+}
+
+uint8 HalTimerCompare( uint8 timerId, uint16 count )
+{
+  hostTimerCompare = count;
+  return HAL_TIMER_OK;
+}
+
+uint8 HalTimerInterruptEnable( uint8 timerId, uint8 channelMode, bool enable )
+{
+  return HAL_TIMER_OK;
+}
+
+void halSleep( uint16 osal_timer )
+{
+  hostSleepCnt++;
+  hostSleepMs = osal_timer;
+}
+
+uint32 TimerElapsed( void )
+{
+  return hostTimerElapsed;
+}
+
+uint16 Onboard_rand( void )
+{
+  return (uint16)host_rand();
+}
+
+char *ltoa( long value, char *buf, int radix )
+{
+  sprintf( buf, (radix == 16) ? "%lx" : "%ld", value );
+  return buf;
+}
+
+
+/**************************************************************************************************
+*/
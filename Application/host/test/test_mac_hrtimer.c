@@ -0,0 +1,416 @@
+/**************************************************************************************************
+    Filename:       test_mac_hrtimer.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The high resolution timers of mac_backoff_timer.c, MAC_HrTimerStart()
+    and friends, against the simulated backoff counter of mac_stubs.c,
+    with a short rollover so that deadlines span many periods. Timers are
+    started and stopped at random, some from their own callbacks, while
+    the MAC trigger is set and cancelled; every callback must come on
+    the backoff of its deadline, the trigger and the rollover on theirs.
+    Then a count moved past a deadline or back before it, a full queue,
+    and the error of a deadline asked in microseconds from any point of
+    a backoff. Built with MACNODEBUG, which lets a trigger be set on
+    the rollover count, that trigger must come with the rollover.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "hal_types.h"
+#include "mac_api.h"
+#include "mac_low_level.h"
+#include "mac_backoff_timer.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_ROLLOVER  1000     // Backoffs per period.
+#define TEST_STEPS     200000L  // Random operations.
+#define TEST_LONGEST   (3UL * TEST_ROLLOVER)
+#define USEC_PER_BACKOFF  320
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+// Backoffs since the test began; the counter itself rolls over.
+static uint32 vtime;
+
+// Model: vtime of each timer's deadline, 0 if not running; and of the trigger.
+static uint32 due[MAC_HR_TIMER_CNT];
+static uint32 triggerDue;
+
+static uint32 fired;
+static uint8 chain;        // Callbacks that start a timer again.
+
+
+/**************************************************************************************************
+ * @fn          step
+ *
+ * @brief       Move the counter on 'n' backoffs, checking the rollovers and the trigger.
+ *
+ * @param       n - backoffs.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void step( uint32 n )
+{
+  while ( n-- != 0 )
+  {
+    uint16 triggers = hostTriggers;
+    uint16 rollovers = hostRollovers;
+    uint8 id;
+
+    vtime++;
+    host_backoff_step();
+
+    HOST_CHECK( (uint16)(hostRollovers - rollovers) == ((vtime % TEST_ROLLOVER) == 0) );
+    if ( hostTriggers != triggers )
+    {
+      HOST_CHECK( vtime == triggerDue );
+      triggerDue = 0;
+    }
+    HOST_CHECK( (triggerDue == 0) || (triggerDue > vtime) );
+
+    // Nothing left behind.
+    for ( id = 0; id < MAC_HR_TIMER_CNT; id++ )
+    {
+      HOST_CHECK( (due[id] == 0) || (due[id] > vtime) );
+    }
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          start
+ *
+ * @brief       Start a timer, in the MAC and in the model.
+ *
+ * @param       backoffs - backoffs to the deadline.
+ * @param       pCback - callback.
+ *
+ * @return      Timer ID.
+ **************************************************************************************************
+ */
+static uint8 start( uint32 backoffs, macHrTimerCback_t pCback )
+{
+  uint8 id = MAC_HrTimerStart( backoffs, pCback );
+
+  if ( id != MAC_HR_TIMER_NONE )
+  {
+    HOST_CHECK( (id < MAC_HR_TIMER_CNT) && (due[id] == 0) );
+    due[id] = vtime + ((backoffs != 0) ? backoffs : 1);
+  }
+
+  return id;
+}
+
+
+/**************************************************************************************************
+ * @fn          testCback
+ *
+ * @brief       Timer callback: it must come at the deadline; some start a timer again.
+ *
+ * @param       timerId - timer.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testCback( uint8 timerId )
+{
+  HOST_CHECK( (timerId < MAC_HR_TIMER_CNT) && (due[timerId] == vtime) );
+  due[timerId] = 0;
+  fired++;
+
+  if ( chain != 0 )
+  {
+    chain--;
+    start( 1 + host_rand() % 40, testCback );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testRandom
+ *
+ * @brief       Random starts, stops, triggers and steps against the model.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRandom( void )
+{
+  long n;
+  uint8 id;
+
+  host_srand( 19 );
+
+  for ( n = 0; n < TEST_STEPS; n++ )
+  {
+    unsigned long op = host_rand() % 16;
+
+    if ( op < 4 )
+    {
+      // Short deadlines, and ones past several rollovers.
+      uint32 backoffs = ( op == 0 ) ? host_rand() % TEST_LONGEST : host_rand() % 20;
+
+      id = start( backoffs, testCback );
+      HOST_CHECK( (id != MAC_HR_TIMER_NONE) || (MAC_HrTimerPending() == MAC_HR_TIMER_CNT) );
+    }
+    else if ( op < 6 )
+    {
+      id = (uint8)(host_rand() % MAC_HR_TIMER_CNT);
+      HOST_CHECK( MAC_HrTimerStop( id ) == ((due[id] != 0) ? MAC_SUCCESS : MAC_INVALID_HANDLE) );
+      due[id] = 0;
+    }
+    else if ( op == 6 )
+    {
+      uint32 trigger = host_rand() % TEST_ROLLOVER;
+      uint32 count = vtime % TEST_ROLLOVER;
+
+      // A trigger the count has passed is for the next period.
+      macBackoffTimerSetTrigger( trigger );
+      triggerDue = vtime - count + trigger + ((trigger > count) ? 0 : TEST_ROLLOVER);
+    }
+    else if ( op == 7 )
+    {
+      macBackoffTimerCancelTrigger();
+      triggerDue = 0;
+    }
+    else if ( op == 8 )
+    {
+      chain = 3;
+    }
+    else
+    {
+      step( 1 + host_rand() % 50 );
+    }
+
+    if ( (n % 16) == 0 )
+    {
+      uint8 cnt = 0;
+
+      for ( id = 0; id < MAC_HR_TIMER_CNT; id++ )
+      {
+        cnt += ( due[id] != 0 );
+      }
+      HOST_CHECK( MAC_HrTimerPending() == cnt );
+    }
+  }
+
+  chain = 0;
+  macBackoffTimerCancelTrigger();
+  triggerDue = 0;
+  for ( id = 0; id < MAC_HR_TIMER_CNT; id++ )
+  {
+    MAC_HrTimerStop( id );
+    due[id] = 0;
+  }
+
+  HOST_CHECK( (fired > TEST_STEPS / 10) && (hostTriggers != 0) );
+}
+
+
+/**************************************************************************************************
+ * @fn          testCount
+ *
+ * @brief       A deadline the count is moved past fires at the next backoff; one the count is
+ *              moved back before stays at its backoff count, as after a beacon realignment.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static uint8 countFired;
+
+static void countCback( uint8 timerId )
+{
+  countFired++;
+}
+
+static void testCount( void )
+{
+  uint32 n;
+
+  // Start of a period, then 100 backoffs in.
+  step( TEST_ROLLOVER - (vtime % TEST_ROLLOVER) + 100 );
+
+  countFired = 0;
+  HOST_CHECK( MAC_HrTimerStart( 50, countCback ) != MAC_HR_TIMER_NONE );
+  macBackoffTimerSetCount( 200 );
+  host_backoff_step();
+  HOST_CHECK( countFired == 1 );
+
+  macBackoffTimerSetCount( 100 );
+  countFired = 0;
+  HOST_CHECK( MAC_HrTimerStart( 50, countCback ) != MAC_HR_TIMER_NONE );
+  macBackoffTimerSetCount( 20 );
+  for ( n = 0; (n < 200) && (countFired == 0); n++ )
+  {
+    host_backoff_step();
+  }
+  HOST_CHECK( (countFired == 1) && (n == 130) );
+
+  // Back to the model's count.
+  macBackoffTimerSetCount( vtime % TEST_ROLLOVER );
+  HOST_CHECK( MAC_HrTimerPending() == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testFull
+ *
+ * @brief       MAC_HR_TIMER_CNT timers can run at once; the next start is refused, and a stop
+ *              of a timer that is not running is an invalid handle.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testFull( void )
+{
+  uint8 id;
+
+  for ( id = 0; id < MAC_HR_TIMER_CNT; id++ )
+  {
+    HOST_CHECK( MAC_HrTimerStart( 1000, countCback ) == id );
+  }
+  HOST_CHECK( MAC_HrTimerStart( 1000, countCback ) == MAC_HR_TIMER_NONE );
+  HOST_CHECK( MAC_HrTimerPending() == MAC_HR_TIMER_CNT );
+
+  for ( id = 0; id < MAC_HR_TIMER_CNT; id++ )
+  {
+    HOST_CHECK( MAC_HrTimerStop( id ) == MAC_SUCCESS );
+    HOST_CHECK( MAC_HrTimerStop( id ) == MAC_INVALID_HANDLE );
+  }
+  HOST_CHECK( MAC_HrTimerStop( MAC_HR_TIMER_CNT ) == MAC_INVALID_HANDLE );
+
+  countFired = 0;
+  step( 2000 );
+  HOST_CHECK( countFired == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testUsec
+ *
+ * @brief       A deadline of 'us' microseconds, started at any point of a backoff, comes less
+ *              than a backoff early or late.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testUsec( void )
+{
+  long early = 0, late = 0;
+  uint32 us;
+
+  host_srand( 23 );
+
+  for ( us = 1; us <= 20000; us += 7 )
+  {
+    // The call lands 'phase' usec into the backoff that began at vtime.
+    uint32 phase = host_rand() % USEC_PER_BACKOFF;
+    uint32 startAt = vtime;
+    uint8 id = start( MAC_HR_USEC_TO_BACKOFFS( us ), testCback );
+    long err;
+
+    HOST_CHECK( id != MAC_HR_TIMER_NONE );
+    step( MAC_HR_USEC_TO_BACKOFFS( us ) );
+    HOST_CHECK( due[id] == 0 );
+
+    err = (long)((vtime - startAt) * USEC_PER_BACKOFF - phase) - (long)us;
+    HOST_CHECK( (err > -USEC_PER_BACKOFF) && (err < USEC_PER_BACKOFF) );
+    early = ( err < early ) ? err : early;
+    late = ( err > late ) ? err : late;
+  }
+
+  printf( "test_mac_hrtimer: deadlines in usec come %ld to %ld usec off\n", early, late );
+}
+
+
+#if defined ( MACNODEBUG )
+/**************************************************************************************************
+ * @fn          testTriggerAtRollover
+ *
+ * @brief       A trigger set on the rollover count comes with the rollover, once, with high
+ *              resolution deadlines on either side of it.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testTriggerAtRollover( void )
+{
+  uint16 triggers = hostTriggers;
+  uint8 round;
+
+  for ( round = 0; round < 3; round++ )
+  {
+    // Start of a period, then 100 backoffs in.
+    step( TEST_ROLLOVER - (vtime % TEST_ROLLOVER) + 100 );
+
+    if ( round != 0 )
+    {
+      start( TEST_ROLLOVER - 100 - round, testCback );
+      start( TEST_ROLLOVER - 100 + round, testCback );
+    }
+
+    macBackoffTimerSetTrigger( TEST_ROLLOVER );
+    triggerDue = vtime - 100 + TEST_ROLLOVER;
+    step( TEST_ROLLOVER );
+    HOST_CHECK( triggerDue == 0 );
+  }
+
+  HOST_CHECK( (uint16)(hostTriggers - triggers) == 3 );
+  HOST_CHECK( MAC_HrTimerPending() == 0 );
+}
+#endif
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the high resolution timer tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  macBackoffTimerInit();
+  macBackoffTimerSetRollover( TEST_ROLLOVER );
+
+  testRandom();
+  testFull();
+  testUsec();
+  testCount();
+#if defined ( MACNODEBUG )
+  testTriggerAtRollover();
+#endif
+
+  return HOST_RESULT( "test_mac_hrtimer" );
+}
+
+
+/**************************************************************************************************
+*/
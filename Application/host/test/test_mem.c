@@ -0,0 +1,243 @@
+/**************************************************************************************************
+    Filename:       test_mem.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Correctness of the OSAL heap, built once per OSALMEM_ALLOCATOR with
+    OSALMEM_METRICS and asserts on: random allocate / grow / free with the
+    payload of every live block checked, the metrics back at zero once
+    everything is freed, and the largest block back to what a fresh heap
+    gives, i.e. no free memory is lost to fragmentation for good.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define LIVE_MAX    64       // Blocks held at once.
+#define STEPS       400000L  // Operations per run.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static byte *live[LIVE_MAX];
+static uint16 liveLen[LIVE_MAX];
+static byte liveTag[LIVE_MAX];
+
+
+/**************************************************************************************************
+ * @fn          checkBlock
+ *
+ * @brief       Check that a live block still holds its fill pattern.
+ *
+ * @param       idx - slot of the block.
+ *
+ * @return      TRUE if intact.
+ **************************************************************************************************
+ */
+static byte checkBlock( byte idx )
+{
+  uint16 i;
+
+  for ( i = 0; i < liveLen[idx]; i++ )
+  {
+    if ( live[idx][i] != (byte)(liveTag[idx] + i) )
+    {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+
+/**************************************************************************************************
+ * @fn          fillBlock
+ *
+ * @brief       Write the fill pattern of a live block from byte 'from' on.
+ *
+ * @param       idx - slot of the block.
+ * @param       from - first byte to write.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void fillBlock( byte idx, uint16 from )
+{
+  uint16 i;
+
+  for ( i = from; i < liveLen[idx]; i++ )
+  {
+    live[idx][i] = (byte)(liveTag[idx] + i);
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testRandom
+ *
+ * @brief       Random allocate / grow / free, mostly message-sized with some UART-sized
+ *              blocks, checking every block's payload and that blocks never overlap.
+ *
+ * @param       seed - random seed.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRandom( unsigned long seed )
+{
+  long step;
+  byte idx;
+
+  host_srand( seed );
+
+  for ( step = 0; step < STEPS; step++ )
+  {
+    idx = (byte)(host_rand() % LIVE_MAX);
+
+    if ( live[idx] == NULL )
+    {
+      uint16 len = (host_rand() % 4 == 0) ? (uint16)(1 + host_rand() % 300)
+                                          : (uint16)(1 + host_rand() % 40);
+
+      live[idx] = osal_mem_alloc( len );
+      if ( live[idx] != NULL )
+      {
+        liveLen[idx] = len;
+        liveTag[idx] = (byte)host_rand();
+        fillBlock( idx, 0 );
+      }
+    }
+    else if ( !checkBlock( idx ) )
+    {
+      HOST_CHECK( !"block payload overwritten" );
+      return;
+    }
+    else if ( host_rand() % 4 == 0 )
+    {
+      uint16 len = (uint16)(liveLen[idx] + 1 + host_rand() % 24);
+      byte *ptr = osal_mem_realloc( live[idx], len );
+
+      if ( ptr != NULL )
+      {
+        live[idx] = ptr;
+        HOST_CHECK( checkBlock( idx ) );
+        liveLen[idx] = len;
+        fillBlock( idx, 0 );
+      }
+      else
+      {
+        // A failed grow leaves the block untouched.
+        HOST_CHECK( checkBlock( idx ) );
+      }
+    }
+    else
+    {
+      osal_mem_free( live[idx] );
+      live[idx] = NULL;
+    }
+  }
+
+  for ( idx = 0; idx < LIVE_MAX; idx++ )
+  {
+    if ( live[idx] != NULL )
+    {
+      HOST_CHECK( checkBlock( idx ) );
+      osal_mem_free( live[idx] );
+      live[idx] = NULL;
+    }
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testSmallThenLarge
+ *
+ * @brief       Fill the heap with the smallest blocks, free them all, and ask for one large
+ *              block. Every allocator must be able to reuse the memory for it.
+ *
+ * @param       fresh - largest block of a fresh heap.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testSmallThenLarge( uint16 fresh )
+{
+  static void *small[MAXMEMHEAP / 2];
+  uint16 cnt = 0;
+  void *ptr;
+
+  while ( (cnt < (MAXMEMHEAP / 2)) && ((small[cnt] = osal_mem_alloc( 1 )) != NULL) )
+  {
+    cnt++;
+  }
+  HOST_CHECK( cnt > (MAXMEMHEAP / 16) );
+
+  while ( cnt != 0 )
+  {
+    osal_mem_free( small[--cnt] );
+  }
+
+  ptr = osal_mem_alloc( fresh );
+  HOST_CHECK( ptr != NULL );
+  if ( ptr != NULL )
+  {
+    osal_mem_free( ptr );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the heap tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint16 fresh;
+  unsigned long seed;
+
+  osal_mem_init();
+  fresh = host_mem_largest();
+  HOST_CHECK( fresh > (MAXMEMHEAP / 2) );
+
+  for ( seed = 1; seed <= 4; seed++ )
+  {
+    testRandom( seed );
+
+#if ( OSALMEM_METRICS )
+    HOST_CHECK( osal_heap_mem_used() == 0 );
+    HOST_CHECK( osal_heap_block_cnt() == osal_heap_block_free() );
+#endif
+    HOST_CHECK( host_mem_largest() == fresh );
+  }
+
+  testSmallThenLarge( fresh );
+  HOST_CHECK( host_mem_largest() == fresh );
+
+  return HOST_RESULT( "test_mem" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,385 @@
+/**************************************************************************************************
+    Filename:       test_mem_bound.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Worst case of osal_mem_alloc() and osal_mem_free() against heap
+    fragmentation. Every operation is single-stepped, so its cost is an
+    exact instruction count rather than a noisy time. Random traces are
+    run with few, then more and more blocks live, and finally on a heap
+    cut into the most free fragments it can hold.
+
+    The TLSF allocator claims a worst case independent of the number of
+    free blocks: the most instructions spent by any operation on the
+    fragmented heaps must not exceed the most spent on the lightly used
+    one. The segregated-fit allocator looks only at list heads, but
+    tries more classes for some requests than others: its worst case is
+    built on purpose - a failed request that tries every class, the
+    smallest request split off the largest free block, and a free that
+    merges with both neighbours - and no random or fragmented trace may
+    exceed it. First-fit is only reported, so that the growth of its
+    walk can be compared.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define BOUND_STEPS  2000   // Operations per trace.
+#define BOUND_SEEDS  2      // Traces per fragmentation level.
+#define LIVE_MAX     128    // Most blocks live at once.
+
+static const char *allocName[] = { "first-fit", "segfit", "tlsf" };
+static const byte liveLevel[] = { 4, 32, LIVE_MAX };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static void *live[LIVE_MAX];
+static unsigned long maxAlloc;
+static unsigned long maxFree;
+static uint16 maxFrag;
+
+
+/**************************************************************************************************
+ * @fn          boundAlloc
+ *
+ * @brief       osal_mem_alloc(), counting its instructions.
+ *
+ * @param       size - bytes to allocate.
+ *
+ * @return      Block or NULL.
+ **************************************************************************************************
+ */
+static void *boundAlloc( uint16 size )
+{
+  unsigned long steps;
+  void *ptr;
+
+#if ( OSALMEM_METRICS )
+  if ( maxFrag < osal_heap_block_free() )
+  {
+    maxFrag = osal_heap_block_free();
+  }
+#endif
+
+  host_steps_begin();
+  ptr = osal_mem_alloc( size );
+  steps = host_steps_end();
+
+  if ( maxAlloc < steps )
+  {
+    maxAlloc = steps;
+  }
+
+  return ptr;
+}
+
+
+/**************************************************************************************************
+ * @fn          boundFree
+ *
+ * @brief       osal_mem_free(), counting its instructions.
+ *
+ * @param       ptr - block to free.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void boundFree( void *ptr )
+{
+  unsigned long steps;
+
+  host_steps_begin();
+  osal_mem_free( ptr );
+  steps = host_steps_end();
+
+  if ( maxFree < steps )
+  {
+    maxFree = steps;
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          boundTrace
+ *
+ * @brief       Random allocate / free with up to 'slots' blocks live, message-sized with some
+ *              UART-sized blocks.
+ *
+ * @param       seed - random seed.
+ * @param       slots - most blocks live at once.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void boundTrace( unsigned long seed, byte slots )
+{
+  long step;
+  byte idx;
+
+  host_srand( seed );
+
+  for ( step = 0; step < BOUND_STEPS; step++ )
+  {
+    idx = (byte)(host_rand() % slots);
+
+    if ( live[idx] == NULL )
+    {
+      live[idx] = boundAlloc( (host_rand() % 8 == 0) ? (uint16)(1 + host_rand() % 200)
+                                                     : (uint16)(1 + host_rand() % 24) );
+    }
+    else
+    {
+      boundFree( live[idx] );
+      live[idx] = NULL;
+    }
+  }
+
+  for ( idx = 0; idx < LIVE_MAX; idx++ )
+  {
+    if ( live[idx] != NULL )
+    {
+      osal_mem_free( live[idx] );
+      live[idx] = NULL;
+    }
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          boundComb
+ *
+ * @brief       Fill the heap with the smallest blocks and free every other one, which leaves
+ *              the most free fragments the heap can hold. Then ask for a block that no fragment
+ *              fits and free the rest, each free merging with both neighbours.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void boundComb( void )
+{
+  static void *small[MAXMEMHEAP / 2];
+  uint16 cnt = 0;
+  uint16 idx;
+  void *ptr;
+
+  while ( (cnt < (MAXMEMHEAP / 2)) && ((small[cnt] = osal_mem_alloc( 1 )) != NULL) )
+  {
+    cnt++;
+  }
+
+  for ( idx = 0; idx < cnt; idx += 2 )
+  {
+    osal_mem_free( small[idx] );
+  }
+
+  ptr = boundAlloc( 16 );
+  if ( ptr != NULL )
+  {
+    osal_mem_free( ptr );
+  }
+  ptr = boundAlloc( MAXMEMHEAP / 4 );
+  if ( ptr != NULL )
+  {
+    osal_mem_free( ptr );
+  }
+
+  for ( idx = 1; idx < cnt; idx += 2 )
+  {
+    boundFree( small[idx] );
+  }
+}
+
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+/**************************************************************************************************
+ * @fn          boundFill
+ *
+ * @brief       Fill what is left of the heap: blocks from the bottom, then the smallest ones from
+ *              the top.
+ *
+ * @param       fill - filled blocks.
+ *
+ * @return      Number of filled blocks.
+ **************************************************************************************************
+ */
+static uint16 boundFill( void **fill )
+{
+  uint16 cnt = 0;
+
+  while ( (cnt < (MAXMEMHEAP / 8)) && ((fill[cnt] = osal_mem_alloc( 24 )) != NULL) )
+  {
+    cnt++;
+  }
+  while ( (cnt < (MAXMEMHEAP / 8)) && ((fill[cnt] = osal_mem_alloc( 1 )) != NULL) )
+  {
+    cnt++;
+  }
+
+  return cnt;
+}
+
+
+/**************************************************************************************************
+ * @fn          boundWorst
+ *
+ * @brief       Build the longest paths of the segregated-fit allocator. With the heap full and
+ *              one large block free, the smallest request tries every class up to it and splits
+ *              it, and a request that nothing fits tries every class. Then a block is freed
+ *              between 2 free blocks that are each at the head of a list when taken off it,
+ *              with a block behind, and the merged block goes into a class that is not empty,
+ *              so that both unlinks and the insert look up a class and touch a neighbour.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void boundWorst( void )
+{
+  static void *fill[MAXMEMHEAP / 8];
+  uint16 cnt;
+  uint16 idx;
+  void *blk[10];
+  void *ptr;
+
+  // The large block comes first, so that the blocks after it keep it from the wilderness.
+  blk[0] = osal_mem_alloc( host_mem_largest() / 2 );
+  HOST_CHECK( blk[0] != NULL );
+  cnt = boundFill( fill );
+
+  osal_mem_free( blk[0] );
+  ptr = boundAlloc( 1 );
+  HOST_CHECK( ptr != NULL );
+  HOST_CHECK( boundAlloc( MAXMEMHEAP ) == NULL );
+  osal_mem_free( ptr );
+
+  for ( idx = 0; idx < cnt; idx++ )
+  {
+    osal_mem_free( fill[idx] );
+  }
+
+  // 4 blocks of one class and 1 of the class of 2 of them merged with the 24 bytes between,
+  // each kept apart by a block in use.
+  for ( idx = 0; idx < 10; idx++ )
+  {
+    blk[idx] = osal_mem_alloc( ((idx & 1) != 0) ? 24 : ((idx == 8) ? 130 : 40) );
+    HOST_CHECK( blk[idx] != NULL );
+  }
+  cnt = boundFill( fill );
+
+  // The lists: 0 - 2 - 4 - 6 and 8. With 0 taken off, 2 is the head.
+  for ( idx = 0; idx < 10; idx += 2 )
+  {
+    osal_mem_free( blk[8 - idx] );
+  }
+  boundFree( blk[1] );
+
+  for ( idx = 3; idx < 10; idx += 2 )
+  {
+    osal_mem_free( blk[idx] );
+  }
+  for ( idx = 0; idx < cnt; idx++ )
+  {
+    osal_mem_free( fill[idx] );
+  }
+}
+#endif
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Report the worst case per fragmentation level and check the TLSF and
+ *              segregated-fit bounds.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+#if ( OSALMEM_ALLOCATOR != OSALMEM_ALLOC_FIRSTFIT )
+  unsigned long baseAlloc = 0;
+  unsigned long baseFree = 0;
+#endif
+  unsigned long seed;
+  byte lvl;
+
+  osal_mem_init();
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+  maxAlloc = maxFree = 0;
+  boundWorst();
+  baseAlloc = maxAlloc;
+  baseFree = maxFree;
+  printf( "%-9s worst path:  alloc %lu, free %lu instr\n", allocName[OSALMEM_ALLOCATOR],
+          baseAlloc, baseFree );
+#endif
+
+  printf( "%-9s live  free blocks  alloc max instr  free max instr\n",
+          allocName[OSALMEM_ALLOCATOR] );
+
+  for ( lvl = 0; lvl <= sizeof( liveLevel ); lvl++ )
+  {
+    maxAlloc = maxFree = 0;
+    maxFrag = 0;
+
+    if ( lvl < sizeof( liveLevel ) )
+    {
+      for ( seed = 1; seed <= BOUND_SEEDS; seed++ )
+      {
+        boundTrace( seed, liveLevel[lvl] );
+      }
+      printf( "%-9s %4u  %11u  %15lu  %14lu\n", allocName[OSALMEM_ALLOCATOR],
+              liveLevel[lvl], maxFrag, maxAlloc, maxFree );
+    }
+    else
+    {
+      boundComb();
+      printf( "%-9s comb  %11u  %15lu  %14lu\n", allocName[OSALMEM_ALLOCATOR],
+              maxFrag, maxAlloc, maxFree );
+    }
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_TLSF )
+    if ( lvl == 0 )
+    {
+      baseAlloc = maxAlloc;
+      baseFree = maxFree;
+    }
+    else
+    {
+      HOST_CHECK( maxAlloc <= baseAlloc );
+      HOST_CHECK( maxFree <= baseFree );
+    }
+#elif ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+    HOST_CHECK( maxAlloc <= baseAlloc );
+    HOST_CHECK( maxFree <= baseFree );
+#endif
+  }
+
+  return HOST_RESULT( "test_mem_bound" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,485 @@
+/**************************************************************************************************
+    Filename:       test_mem_irq.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The heap against interrupts, built once per allocator as the MSA
+    build has it, with OSALMEM_OWNERS, and with OSALMEM_IRQOFF_STATS
+    timing every interrupt-disabled window in instructions.
+
+    An interrupt that allocates or frees is taken at each critical
+    section of an allocation and of a free in turn; the heap must come
+    back whole and a task quota must hold. Then random traces with more
+    and more blocks live, and a heap cut into the most free fragments it
+    holds, report the longest window of each call site. The windows of
+    TLSF and of the first-fit walk must stop growing once a few blocks
+    are live. The segregated fit looks only at list heads: its longest
+    windows are built on purpose first, and no trace may exceed them.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OSAL_Tasks.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define IRQ_STEPS   2000   // Operations per trace.
+#define LIVE_MAX    128    // Most blocks live at once.
+
+#define TASK_MSA    2
+#define TASK_MAC    1
+
+static const char *allocName[] = { "first-fit", "segfit", "tlsf" };
+static const char *siteName[OSALMEM_IRQ_SITES] = { "alloc", "large", "free", "other" };
+static const byte liveLevel[] = { 4, 32, LIVE_MAX };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static void *live[LIVE_MAX];
+static void *isrPtr;
+static uint16 isrSize;
+static uint16 fresh;
+
+
+/**************************************************************************************************
+ * @fn          isrAlloc, isrFree
+ *
+ * @brief       Interrupts that allocate isrSize bytes into isrPtr, or free isrPtr.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void isrAlloc( void )
+{
+  isrPtr = osal_mem_alloc( isrSize );
+}
+
+static void isrFree( void )
+{
+  osal_mem_free( isrPtr );
+  isrPtr = NULL;
+}
+
+
+/**************************************************************************************************
+ * @fn          irqWhole
+ *
+ * @brief       Check that the heap is whole again: with every block freed, the largest request
+ *              that succeeds is the one a fresh heap serves.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void irqWhole( void )
+{
+  HOST_CHECK( host_mem_largest() == fresh );
+#if ( OSALMEM_METRICS )
+  HOST_CHECK( osal_heap_mem_used() == 0 );
+#endif
+}
+
+
+/**************************************************************************************************
+ * @fn          testAllocRace
+ *
+ * @brief       Take a small block out of a large free one while an interrupt frees the block
+ *              that follows it, and free a block while an interrupt allocates.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testAllocRace( void )
+{
+  uint16 skip;
+  byte kind;
+
+  for ( kind = 0; kind < 2; kind++ )
+  {
+    for ( skip = 0; ; skip++ )
+    {
+      void *big, *mid, *rest, *ptr;
+      byte taken;
+
+      osal_mem_init();
+      big = osal_mem_alloc( 200 );
+      mid = osal_mem_alloc( 24 );
+      rest = osal_mem_alloc( 40 );
+
+      hostIsrSkip = skip;
+      if ( kind == 0 )
+      {
+        // Split the free block ahead of 'mid' while 'mid' is freed.
+        osal_mem_free( big );
+        isrPtr = mid;
+        hostIsr = isrFree;
+        ptr = osal_mem_alloc( 16 );
+      }
+      else
+      {
+        // Free 'mid', merging with both neighbours, while a block is allocated.
+        osal_mem_free( big );
+        osal_mem_free( rest );
+        isrSize = 16;
+        isrPtr = NULL;
+        hostIsr = isrAlloc;
+        osal_mem_free( mid );
+        ptr = isrPtr;
+      }
+      taken = (hostIsr == NULL);
+      hostIsr = NULL;
+
+      HOST_CHECK( (ptr != NULL) || ((kind == 1) && !taken) );
+      if ( ptr != NULL )
+      {
+        osal_mem_free( ptr );
+      }
+      if ( kind == 0 )
+      {
+        if ( isrPtr != NULL )
+        {
+          osal_mem_free( isrPtr );
+        }
+        osal_mem_free( rest );
+      }
+      irqWhole();
+
+      if ( !taken )
+      {
+        break;
+      }
+    }
+
+    HOST_CHECK( skip > 2 );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testQuotaRace
+ *
+ * @brief       MSA has room for one more block under its quota and asks for it, while the MAC
+ *              receive interrupt, still seeing MSA in osal_self(), asks for one too. At most
+ *              one of them may get it.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testQuotaRace( void )
+{
+  uint16 skip;
+
+  for ( skip = 0; ; skip++ )
+  {
+    void *first, *ptr;
+    byte taken;
+
+    osal_mem_init();
+    hostTask = TASK_MSA;
+    first = osal_mem_alloc( 40 );
+    osal_mem_set_quota( TASK_MSA, osal_mem_task_used( TASK_MSA ) + 50 );
+
+    isrSize = 40;
+    isrPtr = NULL;
+    hostIsrSkip = skip;
+    hostIsr = isrAlloc;
+    ptr = osal_mem_alloc( 40 );
+    taken = (hostIsr == NULL);
+    hostIsr = NULL;
+
+    HOST_CHECK( (ptr == NULL) || (isrPtr == NULL) );
+    HOST_CHECK( (ptr != NULL) || (isrPtr != NULL) );
+
+    if ( ptr != NULL )
+    {
+      osal_mem_free( ptr );
+    }
+    if ( isrPtr != NULL )
+    {
+      osal_mem_free( isrPtr );
+    }
+    osal_mem_free( first );
+    HOST_CHECK( osal_mem_task_used( TASK_MSA ) == 0 );
+    osal_mem_set_quota( TASK_MSA, 0 );
+
+    if ( !taken )
+    {
+      break;
+    }
+  }
+
+  HOST_CHECK( skip > 2 );
+  hostTask = TASK_NO_TASK;
+}
+
+
+/**************************************************************************************************
+ * @fn          irqStep
+ *
+ * @brief       Allocate into or free a slot, single-stepped so that OSALMEM_IRQOFF_NOW() counts
+ *              instructions.
+ *
+ * @param       idx - slot.
+ * @param       size - bytes to allocate if the slot is empty.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void irqStep( byte idx, uint16 size )
+{
+  host_steps_begin();
+  if ( live[idx] == NULL )
+  {
+    live[idx] = osal_mem_alloc( size );
+  }
+  else
+  {
+    osal_mem_free( live[idx] );
+    live[idx] = NULL;
+  }
+  host_steps_end();
+}
+
+
+/**************************************************************************************************
+ * @fn          irqLevel
+ *
+ * @brief       Run a random trace with up to 'slots' blocks live, or with 'slots' 0 fill the
+ *              heap with the smallest blocks and free every other one, then ask for blocks no
+ *              fragment fits and free the rest, each free merging with both neighbours.
+ *
+ * @param       slots - most blocks live at once; 0 for the comb.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void irqLevel( byte slots )
+{
+  static void *small[MAXMEMHEAP / 2];
+  uint16 cnt = 0;
+  uint16 idx;
+  long step;
+
+  osal_mem_init();
+
+  if ( slots != 0 )
+  {
+    host_srand( 7 );
+    for ( step = 0; step < IRQ_STEPS; step++ )
+    {
+      idx = (uint16)(host_rand() % slots);
+      irqStep( (byte)idx, (host_rand() % 8 == 0) ? (uint16)(1 + host_rand() % 200)
+                                                 : (uint16)(1 + host_rand() % 24) );
+    }
+
+    for ( idx = 0; idx < LIVE_MAX; idx++ )
+    {
+      if ( live[idx] != NULL )
+      {
+        osal_mem_free( live[idx] );
+        live[idx] = NULL;
+      }
+    }
+    return;
+  }
+
+  while ( (cnt < (MAXMEMHEAP / 2)) && ((small[cnt] = osal_mem_alloc( 1 )) != NULL) )
+  {
+    cnt++;
+  }
+  for ( idx = 0; idx < cnt; idx += 2 )
+  {
+    osal_mem_free( small[idx] );
+  }
+
+  irqStep( 0, 16 );
+  irqStep( 0, 16 );
+  irqStep( 0, MAXMEMHEAP / 4 );
+  if ( live[0] != NULL )
+  {
+    irqStep( 0, 0 );
+  }
+
+  for ( idx = 1; idx < cnt; idx += 2 )
+  {
+    live[0] = small[idx];
+    irqStep( 0, 0 );
+  }
+}
+
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+/**************************************************************************************************
+ * @fn          irqWorst
+ *
+ * @brief       Build the longest windows of the segregated fit, with the heap full and free
+ *              blocks kept apart by blocks in use: 4 of one class, at the head of a list with
+ *              more behind, and 1 of the class of 2 of them merged with the block between.
+ *              A request of that class takes the head; the smallest request takes it from a
+ *              larger class and splits it into the list; then the block between 2 of them is
+ *              freed, merging with both.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void irqWorst( void )
+{
+  static void *small[MAXMEMHEAP / 8];
+  void *blk[10];
+  uint16 cnt = 0;
+  uint16 idx;
+
+  osal_mem_init();
+
+  for ( idx = 0; idx < 10; idx++ )
+  {
+    blk[idx] = osal_mem_alloc( ((idx & 1) != 0) ? 24 : ((idx == 8) ? 150 : 50) );
+    HOST_CHECK( blk[idx] != NULL );
+  }
+  while ( (cnt < (MAXMEMHEAP / 8)) && ((small[cnt] = osal_mem_alloc( 24 )) != NULL) )
+  {
+    cnt++;
+  }
+  while ( (cnt < (MAXMEMHEAP / 8)) && ((small[cnt] = osal_mem_alloc( 1 )) != NULL) )
+  {
+    cnt++;
+  }
+
+  // The lists: 0 - 2 - 4 - 6 and 8.
+  for ( idx = 0; idx < 10; idx += 2 )
+  {
+    osal_mem_free( blk[8 - idx] );
+  }
+
+  irqStep( 0, 50 );
+  irqStep( 0, 0 );
+  irqStep( 0, 1 );
+  irqStep( 0, 0 );
+  live[0] = blk[1];
+  irqStep( 0, 0 );
+
+  for ( idx = 3; idx < 10; idx += 2 )
+  {
+    osal_mem_free( blk[idx] );
+  }
+  for ( idx = 0; idx < cnt; idx++ )
+  {
+    osal_mem_free( small[idx] );
+  }
+}
+#endif
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the interrupt tests and report the interrupt-off windows.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint16 base[OSALMEM_IRQ_SITES];
+  byte lvl;
+  byte site;
+
+  osal_mem_init();
+  fresh = host_mem_largest();
+
+  testAllocRace();
+  testQuotaRace();
+
+  // The windows are the longest seen so far, levels in order of fragmentation.
+  printf( "%-9s live ", allocName[OSALMEM_ALLOCATOR] );
+  for ( site = 0; site < OSALMEM_IRQ_SITES; site++ )
+  {
+    printf( " %6s", siteName[site] );
+  }
+  printf( "   max instr with interrupts off\n" );
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+  irqWorst();
+  printf( "%-9s worst", allocName[OSALMEM_ALLOCATOR] );
+  for ( site = 0; site < OSALMEM_IRQ_SITES; site++ )
+  {
+    base[site] = osal_mem_irqoff_max( site );
+    printf( " %6u", base[site] );
+  }
+  printf( "\n" );
+#endif
+
+  for ( lvl = 0; lvl <= sizeof( liveLevel ); lvl++ )
+  {
+    if ( lvl < sizeof( liveLevel ) )
+    {
+      irqLevel( liveLevel[lvl] );
+      printf( "%-9s %4u ", allocName[OSALMEM_ALLOCATOR], liveLevel[lvl] );
+    }
+    else
+    {
+      irqLevel( 0 );
+      printf( "%-9s comb ", allocName[OSALMEM_ALLOCATOR] );
+    }
+
+    for ( site = 0; site < OSALMEM_IRQ_SITES; site++ )
+    {
+      printf( " %6u", osal_mem_irqoff_max( site ) );
+    }
+    printf( "\n" );
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+    // Only list heads are looked at: no trace may make a longer window than the worst built.
+    HOST_CHECK( osal_mem_irqoff_max( OSALMEM_IRQ_ALLOC ) <= base[OSALMEM_IRQ_ALLOC] );
+    HOST_CHECK( osal_mem_irqoff_max( OSALMEM_IRQ_ALLOC_LARGE ) <= base[OSALMEM_IRQ_ALLOC_LARGE] );
+    HOST_CHECK( osal_mem_irqoff_max( OSALMEM_IRQ_FREE ) <= base[OSALMEM_IRQ_FREE] );
+#else
+    // Past a few blocks live, the first-fit walk is cut at OSALMEM_FF_WALK blocks, and TLSF
+    // does not walk at all: more fragments must not make a longer window.
+    if ( lvl == 1 )
+    {
+      for ( site = 0; site < OSALMEM_IRQ_SITES; site++ )
+      {
+        base[site] = osal_mem_irqoff_max( site );
+      }
+    }
+    else if ( lvl > 1 )
+    {
+      HOST_CHECK( osal_mem_irqoff_max( OSALMEM_IRQ_ALLOC ) <= base[OSALMEM_IRQ_ALLOC] );
+      HOST_CHECK( osal_mem_irqoff_max( OSALMEM_IRQ_FREE ) <= base[OSALMEM_IRQ_FREE] );
+    }
+#endif
+  }
+
+  return HOST_RESULT( "test_mem_irq" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,220 @@
+/**************************************************************************************************
+    Filename:       test_mem_owners.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Per-task heap accounting of OSALMEM_OWNERS with the message reserve,
+    as on the MSA build. The MSA task is run up to its quota; the MAC
+    receive interrupt that follows still sees it in osal_self(), since
+    the main loop leaves the last task active. Its receive buffer,
+    allocated as rxMemAlloc() does, must succeed and be charged to the
+    system account, not to the task.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define MSA_QUOTA   (MAXMEMHEAP / 2)
+#define MSA_BLOCK   24
+#define RX_LEN      40    // macRx_t and a short payload.
+
+#define LIVE_MAX    (MAXMEMHEAP / MSA_BLOCK)
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static byte msaTaskId;
+static void *held[LIVE_MAX];
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void msaInit( byte taskId )
+{
+  msaTaskId = taskId;
+}
+
+static uint16 msaEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( msaInit, msaEvents, OSAL_TASK_PRIORITY_LOW );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          rxAlloc
+ *
+ * @brief       Allocate a receive buffer the way mac_rx.c does from its interrupt.
+ *
+ * @param       len - buffer length.
+ *
+ * @return      Buffer or NULL.
+ **************************************************************************************************
+ */
+static byte *rxAlloc( uint16 len )
+{
+  byte *p;
+
+  osal_mem_system( TRUE );
+  osal_msg_reserve_arm( TRUE );
+  p = osal_msg_allocate( len );
+  osal_msg_reserve_arm( FALSE );
+  osal_mem_system( FALSE );
+
+  return p;
+}
+
+
+/**************************************************************************************************
+ * @fn          testRxAtQuota
+ *
+ * @brief       MSA at its quota: its own allocations are refused, a receive buffer is not.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRxAtQuota( void )
+{
+  uint16 used, denied;
+  uint16 cnt = 0;
+  byte *rx;
+
+  // The main loop ran MSA last; an interrupt now finds it in osal_self().
+  activeTask = osalTaskCtx.tasksHead;
+  HOST_CHECK( osal_self() == msaTaskId );
+
+  osal_mem_set_quota( msaTaskId, MSA_QUOTA );
+  while ( (cnt < LIVE_MAX) && ((held[cnt] = osal_mem_alloc( MSA_BLOCK )) != NULL) )
+  {
+    cnt++;
+  }
+  HOST_CHECK( cnt > 0 );
+  HOST_CHECK( cnt < LIVE_MAX );
+  HOST_CHECK( osal_mem_task_denied( msaTaskId ) == 1 );
+
+  used = osal_mem_task_used( msaTaskId );
+  denied = osal_mem_task_denied( msaTaskId );
+  HOST_CHECK( used <= MSA_QUOTA );
+  HOST_CHECK( osal_msg_allocate( MSA_BLOCK ) == NULL );
+
+  rx = rxAlloc( RX_LEN );
+  HOST_CHECK( rx != NULL );
+  HOST_CHECK( osal_mem_owner( rx - sizeof( osal_msg_hdr_t ) ) == OSALMEM_OWNER_SYSTEM );
+  HOST_CHECK( osal_mem_task_used( OSALMEM_OWNER_SYSTEM ) > RX_LEN );
+  HOST_CHECK( osal_mem_task_used( msaTaskId ) == used );
+  HOST_CHECK( osal_mem_task_denied( msaTaskId ) == denied + 1 );
+  HOST_CHECK( osal_mem_task_denied( OSALMEM_OWNER_SYSTEM ) == 0 );
+
+  // The bracket is closed: the task is refused again.
+  HOST_CHECK( osal_mem_alloc( MSA_BLOCK ) == NULL );
+
+  // Delivered to MSA, the buffer becomes MSA's.
+  HOST_CHECK( osal_msg_send( msaTaskId, rx ) == ZSUCCESS );
+  HOST_CHECK( osal_mem_task_used( OSALMEM_OWNER_SYSTEM ) == 0 );
+  HOST_CHECK( osal_mem_task_used( msaTaskId ) > used );
+  HOST_CHECK( osal_msg_deallocate( osal_msg_receive( msaTaskId ) ) == ZSUCCESS );
+  HOST_CHECK( osal_mem_task_used( msaTaskId ) == used );
+
+  while ( cnt != 0 )
+  {
+    osal_mem_free( held[--cnt] );
+  }
+  HOST_CHECK( osal_mem_task_used( msaTaskId ) == 0 );
+  osal_mem_set_quota( msaTaskId, 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testSystemBracket
+ *
+ * @brief       Brackets nest, a quota cannot be put on the system, and an extra close is
+ *              harmless.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testSystemBracket( void )
+{
+  void *a, *b;
+
+  osal_mem_set_quota( OSALMEM_OWNER_SYSTEM, 1 );
+
+  osal_mem_system( TRUE );
+  osal_mem_system( TRUE );
+  a = osal_mem_alloc( 8 );
+  osal_mem_system( FALSE );
+  b = osal_mem_alloc( 8 );
+  osal_mem_system( FALSE );
+  osal_mem_system( FALSE );
+
+  HOST_CHECK( (a != NULL) && (b != NULL) );
+  HOST_CHECK( osal_mem_owner( a ) == OSALMEM_OWNER_SYSTEM );
+  HOST_CHECK( osal_mem_owner( b ) == OSALMEM_OWNER_SYSTEM );
+
+  a = osal_mem_realloc( a, 64 );
+  HOST_CHECK( a != NULL );
+  HOST_CHECK( osal_mem_owner( a ) == OSALMEM_OWNER_SYSTEM );
+
+  osal_mem_free( a );
+  osal_mem_free( b );
+  HOST_CHECK( osal_mem_task_used( OSALMEM_OWNER_SYSTEM ) == 0 );
+
+  a = osal_mem_alloc( 8 );
+  HOST_CHECK( osal_mem_owner( a ) == osal_self() );
+  osal_mem_free( a );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the ownership tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  osal_init_system();
+
+  testRxAtQuota();
+  testSystemBracket();
+
+  return HOST_RESULT( "test_mem_owners" );
+}
+
+
+/**************************************************************************************************
+*/
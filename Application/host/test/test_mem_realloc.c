@@ -0,0 +1,362 @@
+/**************************************************************************************************
+    Filename:       test_mem_realloc.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    osal_mem_realloc(), built once per OSALMEM_ALLOCATOR with
+    OSALMEM_OWNERS as the MSA build has it: a NULL block, a block that
+    grows in place, one that must move, a request the heap cannot serve
+    and one over the owner's quota, both of which leave the old block as
+    it was, and a UART frame appended to a few bytes at a time the way
+    Msa_Uart_Append() does. The contents must survive every step, the
+    owner must keep the block and be charged exactly what it holds, and
+    the heap must come back whole.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OSAL_Tasks.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TASK_MSA     2
+#define FRAME_LEN    128   // MSA_PACKET_LENGTH.
+#define CHUNK_MAX    16    // Most bytes read off the UART per append.
+#define FRAMES       200   // Frames appended by testAppend().
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static uint16 fresh;
+
+
+/**************************************************************************************************
+ * @fn          fill, intact
+ *
+ * @brief       Write a pattern to the first 'len' bytes of a block, or check that it is there.
+ *
+ * @param       ptr - block.
+ * @param       len - bytes.
+ * @param       tag - start of the pattern.
+ *
+ * @return      intact() returns TRUE if the pattern is unchanged.
+ **************************************************************************************************
+ */
+static void fill( byte *ptr, uint16 len, byte tag )
+{
+  while ( len-- != 0 )
+  {
+    *ptr++ = tag++;
+  }
+}
+
+static byte intact( const byte *ptr, uint16 len, byte tag )
+{
+  while ( len-- != 0 )
+  {
+    if ( *ptr++ != tag++ )
+    {
+      return FALSE;
+    }
+  }
+  return TRUE;
+}
+
+
+/**************************************************************************************************
+ * @fn          heapWhole
+ *
+ * @brief       Check that with every block freed the heap and the owner accounts are back to
+ *              those of a fresh heap.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void heapWhole( void )
+{
+  HOST_CHECK( host_mem_largest() == fresh );
+  HOST_CHECK( osal_heap_mem_used() == 0 );
+  HOST_CHECK( osal_mem_task_used( TASK_MSA ) == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testNull
+ *
+ * @brief       A NULL block is a plain allocation, charged to the running task.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testNull( void )
+{
+  byte *ptr;
+
+  osal_mem_init();
+  ptr = osal_mem_realloc( NULL, 20 );
+  HOST_CHECK( ptr != NULL );
+  HOST_CHECK( osal_mem_owner( ptr ) == TASK_MSA );
+  HOST_CHECK( osal_mem_task_used( TASK_MSA ) != 0 );
+
+  osal_mem_free( ptr );
+  heapWhole();
+}
+
+
+/**************************************************************************************************
+ * @fn          testInPlace
+ *
+ * @brief       The last block taken from a fresh heap has free memory behind it on every
+ *              allocator: it grows where it is, and asking for less keeps it as it is.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testInPlace( void )
+{
+  byte *ptr, *grown;
+  uint16 used;
+
+  osal_mem_init();
+  ptr = osal_mem_alloc( 40 );
+  HOST_CHECK( ptr != NULL );
+  fill( ptr, 40, 0x10 );
+
+  grown = osal_mem_realloc( ptr, 100 );
+  HOST_CHECK( grown == ptr );
+  HOST_CHECK( intact( grown, 40, 0x10 ) );
+  HOST_CHECK( osal_mem_owner( grown ) == TASK_MSA );
+  // The owner is charged for the whole grown block, header included.
+  HOST_CHECK( osal_mem_task_used( TASK_MSA ) > 100 );
+  fill( grown, 100, 0x20 );
+
+  used = osal_mem_task_used( TASK_MSA );
+  HOST_CHECK( osal_mem_realloc( grown, 30 ) == grown );
+  HOST_CHECK( intact( grown, 100, 0x20 ) );
+  HOST_CHECK( osal_mem_task_used( TASK_MSA ) == used );
+
+  osal_mem_free( grown );
+  heapWhole();
+}
+
+
+/**************************************************************************************************
+ * @fn          testMove
+ *
+ * @brief       A block with a live block right behind it moves: the contents and the owner go
+ *              with it, the old block is freed, and the owner is charged for the new one only.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testMove( void )
+{
+  byte *ptr, *wall, *moved;
+  uint16 used;
+
+  osal_mem_init();
+  ptr = osal_mem_alloc( 40 );
+  fill( ptr, 40, 0x30 );
+  hostTask = TASK_NO_TASK;
+  wall = osal_mem_alloc( 40 );
+  hostTask = TASK_MSA;
+  HOST_CHECK( (ptr != NULL) && (wall != NULL) );
+  used = osal_mem_task_used( TASK_MSA );
+
+  moved = osal_mem_realloc( ptr, 100 );
+  HOST_CHECK( (moved != NULL) && (moved != ptr) );
+  HOST_CHECK( intact( moved, 40, 0x30 ) );
+  HOST_CHECK( osal_mem_owner( moved ) == TASK_MSA );
+  HOST_CHECK( osal_mem_task_used( TASK_MSA ) > used );
+
+  osal_mem_free( wall );
+  osal_mem_free( moved );
+  heapWhole();
+}
+
+
+/**************************************************************************************************
+ * @fn          testFail
+ *
+ * @brief       A request the heap cannot serve, and one past the owner's quota, fail and leave
+ *              the old block where it was, with its contents and its charge.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testFail( void )
+{
+  byte *ptr;
+  uint16 used;
+
+  osal_mem_init();
+  ptr = osal_mem_alloc( 40 );
+  HOST_CHECK( ptr != NULL );
+  fill( ptr, 40, 0x40 );
+  used = osal_mem_task_used( TASK_MSA );
+
+  HOST_CHECK( osal_mem_realloc( ptr, MAXMEMHEAP ) == NULL );
+  HOST_CHECK( intact( ptr, 40, 0x40 ) );
+  HOST_CHECK( osal_mem_task_used( TASK_MSA ) == used );
+
+  osal_mem_set_quota( TASK_MSA, used + 20 );
+  HOST_CHECK( osal_mem_realloc( ptr, 100 ) == NULL );
+  HOST_CHECK( intact( ptr, 40, 0x40 ) );
+  HOST_CHECK( osal_mem_task_used( TASK_MSA ) == used );
+  HOST_CHECK( osal_mem_task_denied( TASK_MSA ) != 0 );
+
+  // Within the quota the block still grows.
+  ptr = osal_mem_realloc( ptr, 50 );
+  HOST_CHECK( (ptr != NULL) && intact( ptr, 40, 0x40 ) );
+  HOST_CHECK( osal_mem_task_used( TASK_MSA ) <= (used + 20) );
+  osal_mem_set_quota( TASK_MSA, 0 );
+
+  osal_mem_free( ptr );
+  heapWhole();
+}
+
+
+/**************************************************************************************************
+ * @fn          testAppend
+ *
+ * @brief       UART frames built a chunk at a time, as Msa_Uart_Append() does, while other
+ *              tasks allocate and free around them. Every frame must come out whole, and the
+ *              owner charge must follow the frame as it grows and moves.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testAppend( void )
+{
+  static byte *other[8];
+  uint16 frame;
+  uint16 moves = 0;
+  byte idx;
+
+  osal_mem_init();
+  host_srand( 5 );
+
+  for ( frame = 0; frame < FRAMES; frame++ )
+  {
+    byte *buf = NULL;
+    uint16 len = 0;
+    byte tag = (byte)frame;
+
+    while ( len < FRAME_LEN )
+    {
+      uint16 chunk = (uint16)(1 + host_rand() % CHUNK_MAX);
+      byte *grown;
+
+      if ( chunk > (FRAME_LEN - len) )
+      {
+        chunk = FRAME_LEN - len;
+      }
+
+      // MAC traffic of another task between two UART reads.
+      idx = (byte)(host_rand() % 8);
+      hostTask = TASK_NO_TASK;
+      if ( other[idx] == NULL )
+      {
+        other[idx] = osal_mem_alloc( (uint16)(8 + host_rand() % 40) );
+      }
+      else
+      {
+        osal_mem_free( other[idx] );
+        other[idx] = NULL;
+      }
+      hostTask = TASK_MSA;
+
+      grown = osal_mem_realloc( buf, len + chunk );
+      HOST_CHECK( grown != NULL );
+      if ( grown == NULL )
+      {
+        break;
+      }
+      if ( (buf != NULL) && (grown != buf) )
+      {
+        moves++;
+      }
+      buf = grown;
+
+      fill( buf + len, chunk, (byte)(tag + len) );
+      len += chunk;
+      HOST_CHECK( osal_mem_owner( buf ) == TASK_MSA );
+    }
+
+    HOST_CHECK( intact( buf, len, tag ) );
+    HOST_CHECK( osal_mem_task_used( TASK_MSA ) >= len );
+    osal_mem_free( buf );
+    HOST_CHECK( osal_mem_task_used( TASK_MSA ) == 0 );
+  }
+
+  // With other blocks coming and going some frames must move.
+  HOST_CHECK( moves != 0 );
+
+  for ( idx = 0; idx < 8; idx++ )
+  {
+    if ( other[idx] != NULL )
+    {
+      osal_mem_free( other[idx] );
+      other[idx] = NULL;
+    }
+  }
+  heapWhole();
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the realloc tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  osal_mem_init();
+  fresh = host_mem_largest();
+  hostTask = TASK_MSA;
+
+  testNull();
+  testInPlace();
+  testMove();
+  testFail();
+  testAppend();
+
+  hostTask = TASK_NO_TASK;
+
+  return HOST_RESULT( "test_mem_realloc" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,583 @@
+/**************************************************************************************************
+    Filename:       test_mem_scratch.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The scratch arena, built with OSALMEM_SCRATCH and a 16-bit
+    halDataAlign_t, on the 3 tasks of msa_Osal.c. Marks must nest, a
+    release past the arena top change nothing, a request the arena
+    cannot hold return NULL and leave it as it was, and every buffer be
+    aligned and clear of the one before it. A handler that does not
+    release its buffers must find the arena empty at its next call from
+    osal_start_system().
+
+    Then frames are forwarded as msa.c does on MAC_MCPS_DATA_IND: the
+    MAC task sends each one in a message, and the MSA task copies it
+    into a buffer that lives until HalUARTWrite() has taken it, from the
+    arena, or from the heap when built without OSALMEM_SCRATCH.
+    osal_mem_alloc() and osal_mem_free() are wrapped, and the heap calls
+    per forwarded frame are reported and checked for both builds. With
+    most of the arena held by the handler, frames it cannot hold must
+    still be forwarded, from the heap; with the heap full as well, they
+    must be counted as dropped.
+
+    The HAL poll hook leaves the main loop by longjmp() once every task
+    is idle.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include <setjmp.h>
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_HAL      0
+#define TEST_MAC      1
+#define TEST_MSA      2
+#define TEST_FRAMES   1000     // Frames forwarded.
+#define TEST_FRAME    100      // Longest frame, in bytes.
+#define TEST_PASSES   10000L   // Main loop passes per run, at most.
+
+#define EVT_LEAK      0x0001   // HAL task: take scratch buffers and keep them.
+#define EVT_RADIO     0x0001   // MAC task: a frame was received.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Typedefs
+ * ------------------------------------------------------------------------------------------------
+ */
+// A received frame, as the MAC task hands it over.
+typedef struct
+{
+  osal_event_hdr_t hdr;
+  uint8 len;
+  uint8 data[TEST_FRAME];
+} testFrame_t;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static jmp_buf loopExit;
+static long passes;
+static uint32 heapCalls;
+
+static uint16 leakCalls;
+static uint16 frameTag;      // Tag of the next frame received.
+static uint16 uartTag;       // Tag of the next frame due at the UART.
+static uint16 uartFrames;
+
+#if ( OSALMEM_SCRATCH )
+static uint16 msaHold;       // Arena bytes the MSA handler takes before the frames.
+static uint16 msaBig;        // Frames the arena could not hold.
+#endif
+static uint16 msaDrop;       // Frames not forwarded, as TxUARTDropHeap in msa.c.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Heap Call Counting
+ * ------------------------------------------------------------------------------------------------
+ */
+void *__real_osal_mem_alloc( uint16 size );
+void __real_osal_mem_free( void *ptr );
+
+void *__wrap_osal_mem_alloc( uint16 size )
+{
+  heapCalls++;
+  return __real_osal_mem_alloc( size );
+}
+
+void __wrap_osal_mem_free( void *ptr )
+{
+  heapCalls++;
+  __real_osal_mem_free( ptr );
+}
+
+
+/**************************************************************************************************
+ * @fn          uartWrite
+ *
+ * @brief       HalUARTWrite() stand-in: check that the frame arrived whole and in order.
+ *
+ * @param       buf - frame, tag in its first 2 bytes.
+ * @param       len - bytes.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void uartWrite( const uint8 *buf, uint8 len )
+{
+  uint8 idx;
+
+  HOST_CHECK( BUILD_UINT16( buf[0], buf[1] ) == uartTag );
+  for ( idx = 2; idx < len; idx++ )
+  {
+    HOST_CHECK( buf[idx] == (uint8)(uartTag + idx) );
+  }
+
+  uartTag++;
+  uartFrames++;
+}
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 halEvents( byte taskId, uint16 events )
+{
+#if ( OSALMEM_SCRATCH )
+  // Whatever the last call kept was released after it returned.
+  HOST_CHECK( osal_mem_scratch_mark() == 0 );
+  HOST_CHECK( osal_mem_scratch( 16 ) != NULL );
+  HOST_CHECK( osal_mem_scratch( 8 ) != NULL );
+  HOST_CHECK( osal_mem_scratch_mark() == 24 );
+#endif
+  leakCalls++;
+
+  return 0;
+}
+
+static uint16 macEvents( byte taskId, uint16 events )
+{
+  uint8 len = (uint8)(2 + host_rand() % (TEST_FRAME - 1));
+  testFrame_t *frame;
+  uint8 idx;
+
+  frame = (testFrame_t *)osal_msg_allocate( sizeof( testFrame_t ) );
+  HOST_CHECK( frame != NULL );
+  if ( frame != NULL )
+  {
+    frame->hdr.event = 0;
+    frame->len = len;
+    frame->data[0] = LO_UINT16( frameTag );
+    frame->data[1] = HI_UINT16( frameTag );
+    for ( idx = 2; idx < len; idx++ )
+    {
+      frame->data[idx] = (uint8)(frameTag + idx);
+    }
+    frameTag++;
+
+    osal_msg_send( TEST_MSA, (uint8 *)frame );
+  }
+
+  return 0;
+}
+
+static uint16 msaEvents( byte taskId, uint16 events )
+{
+  testFrame_t *frame;
+  uint8 *buf;
+#if ( OSALMEM_SCRATCH )
+  uint16 mark;
+  bool fromScratch;
+
+  if ( msaHold != 0 )
+  {
+    HOST_CHECK( osal_mem_scratch( msaHold ) != NULL );
+  }
+#endif
+
+  while ( (frame = (testFrame_t *)osal_msg_receive( taskId )) != NULL )
+  {
+    // Only needed until the UART has copied it, as in msa.c.
+#if ( OSALMEM_SCRATCH )
+    mark = osal_mem_scratch_mark();
+    buf = (uint8 *)osal_mem_scratch( frame->len );
+    fromScratch = (buf != NULL);
+    if ( !fromScratch )
+    {
+      msaBig++;
+      buf = (uint8 *)osal_mem_alloc( frame->len );
+    }
+#else
+    buf = (uint8 *)osal_mem_alloc( frame->len );
+#endif
+
+    if ( buf != NULL )
+    {
+      osal_memcpy( buf, frame->data, frame->len );
+      uartWrite( buf, frame->len );
+#if ( OSALMEM_SCRATCH )
+      if ( fromScratch )
+        osal_mem_scratch_release( mark );
+      else
+        osal_mem_free( buf );
+#else
+      osal_mem_free( buf );
+#endif
+    }
+    else
+    {
+      msaDrop++;
+      uartTag++;
+    }
+
+    osal_msg_deallocate( (uint8 *)frame );
+  }
+
+  return ( events ^ SYS_EVENT_MSG );
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, halEvents, OSAL_TASK_PRIORITY_LOW );
+  osalTaskAdd( appInit, macEvents, OSAL_TASK_PRIORITY_HIGH );
+  osalTaskAdd( appInit, msaEvents, OSAL_TASK_PRIORITY_MED );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          pollHook
+ *
+ * @brief       Top of each main loop pass: leave the loop once every task is idle.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void pollHook( void )
+{
+  if ( OSAL_TASKS_IDLE() || (++passes >= TEST_PASSES) )
+  {
+    longjmp( loopExit, 1 );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          runLoop
+ *
+ * @brief       Run the main loop until every task is idle.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void runLoop( void )
+{
+  passes = 0;
+  if ( setjmp( loopExit ) == 0 )
+  {
+    osal_start_system();
+  }
+
+  HOST_CHECK( OSAL_TASKS_IDLE() );
+}
+
+
+#if ( OSALMEM_SCRATCH )
+/**************************************************************************************************
+ * @fn          testNesting
+ *
+ * @brief       An inner scope released gives its bytes back to the next buffer; releasing the
+ *              outer scope also drops the inner one, and a stale inner mark then does nothing.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testNesting( void )
+{
+  uint16 outer, inner;
+  uint8 *a, *b, *c;
+
+  osal_mem_scratch_release( 0 );
+
+  outer = osal_mem_scratch_mark();
+  a = osal_mem_scratch( 10 );
+  inner = osal_mem_scratch_mark();
+  b = osal_mem_scratch( 20 );
+  c = osal_mem_scratch( 3 );
+  HOST_CHECK( (a != NULL) && (b != NULL) && (c != NULL) );
+  HOST_CHECK( inner > outer );
+  HOST_CHECK( osal_mem_scratch_mark() > inner );
+
+  osal_mem_scratch_release( inner );
+  HOST_CHECK( osal_mem_scratch_mark() == inner );
+  HOST_CHECK( osal_mem_scratch( 5 ) == b );
+
+  osal_mem_scratch_release( outer );
+  HOST_CHECK( osal_mem_scratch_mark() == outer );
+  osal_mem_scratch_release( inner );
+  HOST_CHECK( osal_mem_scratch_mark() == outer );
+  HOST_CHECK( osal_mem_scratch( 1 ) == a );
+
+  osal_mem_scratch_release( 0 );
+  HOST_CHECK( osal_mem_scratch_mark() == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testFull
+ *
+ * @brief       A request the arena cannot hold returns NULL and leaves it as it was.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testFull( void )
+{
+  uint16 mark;
+
+  osal_mem_scratch_release( 0 );
+  HOST_CHECK( osal_mem_scratch( OSALMEM_SCRATCH_LEN + 1 ) == NULL );
+  HOST_CHECK( osal_mem_scratch_mark() == 0 );
+
+  HOST_CHECK( osal_mem_scratch( OSALMEM_SCRATCH_LEN ) != NULL );
+  HOST_CHECK( osal_mem_scratch( 1 ) == NULL );
+  HOST_CHECK( osal_mem_scratch_mark() == OSALMEM_SCRATCH_LEN );
+
+  // One byte short of full is rounded up to full.
+  osal_mem_scratch_release( 0 );
+  HOST_CHECK( osal_mem_scratch( OSALMEM_SCRATCH_LEN - 1 ) != NULL );
+  HOST_CHECK( osal_mem_scratch( 1 ) == NULL );
+
+  osal_mem_scratch_release( 0 );
+  HOST_CHECK( osal_mem_scratch( OSALMEM_SCRATCH_LEN / 2 ) != NULL );
+  mark = osal_mem_scratch_mark();
+  HOST_CHECK( osal_mem_scratch( OSALMEM_SCRATCH_LEN / 2 + 1 ) == NULL );
+  HOST_CHECK( osal_mem_scratch_mark() == mark );
+
+#if ( OSALMEM_METRICS )
+  HOST_CHECK( osal_heap_scratch_max() == OSALMEM_SCRATCH_LEN );
+#endif
+  osal_mem_scratch_release( 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testAlign
+ *
+ * @brief       Buffers of every odd size are aligned to halDataAlign_t and clear of the one
+ *              before them.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testAlign( void )
+{
+  uint8 *prev = NULL;
+  uint8 *ptr;
+  uint16 size;
+  uint16 prevSize = 0;
+
+  HOST_CHECK( sizeof( halDataAlign_t ) == 2 );
+  osal_mem_scratch_release( 0 );
+
+  for ( size = 1; (ptr = osal_mem_scratch( size )) != NULL; size++ )
+  {
+    HOST_CHECK( ((size_t)ptr % sizeof( halDataAlign_t )) == 0 );
+    HOST_CHECK( (prev == NULL) || (ptr >= (prev + prevSize)) );
+    osal_memset( ptr, 0xA5, size );
+    prev = ptr;
+    prevSize = size;
+  }
+  HOST_CHECK( size > 8 );
+
+  osal_mem_scratch_release( 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testHandlerReset
+ *
+ * @brief       A handler that keeps its scratch buffers finds the arena empty at its next call.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testHandlerReset( void )
+{
+  byte idx;
+
+  leakCalls = 0;
+  for ( idx = 0; idx < 4; idx++ )
+  {
+    osal_set_event( TEST_HAL, EVT_LEAK );
+    runLoop();
+  }
+
+  HOST_CHECK( leakCalls == 4 );
+  HOST_CHECK( osal_mem_scratch_mark() == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testForwardHeld
+ *
+ * @brief       With all but 32 bytes of the arena held by the MSA handler, longer frames are
+ *              forwarded from the heap; with the heap full as well, they are counted as dropped
+ *              and the shorter ones still forwarded.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testForwardHeld( void )
+{
+  static void *fill[MAXMEMHEAP / 4];
+  uint16 used = osal_heap_mem_used();
+  uint16 sent = frameTag;
+  uint16 frames = uartFrames;
+  uint16 cnt;
+  uint16 idx;
+
+  host_srand( 12 );
+  msaHold = OSALMEM_SCRATCH_LEN - 32;
+  msaBig = 0;
+  heapCalls = 0;
+
+  for ( cnt = 0; cnt < TEST_FRAMES / 10; cnt++ )
+  {
+    osal_set_event( TEST_MAC, EVT_RADIO );
+    runLoop();
+  }
+
+  HOST_CHECK( msaBig > 0 );
+  HOST_CHECK( msaDrop == 0 );
+  HOST_CHECK( uartFrames - frames == frameTag - sent );
+  HOST_CHECK( heapCalls == 2UL * (frameTag - sent) + 2UL * msaBig );
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  // Leave the heap room for the frame messages only.
+  for ( cnt = 0; (cnt < MAXMEMHEAP / 4) && ((fill[cnt] = osal_mem_alloc( 1 )) != NULL); cnt++ )
+  {
+  }
+  for ( idx = 0; idx < (sizeof( testFrame_t ) + 32) / 4; idx++ )
+  {
+    osal_mem_free( fill[--cnt] );
+  }
+
+  sent = frameTag;
+  frames = uartFrames;
+  msaBig = 0;
+
+  for ( idx = 0; idx < TEST_FRAMES / 10; idx++ )
+  {
+    osal_set_event( TEST_MAC, EVT_RADIO );
+    runLoop();
+  }
+
+  HOST_CHECK( msaDrop > 0 );
+  HOST_CHECK( msaDrop == msaBig );
+  HOST_CHECK( uartFrames - frames + msaDrop == frameTag - sent );
+  HOST_CHECK( uartTag == frameTag );
+
+  while ( cnt != 0 )
+  {
+    osal_mem_free( fill[--cnt] );
+  }
+  HOST_CHECK( osal_heap_mem_used() == used );
+  msaHold = 0;
+  msaDrop = 0;
+}
+#endif
+
+
+/**************************************************************************************************
+ * @fn          testForward
+ *
+ * @brief       Forward frames from the MAC task to the UART through the MSA task and count the
+ *              heap calls.
+ *
+ * @param       none
+ *
+ * @return      Heap calls per frame.
+ **************************************************************************************************
+ */
+static uint32 testForward( void )
+{
+  uint16 used = osal_heap_mem_used();
+  uint16 cnt;
+
+  host_srand( 11 );
+  heapCalls = 0;
+
+  for ( cnt = 0; cnt < TEST_FRAMES; cnt++ )
+  {
+    osal_set_event( TEST_MAC, EVT_RADIO );
+    runLoop();
+  }
+
+  HOST_CHECK( uartFrames == TEST_FRAMES );
+  HOST_CHECK( uartTag == frameTag );
+  HOST_CHECK( msaDrop == 0 );
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  return ( heapCalls / TEST_FRAMES );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the scratch arena tests and report the heap calls per forwarded frame.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint32 calls;
+
+  osal_init_system();
+  hostPollHook = pollHook;
+
+#if ( OSALMEM_SCRATCH )
+  testNesting();
+  testFull();
+  testAlign();
+  testHandlerReset();
+#endif
+
+  calls = testForward();
+#if ( OSALMEM_SCRATCH )
+  testForwardHeld();
+#endif
+  printf( "%s: %lu heap calls per forwarded frame\n",
+          (OSALMEM_SCRATCH ? "scratch arena" : "heap buffer"), (unsigned long)calls );
+
+  // The message from the MAC task, and without the arena the UART buffer.
+  HOST_CHECK( calls == (OSALMEM_SCRATCH ? 2 : 4) );
+
+  return HOST_RESULT( "test_mem_scratch" );
+}
+
+
+/**************************************************************************************************
+*/
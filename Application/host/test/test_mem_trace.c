@@ -0,0 +1,268 @@
+/**************************************************************************************************
+    Filename:       test_mem_trace.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Heap trace of OSALMEM_TRACE: the record layout documented in
+    OSAL_Memory.h, the pairing of every free with its allocation by heap
+    offset, the LOST record when the ring overflows, and draining a ring
+    that wraps. Finally an MSA-like run is recorded, drained a record at
+    a time as osalMemTraceFlush() does, with application text mixed in
+    as on a shared UART port, into the capture file given on the command
+    line; the Makefile replays it with mem_replay.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define LIVE_MAX   16
+#define RUN_STEPS  20000L
+
+#define REC_KIND( rec )  ((rec)[0] & 0x0F)
+#define REC_U16( rec, i )  ((uint16)((rec)[i] | ((uint16)(rec)[(i) + 1] << 8)))
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static byte rec[OSALMEM_TRACE_BUFSZ];
+
+
+/**************************************************************************************************
+ * @fn          traceDrain
+ *
+ * @brief       Take every pending record out of the ring.
+ *
+ * @param       none
+ *
+ * @return      Number of bytes, copied to rec[].
+ **************************************************************************************************
+ */
+static uint16 traceDrain( void )
+{
+  uint16 cnt = 0;
+  uint16 len;
+  byte *buf;
+
+  for ( buf = osal_mem_trace_peek( &len ); len != 0; buf = osal_mem_trace_peek( &len ) )
+  {
+    HOST_CHECK( (len % OSALMEM_TRACE_RECSZ) == 0 );
+    memcpy( rec + cnt, buf, len );
+    cnt += len;
+    osal_mem_trace_consume( len );
+  }
+
+  return cnt;
+}
+
+
+/**************************************************************************************************
+ * @fn          testRecords
+ *
+ * @brief       One allocation, a failed one and a free give three records in heap order.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRecords( void )
+{
+  void *ptr;
+  uint16 off;
+
+  hostTask = 3;
+  hostClock = 0x12345;
+  ptr = osal_mem_alloc( 21 );
+  hostTask = 5;
+  hostClock++;
+  HOST_CHECK( osal_mem_alloc( MAXMEMHEAP ) == NULL );
+  osal_mem_free( ptr );
+
+  HOST_CHECK( traceDrain() == (3 * OSALMEM_TRACE_RECSZ) );
+
+  HOST_CHECK( rec[0] == (OSALMEM_TRACE_SYNC | OSALMEM_TRACE_ALOC) );
+  HOST_CHECK( rec[1] == 3 );
+  HOST_CHECK( REC_U16( rec, 2 ) == 21 );
+  HOST_CHECK( REC_U16( rec, 6 ) == 0x2345 );
+  off = REC_U16( rec, 4 );
+  HOST_CHECK( off < MAXMEMHEAP );
+
+  HOST_CHECK( REC_KIND( rec + 8 ) == OSALMEM_TRACE_FAIL );
+  HOST_CHECK( rec[9] == 5 );
+  HOST_CHECK( REC_U16( rec, 10 ) == MAXMEMHEAP );
+  HOST_CHECK( REC_U16( rec, 12 ) == 0xFFFF );
+  HOST_CHECK( REC_U16( rec, 14 ) == 0x2346 );
+
+  HOST_CHECK( REC_KIND( rec + 16 ) == OSALMEM_TRACE_FREE );
+  HOST_CHECK( REC_U16( rec, 20 ) == off );
+  HOST_CHECK( REC_U16( rec, 18 ) >= 21 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testLost
+ *
+ * @brief       Events past a full ring are dropped and counted in one LOST record, sent
+ *              ahead of the next event once there is room for both.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testLost( void )
+{
+  const uint16 recs = OSALMEM_TRACE_BUFSZ / OSALMEM_TRACE_RECSZ;
+  void *ptr[OSALMEM_TRACE_BUFSZ / OSALMEM_TRACE_RECSZ + 3];
+  uint16 len;
+  uint16 idx;
+
+  for ( idx = 0; idx < (recs + 3); idx++ )
+  {
+    ptr[idx] = osal_mem_alloc( 4 );
+  }
+
+  // Make room for the LOST record and one more event.
+  osal_mem_trace_peek( &len );
+  osal_mem_trace_consume( 2 * OSALMEM_TRACE_RECSZ );
+  osal_mem_free( ptr[0] );
+
+  len = traceDrain();
+  HOST_CHECK( len == OSALMEM_TRACE_BUFSZ );
+  HOST_CHECK( REC_KIND( rec + len - (2 * OSALMEM_TRACE_RECSZ) ) == OSALMEM_TRACE_LOST );
+  HOST_CHECK( REC_U16( rec, len - (2 * OSALMEM_TRACE_RECSZ) + 2 ) == 3 );
+  HOST_CHECK( REC_KIND( rec + len - OSALMEM_TRACE_RECSZ ) == OSALMEM_TRACE_FREE );
+
+  for ( idx = 1; idx < (recs + 3); idx++ )
+  {
+    osal_mem_free( ptr[idx] );
+  }
+  traceDrain();
+}
+
+
+/**************************************************************************************************
+ * @fn          testCapture
+ *
+ * @brief       Record an MSA-like run and write it as it would arrive from the UART.
+ *
+ * @param       name - capture file.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testCapture( const char *name )
+{
+  static void *live[LIVE_MAX];
+  static const char text[] = "Energy Detect Scan Active\r\n";
+  FILE *out = fopen( name, "wb" );
+  unsigned long recs = 0;
+  uint16 len;
+  byte *buf;
+  long step;
+  byte idx;
+
+  HOST_CHECK( out != NULL );
+  if ( out == NULL )
+  {
+    return;
+  }
+
+  host_srand( 11 );
+
+  for ( step = 0; step < RUN_STEPS; step++ )
+  {
+    idx = (byte)(host_rand() % LIVE_MAX);
+    hostTask = (byte)(host_rand() % 4);
+    hostClock++;
+
+    if ( live[idx] == NULL )
+    {
+      live[idx] = osal_mem_alloc( (host_rand() % 8 == 0) ? (uint16)(32 + host_rand() % 128)
+                                                         : (uint16)(4 + host_rand() % 60) );
+    }
+    else
+    {
+      osal_mem_free( live[idx] );
+      live[idx] = NULL;
+    }
+
+    // Drain now and then, a record per write, with the application talking in between.
+    if ( (step % 4) == 0 )
+    {
+      for ( buf = osal_mem_trace_peek( &len ); len != 0; buf = osal_mem_trace_peek( &len ) )
+      {
+        fwrite( buf, 1, OSALMEM_TRACE_RECSZ, out );
+        osal_mem_trace_consume( OSALMEM_TRACE_RECSZ );
+        recs++;
+      }
+      if ( (step % 256) == 0 )
+      {
+        fwrite( text, 1, sizeof( text ) - 1, out );
+      }
+    }
+  }
+
+  for ( idx = 0; idx < LIVE_MAX; idx++ )
+  {
+    if ( live[idx] != NULL )
+    {
+      osal_mem_free( live[idx] );
+      live[idx] = NULL;
+    }
+  }
+  len = traceDrain();
+  fwrite( rec, 1, len, out );
+  recs += len / OSALMEM_TRACE_RECSZ;
+
+  HOST_CHECK( recs > (RUN_STEPS / 2) );
+  fclose( out );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the trace tests.
+ *
+ * @param       argc - 2 to write a capture.
+ * @param       argv - capture file name in argv[1].
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( int argc, char **argv )
+{
+  osal_mem_init();
+  traceDrain();
+
+  testRecords();
+  testLost();
+
+  if ( argc > 1 )
+  {
+    testCapture( argv[1] );
+  }
+
+  return HOST_RESULT( "test_mem_trace" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,275 @@
+/**************************************************************************************************
+    Filename:       test_msg_budget.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Message budgets, built with OSAL_MSG_BUDGET and OSAL_DISPATCH_STATS
+    on the 3 tasks of msa_Osal.c. Floods of random size are sent to the
+    MSA task, whose handler drains its queue, taking a tick of the OSAL
+    clock per message, while the radio sets events on the higher
+    priority MAC task as interrupts would. With no budget and with
+    budgets of 1, 4 and 16 messages, the MSA task must receive its
+    messages in order, at most its budget per call, and be called again
+    with SYS_EVENT_MSG for the rest; the MAC task must never wait behind
+    more than a budget of messages, and its worst dispatch delay be the
+    one osal_dispatch_stats() keeps. The worst delays are printed.
+
+    The HAL poll hook leaves the main loop by longjmp() once every task
+    is idle.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include <setjmp.h>
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_HAL      0
+#define TEST_MAC      1
+#define TEST_MSA      2
+#define TEST_FLOOD    80       // Most messages of a flood.
+#define TEST_ROUNDS   200      // Floods per budget.
+#define TEST_PASSES   10000L   // Main loop passes per flood, at most.
+
+#define EVT_RADIO     0x0001
+
+static const byte testBudget[] = { 0, 1, 4, 16 };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static jmp_buf loopExit;
+static long passes;
+
+static byte budget;
+static uint16 sentTag;      // Tag of the next message sent.
+static uint16 recvTag;      // Tag of the next message due.
+static uint16 msaCalls;
+
+static byte macPending;
+static uint16 macSetAt;     // OSAL clock when the MAC event was set.
+static uint16 macWorst;     // Longest wait of the MAC task, in ticks.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 halEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+static uint16 macEvents( byte taskId, uint16 events )
+{
+  uint16 delay = (uint16)osal_GetSystemClock() - macSetAt;
+
+  HOST_CHECK( macPending && (events == EVT_RADIO) );
+  macPending = FALSE;
+
+  if ( macWorst < delay )
+    macWorst = delay;
+
+  return 0;
+}
+
+static uint16 msaEvents( byte taskId, uint16 events )
+{
+  uint16 *msg;
+  uint16 cnt = 0;
+
+  // The MAC task is never kept waiting by a lower priority task.
+  HOST_CHECK( !macPending );
+  HOST_CHECK( events == SYS_EVENT_MSG );
+  msaCalls++;
+
+  while ( (msg = (uint16 *)osal_msg_receive( taskId )) != NULL )
+  {
+    HOST_CHECK( *msg == recvTag );
+    recvTag++;
+    cnt++;
+    osal_msg_deallocate( (byte *)msg );
+
+    // A tick of work per message, with the radio going on meanwhile.
+    osal_update_timers();
+    if ( !macPending && ((host_rand() % 4) == 0) )
+    {
+      macPending = TRUE;
+      macSetAt = (uint16)osal_GetSystemClock();
+      osal_set_event( TEST_MAC, EVT_RADIO );
+    }
+  }
+
+  HOST_CHECK( (budget == 0) || (cnt <= budget) );
+  HOST_CHECK( (budget == 0) || (cnt == budget) || (recvTag == sentTag) );
+
+  return ( events ^ SYS_EVENT_MSG );
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, halEvents, OSAL_TASK_PRIORITY_LOW );
+  osalTaskAdd( appInit, macEvents, OSAL_TASK_PRIORITY_HIGH );
+  osalTaskAdd( appInit, msaEvents, OSAL_TASK_PRIORITY_MED );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          pollHook
+ *
+ * @brief       Top of each main loop pass: leave the loop once every task is idle.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void pollHook( void )
+{
+  if ( OSAL_TASKS_IDLE() || (++passes >= TEST_PASSES) )
+  {
+    longjmp( loopExit, 1 );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          flood
+ *
+ * @brief       Send a flood of 'cnt' messages to the MSA task and run the main loop until every
+ *              task is idle.
+ *
+ * @param       cnt - messages.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void flood( uint16 cnt )
+{
+  uint16 calls = msaCalls;
+  uint16 *msg;
+  uint16 idx;
+
+  for ( idx = 0; idx < cnt; idx++ )
+  {
+    msg = (uint16 *)osal_msg_allocate( sizeof( uint16 ) );
+    HOST_CHECK( msg != NULL );
+    if ( msg == NULL )
+      return;
+
+    *msg = sentTag++;
+    HOST_CHECK( osal_msg_send( TEST_MSA, (byte *)msg ) == ZSUCCESS );
+  }
+
+  passes = 0;
+  if ( setjmp( loopExit ) == 0 )
+  {
+    osal_start_system();
+  }
+
+  HOST_CHECK( OSAL_TASKS_IDLE() );
+  HOST_CHECK( recvTag == sentTag );
+  HOST_CHECK( osal_msg_q_stats( TEST_MSA )->depth == 0 );
+
+  // One call for each budget of messages.
+  if ( budget == 0 )
+    HOST_CHECK( msaCalls - calls == 1 );
+  else
+    HOST_CHECK( msaCalls - calls == (cnt + budget - 1) / budget );
+}
+
+
+/**************************************************************************************************
+ * @fn          testBudgetOf
+ *
+ * @brief       Run the floods with a budget of 'max' messages, or none, and return the worst wait
+ *              of the MAC task.
+ *
+ * @param       max - messages per call of the MSA handler, 0 for no limit.
+ *
+ * @return      Worst MAC dispatch delay, in ticks.
+ **************************************************************************************************
+ */
+static uint16 testBudgetOf( byte max )
+{
+  osalTaskRec_t *macTask = osalFindTask( TEST_MAC );
+  uint16 round;
+
+  budget = max;
+  HOST_CHECK( osal_msg_budget( TEST_MSA, max ) == ZSUCCESS );
+
+  host_srand( 25 );
+  macWorst = 0;
+  macTask->dispatch.worstDelay = 0;
+
+  for ( round = 0; round < TEST_ROUNDS; round++ )
+  {
+    flood( (uint16)(1 + host_rand() % TEST_FLOOD) );
+  }
+
+  HOST_CHECK( osal_dispatch_stats( TEST_MAC )->worstDelay == macWorst );
+  HOST_CHECK( (max == 0) || (macWorst < max) );
+
+  return ( macWorst );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the budget tests and print the worst MAC dispatch delays.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint16 worst[sizeof( testBudget )];
+  byte idx;
+
+  osal_init_system();
+  hostPollHook = pollHook;
+
+  HOST_CHECK( osal_msg_budget( OSAL_MAX_TASKS, 1 ) == INVALID_TASK );
+
+  for ( idx = 0; idx < sizeof( testBudget ); idx++ )
+  {
+    worst[idx] = testBudgetOf( testBudget[idx] );
+    printf( "budget %2u: worst MAC dispatch delay %2u ms\n", testBudget[idx], worst[idx] );
+  }
+
+  // Without a budget the MAC task waits behind most of a flood.
+  HOST_CHECK( worst[0] > TEST_FLOOD / 2 );
+  HOST_CHECK( osal_dispatch_stats( OSAL_MAX_TASKS ) == NULL );
+
+  return HOST_RESULT( "test_msg_budget" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,250 @@
+/**************************************************************************************************
+    Filename:       test_msg_pool.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Fixed-block message pools of osal_msg_allocate(): best-fit pool
+    selection, fallback to the heap when the pool is empty or the
+    message too long, the hit / miss / high-water counters, and the
+    checks of osal_msg_pool_add().
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define SMALL_LEN   8
+#define SMALL_CNT   4
+#define LARGE_LEN   40
+#define LARGE_CNT   2
+
+#define LIVE_MAX    32
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static byte poolSmall[OSAL_MSG_POOL_BUF_SIZE( SMALL_LEN, SMALL_CNT )];
+static byte poolLarge[OSAL_MSG_POOL_BUF_SIZE( LARGE_LEN, LARGE_CNT )];
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+void osalAddTasks( void )
+{
+}
+
+void osalAddMsgPools( void )
+{
+  osal_msg_pool_add( poolSmall, SMALL_LEN, SMALL_CNT );
+  osal_msg_pool_add( poolLarge, LARGE_LEN, LARGE_CNT );
+}
+
+
+/**************************************************************************************************
+ * @fn          inPool
+ *
+ * @brief       Find which pool a message was drawn from.
+ *
+ * @param       msg - message from osal_msg_allocate().
+ *
+ * @return      0 small pool, 1 large pool, 2 heap.
+ **************************************************************************************************
+ */
+static byte inPool( byte *msg )
+{
+  if ( (msg >= poolSmall) && (msg < (poolSmall + sizeof( poolSmall ))) )
+  {
+    return 0;
+  }
+  if ( (msg >= poolLarge) && (msg < (poolLarge + sizeof( poolLarge ))) )
+  {
+    return 1;
+  }
+  return 2;
+}
+
+
+/**************************************************************************************************
+ * @fn          testBestFit
+ *
+ * @brief       Messages come from the smallest pool that fits, then from the heap.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testBestFit( void )
+{
+  byte *small[SMALL_CNT + 1];
+  byte *msg;
+  byte i;
+
+  for ( i = 0; i < SMALL_CNT; i++ )
+  {
+    small[i] = osal_msg_allocate( (i & 1) ? 1 : SMALL_LEN );
+    HOST_CHECK( (small[i] != NULL) && (inPool( small[i] ) == 0) );
+  }
+  HOST_CHECK( osal_msg_pool_stats( 0 )->used == SMALL_CNT );
+  HOST_CHECK( osal_msg_pool_stats( 0 )->hit == SMALL_CNT );
+
+  // The small pool is empty: a miss, and the heap serves the message.
+  small[SMALL_CNT] = osal_msg_allocate( SMALL_LEN );
+  HOST_CHECK( (small[SMALL_CNT] != NULL) && (inPool( small[SMALL_CNT] ) == 2) );
+  HOST_CHECK( osal_msg_pool_stats( 0 )->miss == 1 );
+  HOST_CHECK( osal_msg_pool_stats( 1 )->hit == 0 );
+
+  msg = osal_msg_allocate( SMALL_LEN + 1 );
+  HOST_CHECK( (msg != NULL) && (inPool( msg ) == 1) );
+  HOST_CHECK( osal_msg_deallocate( msg ) == ZSUCCESS );
+
+  // Too long for every pool: straight to the heap, no counters touched.
+  msg = osal_msg_allocate( LARGE_LEN + 1 );
+  HOST_CHECK( (msg != NULL) && (inPool( msg ) == 2) );
+  HOST_CHECK( osal_msg_pool_stats( 1 )->miss == 0 );
+  HOST_CHECK( osal_msg_deallocate( msg ) == ZSUCCESS );
+
+  for ( i = 0; i <= SMALL_CNT; i++ )
+  {
+    HOST_CHECK( osal_msg_deallocate( small[i] ) == ZSUCCESS );
+  }
+  HOST_CHECK( osal_msg_pool_stats( 0 )->used == 0 );
+  HOST_CHECK( osal_msg_pool_stats( 0 )->highWater == SMALL_CNT );
+  HOST_CHECK( osal_msg_pool_stats( 1 )->highWater == 1 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testPoolAdd
+ *
+ * @brief       Pools must grow in length and are limited to OSAL_MSG_POOL_MAX.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testPoolAdd( void )
+{
+  static byte buf[OSAL_MSG_POOL_BUF_SIZE( LARGE_LEN * 4, 1 )];
+  byte i;
+
+  HOST_CHECK( osal_msg_pool_add( buf, LARGE_LEN, 1 ) == INVALID_LEN );
+  HOST_CHECK( osal_msg_pool_add( buf, 0, 1 ) == INVALID_LEN );
+  HOST_CHECK( osal_msg_pool_add( NULL, LARGE_LEN + 1, 1 ) == MSG_BUFFER_NOT_AVAIL );
+  HOST_CHECK( osal_msg_pool_add( buf, LARGE_LEN + 1, 0 ) == MSG_BUFFER_NOT_AVAIL );
+  HOST_CHECK( osal_msg_pool_stats( 2 ) == NULL );
+
+  for ( i = 2; i < OSAL_MSG_POOL_MAX; i++ )
+  {
+    HOST_CHECK( osal_msg_pool_add( buf, (uint16)(LARGE_LEN * i), 1 ) == ZSUCCESS );
+  }
+  HOST_CHECK( osal_msg_pool_add( buf, LARGE_LEN * 4, 1 ) == MSG_BUFFER_NOT_AVAIL );
+}
+
+
+/**************************************************************************************************
+ * @fn          testRandom
+ *
+ * @brief       Random allocate / deallocate; every message keeps its contents and the pool
+ *              counters follow the blocks in use.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRandom( void )
+{
+  static byte *live[LIVE_MAX];
+  static uint16 len[LIVE_MAX];
+  byte used[3] = { 0, 0, 0 };
+  long step;
+  uint16 i;
+
+  host_srand( 7 );
+
+  for ( step = 0; step < 200000L; step++ )
+  {
+    byte idx = (byte)(host_rand() % LIVE_MAX);
+
+    if ( live[idx] == NULL )
+    {
+      len[idx] = (uint16)(1 + host_rand() % (LARGE_LEN + 16));
+      live[idx] = osal_msg_allocate( len[idx] );
+      if ( live[idx] != NULL )
+      {
+        memset( live[idx], idx, len[idx] );
+        used[inPool( live[idx] )]++;
+      }
+    }
+    else
+    {
+      for ( i = 0; i < len[idx]; i++ )
+      {
+        if ( live[idx][i] != idx )
+        {
+          HOST_CHECK( !"message contents overwritten" );
+          return;
+        }
+      }
+      used[inPool( live[idx] )]--;
+      HOST_CHECK( osal_msg_deallocate( live[idx] ) == ZSUCCESS );
+      live[idx] = NULL;
+    }
+
+    HOST_CHECK( osal_msg_pool_stats( 0 )->used == used[0] );
+    HOST_CHECK( osal_msg_pool_stats( 1 )->used == used[1] );
+  }
+
+  for ( i = 0; i < LIVE_MAX; i++ )
+  {
+    if ( live[i] != NULL )
+    {
+      osal_msg_deallocate( live[i] );
+      live[i] = NULL;
+    }
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the message pool tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  osal_init_system();
+
+  testBestFit();
+  testRandom();
+  testPoolAdd();
+
+  return HOST_RESULT( "test_msg_pool" );
+}
+
+
+/**************************************************************************************************
+*/
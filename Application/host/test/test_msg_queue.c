@@ -0,0 +1,277 @@
+/**************************************************************************************************
+    Filename:       test_msg_queue.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The per-task message queues, built with OSAL_MAX_TASKS of 4 and the
+    3 tasks msa_Osal.c adds, so that one task ID of the table is never
+    added. Random messages are sent to random tasks, most of them to the
+    MSA task so that its queue runs deep, and received in between; each
+    task must get exactly its own messages, in the order they were sent,
+    have SYS_EVENT_MSG set by each send, and its queue counters follow
+    the depth of its queue and the most ever queued. Sends to a task not
+    added and past the table must fail and free the message, and the
+    heap be back where it started once every queue is drained.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_TASKS    3        // HAL, MAC and MSA, as msa_Osal.c adds.
+#define TEST_MSA      2
+#define TEST_DEPTH    64       // Most messages queued at once, over all tasks.
+#define TEST_OPS      200000L  // Sends and receives of testRandom().
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+// Model: tags of the messages queued for each task, oldest first.
+static uint16 model[TEST_TASKS][TEST_DEPTH];
+static uint16 modelHead[TEST_TASKS];
+static uint16 modelDepth[TEST_TASKS];
+static uint16 modelHighWater[TEST_TASKS];
+static uint16 queued;
+static uint16 nextTag;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_LOW );
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_HIGH );
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          checkStats
+ *
+ * @brief       Check the queue counters of every task against the model.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void checkStats( void )
+{
+  const osal_msg_q_stats_t *stats;
+  byte idx;
+
+  for ( idx = 0; idx < TEST_TASKS; idx++ )
+  {
+    stats = osal_msg_q_stats( idx );
+    HOST_CHECK( stats != NULL );
+    if ( stats != NULL )
+    {
+      HOST_CHECK( stats->depth == modelDepth[idx] );
+      HOST_CHECK( stats->highWater == modelHighWater[idx] );
+    }
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          send
+ *
+ * @brief       Send a new tagged message to 'taskId', in the OSAL and the model.
+ *
+ * @param       taskId - destination.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void send( byte taskId )
+{
+  uint16 *msg = (uint16 *)osal_msg_allocate( sizeof( uint16 ) );
+
+  HOST_CHECK( msg != NULL );
+  if ( msg == NULL )
+    return;
+
+  *msg = nextTag;
+  osalFindTask( taskId )->events = 0;
+  HOST_CHECK( osal_msg_send( taskId, (byte *)msg ) == ZSUCCESS );
+  HOST_CHECK( osalFindTask( taskId )->events & SYS_EVENT_MSG );
+
+  model[taskId][(modelHead[taskId] + modelDepth[taskId]) % TEST_DEPTH] = nextTag++;
+  if ( modelHighWater[taskId] < ++modelDepth[taskId] )
+    modelHighWater[taskId] = modelDepth[taskId];
+  queued++;
+}
+
+
+/**************************************************************************************************
+ * @fn          receive
+ *
+ * @brief       Receive a message of 'taskId' and check it against the model.
+ *
+ * @param       taskId - receiving task.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void receive( byte taskId )
+{
+  uint16 *msg = (uint16 *)osal_msg_receive( taskId );
+
+  if ( modelDepth[taskId] == 0 )
+  {
+    HOST_CHECK( msg == NULL );
+    return;
+  }
+
+  HOST_CHECK( msg != NULL );
+  if ( msg == NULL )
+    return;
+
+  HOST_CHECK( *msg == model[taskId][modelHead[taskId]] );
+  modelHead[taskId] = (modelHead[taskId] + 1) % TEST_DEPTH;
+  modelDepth[taskId]--;
+  queued--;
+
+  HOST_CHECK( osal_msg_deallocate( (byte *)msg ) == ZSUCCESS );
+}
+
+
+/**************************************************************************************************
+ * @fn          testRandom
+ *
+ * @brief       Random sends and receives, most sends to the MSA task.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRandom( void )
+{
+  byte taskId;
+  long n;
+
+  for ( n = 0; n < TEST_OPS; n++ )
+  {
+    taskId = (byte)(host_rand() % TEST_TASKS);
+
+    if ( (queued < TEST_DEPTH) && ((host_rand() % 8) < 5) )
+    {
+      send( ((host_rand() % 2) == 0) ? TEST_MSA : taskId );
+    }
+    else
+    {
+      receive( taskId );
+    }
+
+    if ( (n % 64) == 0 )
+    {
+      checkStats();
+    }
+  }
+
+  // Drain every queue.
+  for ( taskId = 0; taskId < TEST_TASKS; taskId++ )
+  {
+    while ( modelDepth[taskId] != 0 )
+    {
+      receive( taskId );
+    }
+    receive( taskId );
+  }
+  checkStats();
+
+  HOST_CHECK( modelHighWater[TEST_MSA] > TEST_DEPTH / 2 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testInvalid
+ *
+ * @brief       Sends to a task not added and past the table fail and free the message, and no
+ *              counters are kept for them.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testInvalid( void )
+{
+  byte taskId;
+  byte *msg;
+
+  for ( taskId = TEST_TASKS; taskId <= OSAL_MAX_TASKS; taskId++ )
+  {
+    msg = osal_msg_allocate( sizeof( uint16 ) );
+    HOST_CHECK( msg != NULL );
+    HOST_CHECK( osal_msg_send( taskId, msg ) == INVALID_TASK );
+    HOST_CHECK( osal_msg_q_stats( taskId ) == NULL );
+    HOST_CHECK( osal_msg_receive( taskId ) == NULL );
+  }
+
+  HOST_CHECK( osal_msg_send( TEST_MSA, NULL ) == INVALID_MSG_POINTER );
+  checkStats();
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the message queue tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint16 used;
+
+  host_srand( 24 );
+  osal_init_system();
+  used = osal_heap_mem_used();
+
+  testRandom();
+  testInvalid();
+
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  return HOST_RESULT( "test_msg_queue" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,204 @@
+/**************************************************************************************************
+    Filename:       test_msg_reserve.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Message reserve of osal_msg_allocate(), built without message pools:
+    osal_init_system() must still size and fill the reserve, an armed
+    allocation must get a reserve block when the heap is full, and a
+    refill must never leave more than the configured blocks in reserve,
+    wherever the interrupt that deallocates a message lands in it.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define RESERVE_LEN  32
+#define RESERVE_CNT  2
+
+#define LIVE_MAX     (MAXMEMHEAP / RESERVE_LEN)
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static byte *held[LIVE_MAX];
+static uint16 heldCnt;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+void osalAddTasks( void )
+{
+}
+
+void osalAddMsgPools( void )
+{
+  osal_msg_reserve_set( RESERVE_LEN, RESERVE_CNT );
+}
+
+
+/**************************************************************************************************
+ * @fn          fillHeap
+ *
+ * @brief       Take the whole heap in reserve-sized messages.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void fillHeap( void )
+{
+  heldCnt = 0;
+  while ( (heldCnt < LIVE_MAX) && ((held[heldCnt] = osal_msg_allocate( RESERVE_LEN )) != NULL) )
+  {
+    heldCnt++;
+  }
+  HOST_CHECK( heldCnt < LIVE_MAX );
+}
+
+
+/**************************************************************************************************
+ * @fn          rxIsr
+ *
+ * @brief       An interrupt that releases a message, which refills the reserve.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void rxIsr( void )
+{
+  osal_msg_deallocate( held[--heldCnt] );
+}
+
+
+/**************************************************************************************************
+ * @fn          testInit
+ *
+ * @brief       The reserve is filled at start-up without message pools, and serves an armed
+ *              allocation once the heap is full.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testInit( void )
+{
+  const osal_msg_reserve_stats_t *stats = osal_msg_reserve_stats();
+  byte *msg;
+
+  osal_init_system();
+  HOST_CHECK( stats->len == RESERVE_LEN );
+  HOST_CHECK( stats->avail == RESERVE_CNT );
+
+  fillHeap();
+  HOST_CHECK( osal_msg_allocate( RESERVE_LEN ) == NULL );
+
+  osal_msg_reserve_arm( TRUE );
+  msg = osal_msg_allocate( RESERVE_LEN );
+  HOST_CHECK( osal_msg_allocate( RESERVE_LEN + 1 ) == NULL );
+  osal_msg_reserve_arm( FALSE );
+
+  HOST_CHECK( msg != NULL );
+  HOST_CHECK( stats->avail == (RESERVE_CNT - 1) );
+  HOST_CHECK( (stats->hit == 1) && (stats->miss == 1) );
+
+  // The block goes back to the heap, and from there into the reserve.
+  osal_msg_deallocate( msg );
+  HOST_CHECK( stats->avail == RESERVE_CNT );
+
+  while ( heldCnt != 0 )
+  {
+    osal_msg_deallocate( held[--heldCnt] );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testFillRace
+ *
+ * @brief       With one block short in reserve, a task-level deallocation refills it while an
+ *              interrupt deallocates too. The interrupt is taken at each critical section of
+ *              the task's path in turn.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testFillRace( void )
+{
+  const osal_msg_reserve_stats_t *stats = osal_msg_reserve_stats();
+  uint16 skip;
+
+  for ( skip = 0; ; skip++ )
+  {
+    byte taken;
+
+    osal_init_system();
+    fillHeap();
+    osal_msg_reserve_arm( TRUE );
+    HOST_CHECK( osal_msg_allocate( RESERVE_LEN ) != NULL );
+    osal_msg_reserve_arm( FALSE );
+    HOST_CHECK( stats->avail == (RESERVE_CNT - 1) );
+
+    hostIsrSkip = skip;
+    hostIsr = rxIsr;
+    osal_msg_deallocate( held[0] );
+    taken = (hostIsr == NULL);
+    hostIsr = NULL;
+
+    HOST_CHECK( stats->avail <= RESERVE_CNT );
+    if ( !taken )
+    {
+      // The interrupt came after the whole path.
+      HOST_CHECK( stats->avail == RESERVE_CNT );
+      break;
+    }
+  }
+
+  HOST_CHECK( skip > 2 );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the reserve tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  testInit();
+  testFillRace();
+
+  return HOST_RESULT( "test_msg_reserve" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,284 @@
+/**************************************************************************************************
+    Filename:       test_osal_multi.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Two OSAL instances in one process (OSAL_MULTI_INSTANCE), each with
+    its own tasks, heap, message queues and timers. Whatever is done in
+    one instance, after osal_ctx_switch() the other must not see it:
+    a message sent, a heap run full, a timer started and expired, the
+    system clock advanced.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define EVT_A       0x0001
+#define EVT_B       0x0002
+
+#define MSG_LEN     24
+#define LIVE_MAX    (MAXMEMHEAP / MSG_LEN)
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static osal_ctx_t *ctxA;
+static osal_ctx_t *ctxB;
+
+static byte initInst;     // Instance osal_init_system() is adding tasks to.
+static byte initCnt[2];   // Tasks initialized, per instance.
+static byte *held[LIVE_MAX];
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+  initCnt[initInst]++;
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  // Instance A runs two tasks, instance B one.
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_HIGH );
+  if ( initInst == 0 )
+  {
+    osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_LOW );
+  }
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          taskEvents
+ *
+ * @brief       Events pending on a task of the current instance.
+ *
+ * @param       taskId - task.
+ *
+ * @return      Event flags, 0 if there is no such task.
+ **************************************************************************************************
+ */
+static uint16 taskEvents( byte taskId )
+{
+  osalTaskRec_t *task = osalFindTask( taskId );
+
+  return ( (task != NULL) ? task->events : 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          tick
+ *
+ * @brief       Advance the timers of the current instance.
+ *
+ * @param       ms - milliseconds.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void tick( uint16 ms )
+{
+  while ( ms-- != 0 )
+  {
+    osal_update_timers();
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testInit
+ *
+ * @brief       Each instance is initialized with its own task list.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testInit( void )
+{
+  ctxA = osal_ctx_create();
+  ctxB = osal_ctx_create();
+  HOST_CHECK( (ctxA != NULL) && (ctxB != NULL) );
+
+  initInst = 0;
+  osal_ctx_switch( ctxA );
+  osal_init_system();
+
+  initInst = 1;
+  osal_ctx_switch( ctxB );
+  osal_init_system();
+
+  HOST_CHECK( (initCnt[0] == 2) && (initCnt[1] == 1) );
+  HOST_CHECK( osalFindTask( 1 ) == NULL );
+
+  osal_ctx_switch( ctxA );
+  HOST_CHECK( osalFindTask( 1 ) != NULL );
+}
+
+
+/**************************************************************************************************
+ * @fn          testMessages
+ *
+ * @brief       A message sent in A is queued and counted in A only.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testMessages( void )
+{
+  byte *msg;
+
+  osal_ctx_switch( ctxA );
+  msg = osal_msg_allocate( MSG_LEN );
+  HOST_CHECK( msg != NULL );
+  HOST_CHECK( osal_msg_send( 0, msg ) == ZSUCCESS );
+  HOST_CHECK( taskEvents( 0 ) & SYS_EVENT_MSG );
+
+  osal_ctx_switch( ctxB );
+  HOST_CHECK( osal_msg_receive( 0 ) == NULL );
+  HOST_CHECK( taskEvents( 0 ) == 0 );
+#if defined( OSAL_TOTAL_MEM )
+  HOST_CHECK( osal_num_msgs() == 0 );
+#endif
+
+  osal_ctx_switch( ctxA );
+  HOST_CHECK( osal_msg_receive( 0 ) == msg );
+  HOST_CHECK( osal_msg_deallocate( msg ) == ZSUCCESS );
+}
+
+
+/**************************************************************************************************
+ * @fn          testHeap
+ *
+ * @brief       With the heap of A full, B still allocates, and a block freed in B does not make
+ *              room in A.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testHeap( void )
+{
+  uint16 cnt = 0;
+  byte *msg;
+
+  osal_ctx_switch( ctxA );
+  while ( (cnt < LIVE_MAX) && ((held[cnt] = osal_msg_allocate( MSG_LEN )) != NULL) )
+  {
+    cnt++;
+  }
+  HOST_CHECK( (cnt > 0) && (cnt < LIVE_MAX) );
+
+  osal_ctx_switch( ctxB );
+  msg = osal_msg_allocate( MSG_LEN );
+  HOST_CHECK( msg != NULL );
+  HOST_CHECK( osal_msg_deallocate( msg ) == ZSUCCESS );
+
+  osal_ctx_switch( ctxA );
+  HOST_CHECK( osal_msg_allocate( MSG_LEN ) == NULL );
+  while ( cnt != 0 )
+  {
+    HOST_CHECK( osal_msg_deallocate( held[--cnt] ) == ZSUCCESS );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testTimers
+ *
+ * @brief       Timers and the system clock advance only in the instance that is ticked.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testTimers( void )
+{
+  uint32 clockA;
+
+  osal_ctx_switch( ctxA );
+  HOST_CHECK( osal_start_timerEx( 1, EVT_A, 10 ) == ZSUCCESS );
+  osal_ctx_switch( ctxB );
+  HOST_CHECK( osal_start_timerEx( 0, EVT_B, 30 ) == ZSUCCESS );
+  HOST_CHECK( osal_get_timeoutEx( 1, EVT_A ) == 0 );
+
+  osal_ctx_switch( ctxA );
+  HOST_CHECK( osal_get_timeoutEx( 0, EVT_B ) == 0 );
+  tick( 10 );
+  HOST_CHECK( taskEvents( 1 ) == EVT_A );
+  HOST_CHECK( osal_timer_num_active() == 0 );
+  clockA = osal_GetSystemClock();
+
+  osal_ctx_switch( ctxB );
+  HOST_CHECK( osal_get_timeoutEx( 0, EVT_B ) == 30 );
+  HOST_CHECK( osal_timer_num_active() == 1 );
+  HOST_CHECK( osal_GetSystemClock() != clockA );
+  tick( 30 );
+  HOST_CHECK( taskEvents( 0 ) == EVT_B );
+
+  osal_ctx_switch( ctxA );
+  HOST_CHECK( osal_GetSystemClock() == clockA );
+  HOST_CHECK( (taskEvents( 0 ) & EVT_B) == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the multi-instance tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  testInit();
+  testMessages();
+  testHeap();
+  testTimers();
+
+  osal_ctx_switch( ctxB );
+  osal_ctx_destroy( ctxA );
+  osal_ctx_destroy( ctxB );
+
+  return HOST_RESULT( "test_osal_multi" );
+}
+
+
+/**************************************************************************************************
+*/
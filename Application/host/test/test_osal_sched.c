@@ -0,0 +1,316 @@
+/**************************************************************************************************
+    Filename:       test_osal_sched.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The ready bitmap scheduler of osal_start_system(), built with
+    OSAL_MAX_TASKS of 8 and of 16. A full table of tasks of random
+    priorities, some of them equal, runs in the real main loop: the
+    tasks set events on each other and hand some of theirs back, and
+    the HAL poll sets events as interrupts would. Every task must be
+    called with exactly the events set for it, only while no task of
+    higher priority, or of the same priority and added before it, has
+    events; the ready bitmap must follow the events of every task, and
+    no task be called in a pass with none. Last, with every task given
+    an event at once, the calls must come in priority order.
+
+    The HAL poll hook leaves the main loop by longjmp() once the test
+    is done with it.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include <setjmp.h>
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_TASKS    OSAL_MAX_TASKS
+#define TEST_PASSES   200000L  // Main loop passes of testRandom().
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static byte prio[TEST_TASKS];
+
+// Model: events set for each task and not yet handed to it.
+static uint16 pending[TEST_TASKS];
+
+static jmp_buf loopExit;
+static long passes;
+static long passLimit;
+static uint32 calls;
+static uint32 callsSeen;
+static byte wasIdle;
+static byte randomOn;
+
+// Calls of testOrder(), in order.
+static byte order[TEST_TASKS];
+static byte orderCnt;
+
+
+/**************************************************************************************************
+ * @fn          higher
+ *
+ * @brief       TRUE if task 'a' runs before task 'b': higher priority, or the same priority and
+ *              added first.
+ *
+ * @param       a, b - task IDs.
+ *
+ * @return      TRUE or FALSE
+ **************************************************************************************************
+ */
+static byte higher( byte a, byte b )
+{
+  return ( (prio[a] > prio[b]) || ((prio[a] == prio[b]) && (a < b)) );
+}
+
+
+/**************************************************************************************************
+ * @fn          post
+ *
+ * @brief       Set a random event on a random task, in the OSAL and the model.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void post( void )
+{
+  byte taskId = (byte)(host_rand() % TEST_TASKS);
+  uint16 event = (uint16)1 << (host_rand() % 15);
+
+  HOST_CHECK( osal_set_event( taskId, event ) == ZSUCCESS );
+  pending[taskId] |= event;
+}
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  uint16 ret = 0;
+  byte idx;
+
+  calls++;
+  HOST_CHECK( events == pending[taskId] );
+  pending[taskId] = 0;
+
+  // Nothing that should run first is waiting.
+  for ( idx = 0; idx < TEST_TASKS; idx++ )
+  {
+    HOST_CHECK( !pending[idx] || !higher( idx, taskId ) );
+  }
+
+  if ( randomOn )
+  {
+    for ( idx = (byte)(host_rand() % 3); idx != 0; idx-- )
+    {
+      post();
+    }
+
+    // Some events are left for later.
+    if ( (host_rand() % 4) == 0 )
+    {
+      ret = events & (uint16)host_rand();
+      pending[taskId] |= ret;
+    }
+  }
+  else if ( orderCnt < TEST_TASKS )
+  {
+    order[orderCnt++] = taskId;
+  }
+
+  return ret;
+}
+
+void osalAddTasks( void )
+{
+  static const byte prioChoice[] =
+    { OSAL_TASK_PRIORITY_LOW, OSAL_TASK_PRIORITY_MED, OSAL_TASK_PRIORITY_HIGH, 0, 255 };
+  byte idx;
+
+  for ( idx = 0; idx < TEST_TASKS; idx++ )
+  {
+    prio[idx] = ( host_rand() % 3 ) ? prioChoice[host_rand() % sizeof( prioChoice )]
+                                    : (byte)host_rand();
+    osalTaskAdd( appInit, appEvents, prio[idx] );
+  }
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          pollHook
+ *
+ * @brief       Top of each main loop pass: check the ready bitmap against the model, check that
+ *              an idle pass called no task, post events as interrupts would, and leave the loop
+ *              after passLimit passes.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void pollHook( void )
+{
+  byte idle = TRUE;
+  byte idx;
+
+  for ( idx = 0; idx < TEST_TASKS; idx++ )
+  {
+    osalTaskRec_t *task = osalFindTask( idx );
+
+    HOST_CHECK( task->events == pending[idx] );
+    HOST_CHECK( ((osalTaskCtx.ready & task->readyBit) != 0) == (pending[idx] != 0) );
+    idle = idle && ( pending[idx] == 0 );
+  }
+  HOST_CHECK( OSAL_TASKS_IDLE() == idle );
+  HOST_CHECK( (osalNextActiveTask() == NULL) == idle );
+
+  if ( wasIdle )
+  {
+    HOST_CHECK( calls == callsSeen );
+  }
+
+  if ( ++passes >= passLimit )
+  {
+    longjmp( loopExit, 1 );
+  }
+
+  if ( randomOn && ((host_rand() % 3) == 0) )
+  {
+    post();
+    idle = FALSE;
+  }
+
+  wasIdle = idle;
+  callsSeen = calls;
+}
+
+
+/**************************************************************************************************
+ * @fn          runLoop
+ *
+ * @brief       Run osal_start_system() for 'cnt' passes.
+ *
+ * @param       cnt - passes.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void runLoop( long cnt )
+{
+  passes = 0;
+  passLimit = cnt;
+  wasIdle = FALSE;
+
+  if ( setjmp( loopExit ) == 0 )
+  {
+    osal_start_system();
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testRandom
+ *
+ * @brief       Random events from tasks and interrupts through the main loop.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRandom( void )
+{
+  randomOn = TRUE;
+  runLoop( TEST_PASSES );
+  randomOn = FALSE;
+
+  // Drain what is left.
+  runLoop( TEST_PASSES );
+  HOST_CHECK( OSAL_TASKS_IDLE() );
+  HOST_CHECK( calls > TEST_PASSES / 2 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testOrder
+ *
+ * @brief       Every task given an event at once is called once, in priority order.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testOrder( void )
+{
+  byte idx;
+
+  orderCnt = 0;
+  for ( idx = TEST_TASKS; idx-- != 0; )
+  {
+    osal_set_event( idx, 0x0001 );
+    pending[idx] = 0x0001;
+  }
+
+  runLoop( TEST_TASKS + 2 );
+
+  HOST_CHECK( orderCnt == TEST_TASKS );
+  for ( idx = 1; idx < orderCnt; idx++ )
+  {
+    HOST_CHECK( higher( order[idx - 1], order[idx] ) );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the scheduler tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  host_srand( OSAL_MAX_TASKS );
+  osal_init_system();
+  hostPollHook = pollHook;
+
+  testRandom();
+  testOrder();
+
+  return HOST_RESULT( "test_osal_sched" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,332 @@
+/**************************************************************************************************
+    Filename:       test_tickless.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    OSAL_TICKLESS on a virtual clock, built once per timer backend.
+    OSAL_TIMER is a free-running 16-bit count of TICK_HW_COUNT per ms;
+    the test moves it straight to the compare OSAL set, where the
+    compare interrupt calls osal_update_timers() as msa_Main.c does, or
+    stops short of it to start and stop timers at any count.
+
+    Every timer must expire at the compare interrupt of its deadline,
+    the whole tick its timeout is counted from plus the timeout, never
+    at another one: OSAL never sets the compare past the next deadline.
+    An interrupt that expires nothing is only taken to keep the 16-bit
+    count from wrapping unseen, TICK_HW_MAX ticks or more after the last
+    one, and osal_GetSystemClock() always gives the whole ms of the
+    virtual clock.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_EVENTS   16       // Timers of task 0, one per event bit.
+#define TEST_STEPS    50000L   // Random operations.
+#define TEST_MAXTO    2000     // Longest random timeout, ms.
+#define KEEP_PERIOD   1000     // Reload timer of task 1, started at count 0.
+#define IDLE_MS       60000UL  // Lone timer of testIdle().
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static osalTimerRec_t rec[TEST_EVENTS];
+static osalTimerRec_t keep;
+
+// Virtual clock, in OSAL_TIMER counts since the first timer started.
+static uint32 vtime;
+
+// Model: count at which each timer is due, 0 if stopped; and the reload timer.
+static uint32 due[TEST_EVENTS];
+static uint32 keepDue;
+
+static uint32 wakeups;     // Compare interrupts taken.
+static uint32 idle;        // Of those, the ones that expired nothing.
+static uint32 lastIsr;     // vtime of the last compare interrupt.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_LOW );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          takeEvents
+ *
+ * @brief       Take the events a task has pending.
+ *
+ * @param       taskId - task.
+ *
+ * @return      Event flags.
+ **************************************************************************************************
+ */
+static uint16 takeEvents( byte taskId )
+{
+  osalTaskRec_t *task = osalFindTask( taskId );
+  uint16 events = task->events;
+
+  task->events = 0;
+  return events;
+}
+
+
+/**************************************************************************************************
+ * @fn          modelNext
+ *
+ * @brief       Earliest deadline of the model.
+ *
+ * @param       none
+ *
+ * @return      vtime of the next expiry.
+ **************************************************************************************************
+ */
+static uint32 modelNext( void )
+{
+  uint32 next = keepDue;
+  byte bit;
+
+  for ( bit = 0; bit < TEST_EVENTS; bit++ )
+  {
+    if ( (due[bit] != 0) && (due[bit] < next) )
+    {
+      next = due[bit];
+    }
+  }
+
+  return next;
+}
+
+
+/**************************************************************************************************
+ * @fn          modelCheck
+ *
+ * @brief       Check that exactly the timers due by now have set their event, and the clock.
+ *
+ * @param       none
+ *
+ * @return      Number of timers that expired.
+ **************************************************************************************************
+ */
+static byte modelCheck( void )
+{
+  uint16 expect = 0;
+  byte cnt = 0;
+  byte bit;
+
+  for ( bit = 0; bit < TEST_EVENTS; bit++ )
+  {
+    if ( (due[bit] != 0) && (due[bit] <= vtime) )
+    {
+      expect |= (uint16)1 << bit;
+      due[bit] = 0;
+      cnt++;
+    }
+  }
+  HOST_CHECK( takeEvents( 0 ) == expect );
+
+  if ( keepDue <= vtime )
+  {
+    HOST_CHECK( takeEvents( 1 ) == 0x0001 );
+    keepDue += (uint32)KEEP_PERIOD * TICK_HW_COUNT;
+    cnt++;
+  }
+  else
+  {
+    HOST_CHECK( takeEvents( 1 ) == 0 );
+  }
+
+  HOST_CHECK( osal_GetSystemClock() == vtime / TICK_HW_COUNT );
+
+  return cnt;
+}
+
+
+/**************************************************************************************************
+ * @fn          runTo
+ *
+ * @brief       Let the virtual clock run to 'target', taking every compare interrupt on the way.
+ *
+ * @param       target - vtime to stop at.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void runTo( uint32 target )
+{
+  for ( ; ; )
+  {
+    uint16 dist = (uint16)(hostTimerCompare - hostTimerCount);
+    uint32 isrAt = vtime + (dist ? dist : 0x10000UL);
+
+    // The compare is never after the next deadline.
+    HOST_CHECK( isrAt <= modelNext() );
+
+    if ( isrAt > target )
+    {
+      break;
+    }
+
+    vtime = isrAt;
+    hostTimerCount = (uint16)vtime;
+    osal_update_timers();
+
+    wakeups++;
+    if ( modelCheck() == 0 )
+    {
+      // Only to see the count before it wraps.
+      HOST_CHECK( (vtime - lastIsr) >= ((uint32)TICK_HW_MAX * TICK_HW_COUNT) );
+      idle++;
+    }
+    lastIsr = vtime;
+  }
+
+  vtime = target;
+  hostTimerCount = (uint16)vtime;
+}
+
+
+/**************************************************************************************************
+ * @fn          testRandom
+ *
+ * @brief       Start and stop timers at random counts between the compare interrupts.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRandom( void )
+{
+  long step;
+
+  host_srand( 9 );
+
+  for ( step = 0; step < TEST_STEPS; step++ )
+  {
+    byte bit = (byte)(host_rand() % TEST_EVENTS);
+
+    runTo( vtime + host_rand() % (3UL * TICK_HW_COUNT) );
+
+    if ( host_rand() % 4 != 0 )
+    {
+      uint16 timeout = (uint16)(host_rand() % TEST_MAXTO);
+
+      // Timed from the last whole tick; a timer due now expires at the next one.
+      HOST_CHECK( osal_start_timerRec( &rec[bit], 0, (uint16)1 << bit, timeout ) == ZSUCCESS );
+      due[bit] = ((vtime / TICK_HW_COUNT) + ((timeout != 0) ? timeout : 1)) * TICK_HW_COUNT;
+    }
+    else
+    {
+      HOST_CHECK( osal_stop_timerRec( &rec[bit] ) == ((due[bit] != 0) ? ZSUCCESS : INVALID_EVENT_ID) );
+      due[bit] = 0;
+    }
+
+    // Starting and stopping elapse the whole ticks: nothing may be due unseen.
+    modelCheck();
+  }
+
+  for ( step = 0; step < TEST_EVENTS; step++ )
+  {
+    osal_stop_timerRec( &rec[step] );
+    due[step] = 0;
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testIdle
+ *
+ * @brief       With only the reload timer and one long timer running, the wakeups are the
+ *              expiries and the wrap guards, not one per ms.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testIdle( void )
+{
+  uint32 before = wakeups;
+  uint32 beforeIdle = idle;
+  uint32 start = vtime;
+
+  HOST_CHECK( osal_start_timerRec( &rec[0], 0, 0x0001, (uint16)IDLE_MS ) == ZSUCCESS );
+  due[0] = ((vtime / TICK_HW_COUNT) + IDLE_MS) * TICK_HW_COUNT;
+  runTo( due[0] );
+
+  HOST_CHECK( due[0] == 0 );
+  HOST_CHECK( (wakeups - before) <= (IDLE_MS / KEEP_PERIOD) + (IDLE_MS / TICK_HW_MAX) + 2 );
+
+  printf( "test_tickless: %lu ms idle in %lu wakeups, %lu to guard the count\n",
+          (unsigned long)((vtime - start) / TICK_HW_COUNT), (unsigned long)(wakeups - before),
+          (unsigned long)(idle - beforeIdle) );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the tickless tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  osal_init_system();
+
+  // Started at count 0, so the whole ticks are the ms of vtime.
+  HOST_CHECK( osal_start_reload_timerRec( &keep, 1, 0x0001, KEEP_PERIOD ) == ZSUCCESS );
+  keepDue = (uint32)KEEP_PERIOD * TICK_HW_COUNT;
+
+  testRandom();
+  testIdle();
+
+  // Many 16-bit count wraps went by without losing a ms.
+  HOST_CHECK( vtime > 0x100000UL );
+  HOST_CHECK( osal_GetSystemClock() == vtime / TICK_HW_COUNT );
+
+  return HOST_RESULT( "test_tickless" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,367 @@
+/**************************************************************************************************
+    Filename:       test_timer_at.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Absolute deadlines, osal_start_timer_at(), across the wrap of the
+    32-bit system clock, built once per timer backend. The clock is
+    moved the way a sleeping device moves it, through
+    osal_adjust_timers() with up to 65535 ms slept at a time, so that it
+    can be brought round to the wrap in a few thousand updates.
+
+    In each of TEST_ROUNDS rounds the clock is taken to a random point
+    shortly before the wrap, then timers at deadlines before and after
+    the clock, past the wrap and past OSAL_TIMERS_MAX_TIMEOUT, and
+    relative timers, are started and stopped at random; the clock jumps
+    from deadline to deadline and every event must come exactly at its
+    deadline, or at the next update for a deadline already behind the
+    clock. Then the edge of the future half of the clock, and a chain
+    of deadlines each one period after the last, across the wrap.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_TIMERS   8        // Events 0x0001 to 0x0080 of task 0.
+#define TEST_ROUNDS   40
+#define TEST_OPS      500      // Random operations per round.
+#define TEST_BEFORE   200000L  // Longest distance of a round's start from the wrap, ms.
+
+#define EVT_KEEP      0x8000   // Keeps a timer armed, so that osal_adjust_timers() runs.
+#define KEEP_PERIOD   60000
+#define CHAIN_PERIOD  1000
+#define CHAIN_CNT     50
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static uint32 now;
+
+// Model: clock time each armed timer must expire at, and whether it is armed.
+static uint32 fireAt[TEST_TIMERS];
+static byte armed[TEST_TIMERS];
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          sleepFor
+ *
+ * @brief       Move the clock on 'ms', 1 to 65535, in one update, as after a sleep.
+ *
+ * @param       ms - milliseconds.
+ *
+ * @return      Events set by the update, less EVT_KEEP; they are cleared.
+ **************************************************************************************************
+ */
+static uint16 sleepFor( uint16 ms )
+{
+  osalTaskRec_t *task = osalFindTask( 0 );
+  uint16 events;
+
+  hostTimerElapsed = (uint32)ms * TICK_COUNT;
+  osal_adjust_timers();
+  now += ms;
+  HOST_CHECK( osal_GetSystemClock() == now );
+
+  events = task->events & ~EVT_KEEP;
+  task->events = 0;
+
+  return events;
+}
+
+
+/**************************************************************************************************
+ * @fn          clockTo
+ *
+ * @brief       Move the clock forward to 'target', with only EVT_KEEP running.
+ *
+ * @param       target - system clock time.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void clockTo( uint32 target )
+{
+  while ( now != target )
+  {
+    uint32 left = target - now;
+
+    HOST_CHECK( sleepFor( (uint16)(( left > 0xFFFF ) ? 0xFFFF : left) ) == 0 );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          modelStep
+ *
+ * @brief       Move the clock to the next model deadline, at most 'limit' ms on, and check that
+ *              exactly the timers due expired.
+ *
+ * @param       limit - longest step, 1 to 65535.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void modelStep( uint16 limit )
+{
+  uint32 step = limit;
+  uint16 events;
+  byte idx;
+
+  for ( idx = 0; idx < TEST_TIMERS; idx++ )
+  {
+    if ( armed[idx] && (fireAt[idx] - now < step) )
+      step = fireAt[idx] - now;
+  }
+
+  events = sleepFor( (uint16)step );
+
+  for ( idx = 0; idx < TEST_TIMERS; idx++ )
+  {
+    uint16 event = (uint16)1 << idx;
+
+    if ( armed[idx] && (fireAt[idx] == now) )
+    {
+      HOST_CHECK( events & event );
+      HOST_CHECK( osal_get_timeoutEx( 0, event ) == 0 );
+      armed[idx] = FALSE;
+    }
+    else
+    {
+      HOST_CHECK( !(events & event) );
+    }
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testRandom
+ *
+ * @brief       Random absolute and relative timers about the wrap of the clock.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRandom( void )
+{
+  uint16 wraps = 0;
+  int round, n;
+  byte idx;
+
+  host_srand( 21 );
+
+  for ( round = 0; round < TEST_ROUNDS; round++ )
+  {
+    uint32 before;
+
+    // Shortly before the wrap.
+    clockTo( (uint32)0 - 1 - (uint32)(host_rand() % TEST_BEFORE) );
+    before = now;
+
+    for ( n = 0; n < TEST_OPS; n++ )
+    {
+      unsigned long op = host_rand() % 8;
+      uint16 event;
+
+      idx = (byte)(host_rand() % TEST_TIMERS);
+      event = (uint16)1 << idx;
+
+      if ( op < 3 )
+      {
+        // A deadline up to a minute behind the clock, or up to 150 s after it.
+        int32 offset = (int32)(host_rand() % 210000L) - 60000L;
+
+        HOST_CHECK( osal_start_timer_at( 0, event, now + (uint32)offset ) == ZSUCCESS );
+        fireAt[idx] = now + (( offset > 0 ) ? (uint32)offset : 1);
+        armed[idx] = TRUE;
+
+        if ( offset > 0 )
+        {
+          HOST_CHECK( osal_get_timeoutEx( 0, event ) ==
+                      (( offset > 0xFFFF ) ? 0xFFFF : (uint16)offset) );
+        }
+      }
+      else if ( op == 3 )
+      {
+        uint16 timeout = (uint16)(1 + host_rand() % 0xFFFF);
+
+        HOST_CHECK( osal_start_timerEx( 0, event, timeout ) == ZSUCCESS );
+        fireAt[idx] = now + timeout;
+        armed[idx] = TRUE;
+      }
+      else if ( op == 4 )
+      {
+        HOST_CHECK( osal_stop_timerEx( 0, event ) == (armed[idx] ? ZSUCCESS : INVALID_EVENT_ID) );
+        armed[idx] = FALSE;
+      }
+      else
+      {
+        modelStep( (uint16)(1 + host_rand() % 0xFFFF) );
+      }
+    }
+
+    for ( idx = 0; idx < TEST_TIMERS; idx++ )
+    {
+      osal_stop_timerEx( 0, (uint16)1 << idx );
+      armed[idx] = FALSE;
+    }
+
+    wraps += ( now < before );
+  }
+
+  // Every round ran past the wrap.
+  HOST_CHECK( wraps == TEST_ROUNDS );
+}
+
+
+/**************************************************************************************************
+ * @fn          testHalf
+ *
+ * @brief       A deadline 2^31 - 1 ms after the clock is in the future, across the wrap; one
+ *              2^31 ms away is behind it and expires at once.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testHalf( void )
+{
+  uint32 deadline;
+
+  clockTo( 0xF0000000UL );
+  deadline = now + 0x7FFFFFFFUL;
+
+  HOST_CHECK( osal_start_timer_at( 0, 0x0001, deadline ) == ZSUCCESS );
+  HOST_CHECK( osal_get_timeoutEx( 0, 0x0001 ) == 0xFFFF );
+  HOST_CHECK( osal_start_timer_at( 0, 0x0002, now + 0x80000000UL ) == ZSUCCESS );
+  HOST_CHECK( sleepFor( 1 ) == 0x0002 );
+
+  // Right up to the deadline, then one more ms.
+  while ( now != deadline - 1 )
+  {
+    uint32 left = deadline - 1 - now;
+
+    HOST_CHECK( sleepFor( (uint16)(( left > 0xFFFF ) ? 0xFFFF : left) ) == 0 );
+  }
+  HOST_CHECK( osal_get_timeoutEx( 0, 0x0001 ) == 1 );
+  HOST_CHECK( sleepFor( 1 ) == 0x0001 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testChain
+ *
+ * @brief       Each deadline one period after the last, started late by up to 20 ms, as a
+ *              task handling the event would: every one comes on its schedule across the wrap.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testChain( void )
+{
+  uint32 start, deadline;
+  int n;
+
+  clockTo( (uint32)0 - CHAIN_PERIOD * CHAIN_CNT / 2 );
+  start = now;
+  deadline = start;
+
+  host_srand( 5 );
+
+  for ( n = 1; n <= CHAIN_CNT; n++ )
+  {
+    uint16 late = (uint16)(1 + host_rand() % 20);
+
+    deadline += CHAIN_PERIOD;
+    HOST_CHECK( osal_start_timer_at( 0, 0x0001, deadline ) == ZSUCCESS );
+
+    HOST_CHECK( sleepFor( (uint16)(deadline - now - 1) ) == 0 );
+    HOST_CHECK( sleepFor( 1 ) == 0x0001 );
+    HOST_CHECK( now == start + (uint32)n * CHAIN_PERIOD );
+
+    // The task gets to it a little later.
+    HOST_CHECK( sleepFor( late ) == 0 );
+  }
+
+  HOST_CHECK( now < start );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the absolute deadline tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint16 used;
+
+  osal_init_system();
+  used = osal_heap_mem_used();
+
+  HOST_CHECK( osal_start_reload_timerEx( 0, EVT_KEEP, KEEP_PERIOD ) == ZSUCCESS );
+
+  testRandom();
+  testHalf();
+  testChain();
+
+  osal_stop_timerEx( 0, EVT_KEEP );
+  HOST_CHECK( osal_timer_num_active() == 0 );
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  return HOST_RESULT( "test_timer_at" );
+}
+
+
+/**************************************************************************************************
+*/
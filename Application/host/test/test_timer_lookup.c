@@ -0,0 +1,296 @@
+/**************************************************************************************************
+    Filename:       test_timer_lookup.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    The timer lookup, osalFindTimer(), built once per timer backend.
+    Heap timers are started, restarted, stopped and left to expire at
+    random for TEST_TASKS tasks, the last ones past OSAL_TIMER_TASK_CNT
+    and so without an armed events bitmap, on single-bit event flags
+    and on flags of several bits, which share buckets with them. A table
+    of the armed timers is kept alongside; every pair of task and event
+    must then be found exactly when it is armed, as the right record,
+    and the armed events of a task must be found without a bucket walk.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_TASKS    (OSAL_TIMER_TASK_CNT + 2)  // OSAL_MAX_TASKS.
+#define TEST_FLAGS    20       // 16 single bits, then the flags of several bits.
+#define TEST_STEPS    100000L
+#define TEST_MAXTO    50       // Longest random timeout, ms.
+#define MISS_FLAGS    64       // Timers per task in testMiss().
+
+static const uint16 testFlag[TEST_FLAGS] =
+{
+  0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+  0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000,
+  0x0003, 0x0101, 0x8001, 0xFFFF
+};
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       External Functions
+ * ------------------------------------------------------------------------------------------------
+ */
+extern osalTimerRec_t *osalFindTimer( byte task_id, uint16 event_flag );
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+// Model: ms left of each armed timer, 0 if stopped.
+static uint16 left[TEST_TASKS][TEST_FLAGS];
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  byte idx;
+
+  for ( idx = 0; idx < TEST_TASKS; idx++ )
+  {
+    osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+  }
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          modelTick
+ *
+ * @brief       Tick the timers 1 ms; the model timers due go out, their events are dropped.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void modelTick( void )
+{
+  byte taskId, idx;
+
+  osal_update_timers();
+
+  for ( taskId = 0; taskId < TEST_TASKS; taskId++ )
+  {
+    for ( idx = 0; idx < TEST_FLAGS; idx++ )
+    {
+      if ( (left[taskId][idx] != 0) && (--left[taskId][idx] == 0) )
+      {
+        HOST_CHECK( osalFindTask( taskId )->events & testFlag[idx] );
+      }
+    }
+    osalFindTask( taskId )->events = 0;
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          modelCheck
+ *
+ * @brief       Every pair is found exactly when armed, as its own record.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void modelCheck( void )
+{
+  byte taskId, idx;
+  uint16 cnt = 0;
+
+  for ( taskId = 0; taskId < TEST_TASKS; taskId++ )
+  {
+    for ( idx = 0; idx < TEST_FLAGS; idx++ )
+    {
+      osalTimerRec_t *timer = osalFindTimer( taskId, testFlag[idx] );
+
+      if ( left[taskId][idx] != 0 )
+      {
+        HOST_CHECK( (timer != NULL) && (timer->task_id == taskId) &&
+                    (timer->event_flag == testFlag[idx]) );
+        HOST_CHECK( osal_get_timeoutEx( taskId, testFlag[idx] ) == left[taskId][idx] );
+        cnt++;
+      }
+      else
+      {
+        HOST_CHECK( timer == NULL );
+      }
+    }
+  }
+
+  HOST_CHECK( osal_timer_num_active() == cnt );
+}
+
+
+/**************************************************************************************************
+ * @fn          testModel
+ *
+ * @brief       Random starts, stops and ticks against the model.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testModel( void )
+{
+  long step;
+  byte taskId, idx;
+
+  host_srand( 7 );
+
+  for ( step = 0; step < TEST_STEPS; step++ )
+  {
+    unsigned long op = host_rand() % 8;
+
+    taskId = (byte)(host_rand() % TEST_TASKS);
+    idx = (byte)(host_rand() % TEST_FLAGS);
+
+    if ( op < 3 )
+    {
+      uint16 timeout = (uint16)(1 + host_rand() % TEST_MAXTO);
+
+      HOST_CHECK( osal_start_timerEx( taskId, testFlag[idx], timeout ) == ZSUCCESS );
+      left[taskId][idx] = timeout;
+    }
+    else if ( op < 5 )
+    {
+      byte status = osal_stop_timerEx( taskId, testFlag[idx] );
+
+      HOST_CHECK( status == ((left[taskId][idx] != 0) ? ZSUCCESS : INVALID_EVENT_ID) );
+      left[taskId][idx] = 0;
+    }
+    else
+    {
+      modelTick();
+    }
+
+    if ( (step % 32) == 0 )
+    {
+      modelCheck();
+    }
+  }
+
+  for ( taskId = 0; taskId < TEST_TASKS; taskId++ )
+  {
+    for ( idx = 0; idx < TEST_FLAGS; idx++ )
+    {
+      osal_stop_timerEx( taskId, testFlag[idx] );
+      left[taskId][idx] = 0;
+    }
+  }
+  modelCheck();
+}
+
+
+/**************************************************************************************************
+ * @fn          testMiss
+ *
+ * @brief       With a full bucket, an event that is not armed is turned away by the armed events
+ *              bitmap in a few instructions; past OSAL_TIMER_TASK_CNT the bucket is walked.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testMiss( void )
+{
+  static osalTimerRec_t rec[2][MISS_FLAGS];
+  unsigned long bitmap, walk;
+  byte idx;
+
+  // Flags of several bits in every bucket, for a task with a bitmap and one without.
+  for ( idx = 0; idx < MISS_FLAGS; idx++ )
+  {
+    uint16 flag = (uint16)(0x0003 + 2 * idx);
+
+    osal_start_timerRec( &rec[0][idx], 0, flag, 1000 );
+    osal_start_timerRec( &rec[1][idx], TEST_TASKS - 1, flag, 1000 );
+  }
+
+  host_steps_begin();
+  HOST_CHECK( osalFindTimer( 0, 0x0001 ) == NULL );
+  bitmap = host_steps_end();
+
+  host_steps_begin();
+  HOST_CHECK( osalFindTimer( TEST_TASKS - 1, 0x0001 ) == NULL );
+  walk = host_steps_end();
+
+  HOST_CHECK( bitmap < walk );
+  printf( "test_timer_lookup: miss among %u timers in %lu instructions with the bitmap, "
+          "%lu without\n", osal_timer_num_active(), bitmap, walk );
+
+  for ( idx = 0; idx < MISS_FLAGS; idx++ )
+  {
+    osal_stop_timerRec( &rec[0][idx] );
+    osal_stop_timerRec( &rec[1][idx] );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the lookup tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint16 used;
+
+  osal_init_system();
+  used = osal_heap_mem_used();
+
+  testModel();
+  testMiss();
+
+  HOST_CHECK( osal_timer_num_active() == 0 );
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  return HOST_RESULT( "test_timer_lookup" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,375 @@
+/**************************************************************************************************
+    Filename:       test_timer_rec.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Caller-owned timers, osal_start_timerRec() and friends, built once
+    per timer backend and linked with osal_mem_alloc() and
+    osal_mem_free() wrapped, so that every heap call is counted. A
+    timer in caller storage must start, restart, expire, reload and
+    stop without a heap call, and take over or lend its storage to the
+    event-based calls for the same event. osal_start_timerEx() must
+    still take one block per timer and give it back at expiry or stop.
+
+    Last, the timers of an idle coordinator are run for IDLE_SECONDS,
+    the 100 ms HAL_KEY_EVENT poll each way it can be kept, and the heap
+    calls per second are reported.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TASK_APP      0
+#define TASK_HAL      1
+
+#define EVT_A         0x0001
+#define EVT_B         0x0002
+#define EVT_KEY       0x0001  // HAL_KEY_EVENT.
+
+#define KEY_POLL      100     // HAL_KEY_POLLING_VALUE, ms.
+#define IDLE_SECONDS  60
+
+#define WAY_ONESHOT   0       // osal_start_timerEx() again at every poll, as hal_drivers.c did.
+#define WAY_RELOAD    1       // osal_start_reload_timerEx(), as hal_key.c does.
+#define WAY_REC       2       // osal_start_reload_timerRec().
+
+static const char *wayName[] = { "timerEx re-armed", "reload timerEx", "reload timerRec" };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static uint32 heapCalls;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Heap Call Counting
+ * ------------------------------------------------------------------------------------------------
+ */
+void *__real_osal_mem_alloc( uint16 size );
+void __real_osal_mem_free( void *ptr );
+
+void *__wrap_osal_mem_alloc( uint16 size )
+{
+  heapCalls++;
+  return __real_osal_mem_alloc( size );
+}
+
+void __wrap_osal_mem_free( void *ptr )
+{
+  heapCalls++;
+  __real_osal_mem_free( ptr );
+}
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_HIGH );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          takeEvents
+ *
+ * @brief       Take the events a task has pending.
+ *
+ * @param       taskId - task.
+ *
+ * @return      Event flags.
+ **************************************************************************************************
+ */
+static uint16 takeEvents( byte taskId )
+{
+  osalTaskRec_t *task = osalFindTask( taskId );
+  uint16 events = task->events;
+
+  task->events = 0;
+  return events;
+}
+
+
+/**************************************************************************************************
+ * @fn          tick
+ *
+ * @brief       Update the timers 'ms' times, 1 ms each.
+ *
+ * @param       ms - ticks.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void tick( uint16 ms )
+{
+  while ( ms-- != 0 )
+  {
+    osal_update_timers();
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          testRec
+ *
+ * @brief       A caller-owned timer expires, reloads, restarts and stops on time without a
+ *              single heap call.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testRec( void )
+{
+  static osalTimerRec_t recA, recB;
+  uint32 calls = heapCalls;
+  uint16 used = osal_heap_mem_used();
+  byte n;
+
+  // One-shot: set on the 5th tick, then stopped.
+  HOST_CHECK( osal_start_timerRec( &recA, TASK_APP, EVT_A, 5 ) == ZSUCCESS );
+  HOST_CHECK( osal_get_timeoutEx( TASK_APP, EVT_A ) == 5 );
+  tick( 4 );
+  HOST_CHECK( takeEvents( TASK_APP ) == 0 );
+  tick( 1 );
+  HOST_CHECK( takeEvents( TASK_APP ) == EVT_A );
+  HOST_CHECK( osal_timer_num_active() == 0 );
+  HOST_CHECK( osal_stop_timerRec( &recA ) == INVALID_EVENT_ID );
+
+  // Reload: every 3 ticks until stopped.
+  HOST_CHECK( osal_start_reload_timerRec( &recB, TASK_APP, EVT_B, 3 ) == ZSUCCESS );
+  for ( n = 0; n < 4; n++ )
+  {
+    tick( 2 );
+    HOST_CHECK( takeEvents( TASK_APP ) == 0 );
+    tick( 1 );
+    HOST_CHECK( takeEvents( TASK_APP ) == EVT_B );
+  }
+  HOST_CHECK( osal_stop_timerRec( &recB ) == ZSUCCESS );
+  tick( 10 );
+  HOST_CHECK( takeEvents( TASK_APP ) == 0 );
+
+  // A restart while running replaces the timeout: one timer, expiring once.
+  HOST_CHECK( osal_start_timerRec( &recA, TASK_APP, EVT_A, 10 ) == ZSUCCESS );
+  tick( 5 );
+  HOST_CHECK( osal_start_timerRec( &recA, TASK_APP, EVT_A, 10 ) == ZSUCCESS );
+  HOST_CHECK( osal_timer_num_active() == 1 );
+  tick( 9 );
+  HOST_CHECK( takeEvents( TASK_APP ) == 0 );
+  tick( 1 );
+  HOST_CHECK( takeEvents( TASK_APP ) == EVT_A );
+
+  // Started again for another event, the record lets go of the first one.
+  HOST_CHECK( osal_start_timerRec( &recA, TASK_APP, EVT_A, 10 ) == ZSUCCESS );
+  HOST_CHECK( osal_start_timerRec( &recA, TASK_APP, EVT_B, 10 ) == ZSUCCESS );
+  HOST_CHECK( osal_get_timeoutEx( TASK_APP, EVT_A ) == 0 );
+  HOST_CHECK( osal_timer_num_active() == 1 );
+
+  // The event-based calls find it, and it can be started again after.
+  HOST_CHECK( osal_stop_timerEx( TASK_APP, EVT_B ) == ZSUCCESS );
+  HOST_CHECK( osal_stop_timerRec( &recA ) == INVALID_EVENT_ID );
+  HOST_CHECK( osal_start_timerRec( &recA, TASK_APP, EVT_B, 2 ) == ZSUCCESS );
+  tick( 2 );
+  HOST_CHECK( takeEvents( TASK_APP ) == EVT_B );
+
+  HOST_CHECK( heapCalls == calls );
+  HOST_CHECK( osal_heap_mem_used() == used );
+  HOST_CHECK( osal_timer_num_active() == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testShared
+ *
+ * @brief       A caller-owned timer takes over the event of a heap timer, freeing it; a heap
+ *              call for an event held in caller storage reuses that storage.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testShared( void )
+{
+  static osalTimerRec_t rec;
+  uint16 used = osal_heap_mem_used();
+  uint32 calls;
+
+  HOST_CHECK( osal_start_timerEx( TASK_APP, EVT_A, 20 ) == ZSUCCESS );
+  calls = heapCalls;
+  HOST_CHECK( osal_start_timerRec( &rec, TASK_APP, EVT_A, 5 ) == ZSUCCESS );
+  HOST_CHECK( heapCalls == calls + 1 );
+  HOST_CHECK( osal_heap_mem_used() == used );
+  HOST_CHECK( osal_timer_num_active() == 1 );
+
+  // osal_start_timerEx() on the same event restarts the record.
+  calls = heapCalls;
+  HOST_CHECK( osal_start_timerEx( TASK_APP, EVT_A, 8 ) == ZSUCCESS );
+  HOST_CHECK( osal_get_timeoutEx( TASK_APP, EVT_A ) == 8 );
+  tick( 8 );
+  HOST_CHECK( takeEvents( TASK_APP ) == EVT_A );
+  HOST_CHECK( heapCalls == calls );
+  HOST_CHECK( osal_stop_timerRec( &rec ) == INVALID_EVENT_ID );
+  HOST_CHECK( osal_timer_num_active() == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          testHeap
+ *
+ * @brief       The event-based calls on their own: one block per timer, taken at the first
+ *              start and given back at expiry or stop, none for a restart.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testHeap( void )
+{
+  uint16 used = osal_heap_mem_used();
+  uint32 calls = heapCalls;
+
+  HOST_CHECK( osal_start_timerEx( TASK_APP, EVT_A, 5 ) == ZSUCCESS );
+  HOST_CHECK( osal_start_timerEx( TASK_APP, EVT_A, 5 ) == ZSUCCESS );
+  HOST_CHECK( heapCalls == calls + 1 );
+  HOST_CHECK( osal_heap_mem_used() > used );
+  tick( 5 );
+  HOST_CHECK( takeEvents( TASK_APP ) == EVT_A );
+  HOST_CHECK( heapCalls == calls + 2 );
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  HOST_CHECK( osal_start_reload_timerEx( TASK_APP, EVT_B, 5 ) == ZSUCCESS );
+  tick( 20 );
+  HOST_CHECK( takeEvents( TASK_APP ) == EVT_B );
+  HOST_CHECK( heapCalls == calls + 3 );
+  HOST_CHECK( osal_stop_timerEx( TASK_APP, EVT_B ) == ZSUCCESS );
+  HOST_CHECK( heapCalls == calls + 4 );
+  HOST_CHECK( osal_heap_mem_used() == used );
+}
+
+
+/**************************************************************************************************
+ * @fn          testIdle
+ *
+ * @brief       Run the HAL_KEY_EVENT poll of an idle coordinator for IDLE_SECONDS one way,
+ *              handling the event as the HAL task would, and report the heap calls per second.
+ *
+ * @param       way - WAY_ONESHOT, WAY_RELOAD or WAY_REC.
+ *
+ * @return      Heap calls per second.
+ **************************************************************************************************
+ */
+static uint32 testIdle( byte way )
+{
+  static osalTimerRec_t keyRec;
+  uint32 calls = heapCalls;
+  uint32 polls = 0;
+  uint32 ms;
+
+  if ( way == WAY_ONESHOT )
+  {
+    osal_start_timerEx( TASK_HAL, EVT_KEY, KEY_POLL );
+  }
+  else if ( way == WAY_RELOAD )
+  {
+    osal_start_reload_timerEx( TASK_HAL, EVT_KEY, KEY_POLL );
+  }
+  else
+  {
+    osal_start_reload_timerRec( &keyRec, TASK_HAL, EVT_KEY, KEY_POLL );
+  }
+
+  for ( ms = 0; ms < IDLE_SECONDS * 1000UL; ms++ )
+  {
+    osal_update_timers();
+    if ( takeEvents( TASK_HAL ) & EVT_KEY )
+    {
+      polls++;
+      if ( way == WAY_ONESHOT )
+      {
+        osal_start_timerEx( TASK_HAL, EVT_KEY, KEY_POLL );
+      }
+    }
+  }
+
+  HOST_CHECK( polls == (IDLE_SECONDS * 1000UL) / KEY_POLL );
+  calls = heapCalls - calls;
+
+  osal_stop_timerEx( TASK_HAL, EVT_KEY );
+
+  printf( "test_timer_rec: idle coordinator, %-17s %3lu heap calls/s\n", wayName[way],
+          (unsigned long)(calls / IDLE_SECONDS) );
+
+  return ( calls / IDLE_SECONDS );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the caller-owned timer tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint16 used;
+
+  osal_init_system();
+  used = osal_heap_mem_used();
+
+  testRec();
+  testShared();
+  testHeap();
+
+  // An alloc and a free per poll, against none once the poll stays armed.
+  HOST_CHECK( testIdle( WAY_ONESHOT ) == 2 * (1000 / KEY_POLL) );
+  HOST_CHECK( testIdle( WAY_RELOAD ) == 0 );
+  HOST_CHECK( testIdle( WAY_REC ) == 0 );
+
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  return HOST_RESULT( "test_timer_rec" );
+}
+
+
+/**************************************************************************************************
+*/
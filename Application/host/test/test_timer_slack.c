@@ -0,0 +1,187 @@
+/**************************************************************************************************
+    Filename:       test_timer_slack.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Timer slack under POWER_SAVING, built once per timer backend. The
+    reload timers of an end device, the HAL key poll, an LED blink and
+    three application timers, are run for SIM_SECONDS the way the idle
+    loop runs them: osal_pwrmgr_powerconserve() asks halSleep() to sleep
+    until osal_next_timeout(), and the wakeup hands the time slept to
+    osal_adjust_timers(). Once with no slack, where there must be one
+    wakeup per distinct deadline, and once with the slack of each timer
+    set, where every event must come no earlier than its deadline and no
+    later than its slack allows. The wakeups of both runs are reported.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OSAL_PwrMgr.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define SIM_SECONDS   60
+#define SIM_TIMERS    5
+
+typedef struct
+{
+  uint16 event;
+  uint16 period;    // ms
+  uint16 slack;     // ms
+} simTimer_t;
+
+static const simTimer_t simTimer[SIM_TIMERS] =
+{
+  { 0x0001,  100, 25 },   // HAL key poll.
+  { 0x0002,  300, 10 },   // LED blink.
+  { 0x0004, 1000,  0 },   // Reporting, on time.
+  { 0x0008,  333, 50 },
+  { 0x0010,   70, 20 },
+};
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          simRun
+ *
+ * @brief       Run the timers for SIM_SECONDS from sleep to sleep, checking every event against
+ *              its deadline.
+ *
+ * @param       useSlack - TRUE to set the slack of each timer.
+ *
+ * @return      Wakeups.
+ **************************************************************************************************
+ */
+static uint32 simRun( byte useSlack )
+{
+  osalTaskRec_t *task = osalFindTask( 0 );
+  uint32 due[SIM_TIMERS];
+  uint32 now = 0;
+  uint32 wakeups = 0;
+  byte idx;
+
+  for ( idx = 0; idx < SIM_TIMERS; idx++ )
+  {
+    osal_start_reload_timerEx( 0, simTimer[idx].event, simTimer[idx].period );
+    if ( useSlack )
+    {
+      HOST_CHECK( osal_timer_slack( 0, simTimer[idx].event, simTimer[idx].slack ) == ZSUCCESS );
+    }
+    due[idx] = simTimer[idx].period;
+  }
+
+  while ( now < SIM_SECONDS * 1000UL )
+  {
+    uint16 sleeps = hostSleepCnt;
+
+    osal_pwrmgr_powerconserve();
+    HOST_CHECK( (uint16)(hostSleepCnt - sleeps) == 1 );
+    HOST_CHECK( hostSleepMs != 0 );
+
+    // Wake up when the sleep ends.
+    hostTimerElapsed = (uint32)hostSleepMs * TICK_COUNT;
+    osal_adjust_timers();
+    now += hostSleepMs;
+    wakeups++;
+
+    for ( idx = 0; idx < SIM_TIMERS; idx++ )
+    {
+      if ( task->events & simTimer[idx].event )
+      {
+        HOST_CHECK( (due[idx] <= now) &&
+                    (now <= due[idx] + (useSlack ? simTimer[idx].slack : 0)) );
+        due[idx] += simTimer[idx].period;
+      }
+      HOST_CHECK( due[idx] > now );
+    }
+    task->events = 0;
+  }
+
+  for ( idx = 0; idx < SIM_TIMERS; idx++ )
+  {
+    osal_stop_timerEx( 0, simTimer[idx].event );
+  }
+
+  return wakeups;
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the timers without and with slack.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint32 deadlines = 0, plain, slack, t;
+  uint16 avoided;
+  byte idx;
+
+  osal_init_system();
+  osal_pwrmgr_device( PWRMGR_BATTERY );
+
+  // Distinct deadlines in the run, each a wakeup of its own without slack.
+  for ( t = 1; t <= SIM_SECONDS * 1000UL; t++ )
+  {
+    for ( idx = 0; (idx < SIM_TIMERS) && (t % simTimer[idx].period); idx++ );
+    deadlines += ( idx < SIM_TIMERS );
+  }
+
+  avoided = osal_timer_wakeups_avoided();
+  plain = simRun( FALSE );
+  HOST_CHECK( osal_timer_wakeups_avoided() == avoided );
+
+  slack = simRun( TRUE );
+  avoided = osal_timer_wakeups_avoided() - avoided;
+  HOST_CHECK( (plain == deadlines) && (slack < plain) && (avoided != 0) );
+
+  printf( "test_timer_slack: %u s of timers, %lu wakeups without slack, %lu with, "
+          "%u expiries coalesced\n", SIM_SECONDS, (unsigned long)plain, (unsigned long)slack,
+          avoided );
+
+  return HOST_RESULT( "test_timer_slack" );
+}
+
+
+/**************************************************************************************************
+*/
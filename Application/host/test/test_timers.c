@@ -0,0 +1,367 @@
+/**************************************************************************************************
+    Filename:       test_timers.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    OSAL timers against a model, ticked through osal_update_timers():
+    1 ms at a time, or with OSAL_TICKLESS, where OSAL_TIMER is advanced
+    by hand, often many ms in one update. Random starts, restarts and
+    stops of heap and
+    caller-owned timers, one-shot and reload, are mirrored in a table of
+    deadlines; after every update exactly the timers due must have set
+    their event, and osal_get_timeoutEx() must give the time left of
+    every running timer. Then timeouts past OSAL_TIMERS_MAX_TIMEOUT and
+    absolute deadlines, and a heap back to empty once every timer is
+    stopped.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Timers.h"
+#include "OSAL_Memory.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define TEST_TASKS    4        // OSAL_MAX_TASKS; task 0 uses heap timers, the others their own.
+#define TEST_EVENTS   16       // One timer per event bit.
+#define TEST_STEPS    200000L  // Model steps.
+#define TEST_MAXTO    300      // Longest random timeout, ms.
+#define TEST_GAP      TICK_HW_MAX  // Longest update with OSAL_TICKLESS, ms.
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static osalTimerRec_t rec[TEST_TASKS][TEST_EVENTS];
+
+// Model: clock at which each timer is due, 0 if stopped, and its reload period.
+static uint32 due[TEST_TASKS][TEST_EVENTS];
+static uint16 period[TEST_TASKS][TEST_EVENTS];
+static uint32 clock;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                    Application Stand-ins
+ * ------------------------------------------------------------------------------------------------
+ */
+static void appInit( byte taskId )
+{
+}
+
+static uint16 appEvents( byte taskId, uint16 events )
+{
+  return 0;
+}
+
+void osalAddTasks( void )
+{
+  byte idx;
+
+  for ( idx = 0; idx < TEST_TASKS; idx++ )
+  {
+    osalTaskAdd( appInit, appEvents, OSAL_TASK_PRIORITY_MED );
+  }
+}
+
+void osalAddMsgPools( void )
+{
+}
+
+
+/**************************************************************************************************
+ * @fn          takeEvents
+ *
+ * @brief       Take the events a task has pending.
+ *
+ * @param       taskId - task.
+ *
+ * @return      Event flags.
+ **************************************************************************************************
+ */
+static uint16 takeEvents( byte taskId )
+{
+  osalTaskRec_t *task = osalFindTask( taskId );
+  uint16 events = task->events;
+
+  task->events = 0;
+  return events;
+}
+
+
+/**************************************************************************************************
+ * @fn          modelStart
+ *
+ * @brief       Start, or restart, the timer of a task event, in OSAL and in the model.
+ *
+ * @param       taskId - task.
+ * @param       bit - event bit.
+ * @param       timeout - ms.
+ * @param       reload - TRUE for a reload timer.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void modelStart( byte taskId, byte bit, uint16 timeout, byte reload )
+{
+  uint16 event = (uint16)1 << bit;
+  byte status;
+
+  if ( taskId == 0 )
+  {
+    status = reload ? osal_start_reload_timerEx( taskId, event, timeout )
+                    : osal_start_timerEx( taskId, event, timeout );
+  }
+  else
+  {
+    status = reload ? osal_start_reload_timerRec( &rec[taskId][bit], taskId, event, timeout )
+                    : osal_start_timerRec( &rec[taskId][bit], taskId, event, timeout );
+  }
+
+  // A heap timer that is not running yet may find the heap full.
+  HOST_CHECK( (status == ZSUCCESS) || ((status == NO_TIMER_AVAIL) && (due[taskId][bit] == 0)) );
+  if ( status == ZSUCCESS )
+  {
+    // A timer due now expires at the next tick.
+    due[taskId][bit] = clock + ((timeout != 0) ? timeout : 1);
+    period[taskId][bit] = reload ? timeout : 0;
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          modelTick
+ *
+ * @brief       Advance the timers and check that exactly the timers due by then expired.
+ *
+ * @param       ms - milliseconds, 1 without OSAL_TICKLESS.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void modelTick( uint16 ms )
+{
+  byte taskId, bit;
+
+#if ( OSAL_TICKLESS )
+  hostTimerCount += ms * TICK_HW_COUNT;
+#endif
+  osal_update_timers();
+  clock += ms;
+
+  for ( taskId = 0; taskId < TEST_TASKS; taskId++ )
+  {
+    uint16 expect = 0;
+
+    for ( bit = 0; bit < TEST_EVENTS; bit++ )
+    {
+      // A reload timer can expire more than once in a long update.
+      while ( (due[taskId][bit] != 0) && (due[taskId][bit] <= clock) )
+      {
+        expect |= (uint16)1 << bit;
+        due[taskId][bit] = period[taskId][bit] ? (due[taskId][bit] + period[taskId][bit]) : 0;
+      }
+    }
+
+    HOST_CHECK( takeEvents( taskId ) == expect );
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          modelCheck
+ *
+ * @brief       Check the time left and the count of the running timers.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void modelCheck( void )
+{
+  byte taskId, bit;
+  byte cnt = 0;
+
+  for ( taskId = 0; taskId < TEST_TASKS; taskId++ )
+  {
+    for ( bit = 0; bit < TEST_EVENTS; bit++ )
+    {
+      uint16 left = osal_get_timeoutEx( taskId, (uint16)1 << bit );
+
+      if ( due[taskId][bit] != 0 )
+      {
+        HOST_CHECK( left == (uint16)(due[taskId][bit] - clock) );
+        cnt++;
+      }
+      else
+      {
+        HOST_CHECK( left == 0 );
+      }
+    }
+  }
+
+  HOST_CHECK( osal_timer_num_active() == cnt );
+}
+
+
+/**************************************************************************************************
+ * @fn          testModel
+ *
+ * @brief       Random starts, restarts, stops and ticks against the model.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testModel( void )
+{
+  long step;
+  byte taskId, bit;
+
+  host_srand( 3 );
+
+  for ( step = 0; step < TEST_STEPS; step++ )
+  {
+    unsigned long op = host_rand() % 16;
+
+    taskId = (byte)(host_rand() % TEST_TASKS);
+    bit = (byte)(host_rand() % TEST_EVENTS);
+
+    if ( op < 4 )
+    {
+      modelStart( taskId, bit, (uint16)(host_rand() % TEST_MAXTO), (op == 0) );
+    }
+    else if ( op < 6 )
+    {
+      byte status = osal_stop_timerEx( taskId, (uint16)1 << bit );
+
+      HOST_CHECK( status == ((due[taskId][bit] != 0) ? ZSUCCESS : INVALID_EVENT_ID) );
+      due[taskId][bit] = 0;
+    }
+    else
+    {
+#if ( OSAL_TICKLESS )
+      modelTick( (op == 15) ? (uint16)(1 + host_rand() % TEST_GAP) : 1 );
+#else
+      modelTick( 1 );
+#endif
+    }
+
+    if ( (step % 64) == 0 )
+    {
+      modelCheck();
+    }
+  }
+
+  // Stop everything; the heap timers must all be freed.
+  for ( taskId = 0; taskId < TEST_TASKS; taskId++ )
+  {
+    for ( bit = 0; bit < TEST_EVENTS; bit++ )
+    {
+      osal_stop_timerEx( taskId, (uint16)1 << bit );
+      due[taskId][bit] = 0;
+    }
+    takeEvents( taskId );
+  }
+  modelCheck();
+}
+
+
+/**************************************************************************************************
+ * @fn          testLong
+ *
+ * @brief       Timeouts longer than OSAL_TIMERS_MAX_TIMEOUT, set as absolute deadlines, expire
+ *              on the right tick; a deadline already passed expires at the next tick.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void testLong( void )
+{
+  uint32 start = osal_GetSystemClock();
+  uint32 left;
+
+  HOST_CHECK( osal_start_timer_at( 1, 0x0001, start + 100000UL ) == ZSUCCESS );
+  HOST_CHECK( osal_start_timer_at( 1, 0x0002, start + 65536UL ) == ZSUCCESS );
+  HOST_CHECK( osal_start_timer_at( 1, 0x0004, start - 5 ) == ZSUCCESS );
+  HOST_CHECK( osal_get_timeoutEx( 1, 0x0001 ) == OSAL_TIMERS_MAX_TIMEOUT );
+
+  for ( left = 1; left <= 100000UL; left++ )
+  {
+    uint16 events;
+
+#if ( OSAL_TICKLESS )
+    hostTimerCount += TICK_HW_COUNT;
+#endif
+    osal_update_timers();
+    events = takeEvents( 1 );
+
+    if ( left == 1 )
+    {
+      HOST_CHECK( events == 0x0004 );
+    }
+    else if ( left == 65536UL )
+    {
+      HOST_CHECK( events == 0x0002 );
+    }
+    else if ( left == 100000UL )
+    {
+      HOST_CHECK( events == 0x0001 );
+    }
+    else if ( events != 0 )
+    {
+      HOST_CHECK( !"long timer expired early or late" );
+      break;
+    }
+  }
+
+  HOST_CHECK( osal_GetSystemClock() == start + 100000UL );
+  HOST_CHECK( osal_timer_num_active() == 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Run the timer tests.
+ *
+ * @param       none
+ *
+ * @return      0 if every check passed.
+ **************************************************************************************************
+ */
+int main( void )
+{
+  uint16 used;
+
+  osal_init_system();
+  used = osal_heap_mem_used();
+
+  testModel();
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  testLong();
+  HOST_CHECK( osal_heap_mem_used() == used );
+
+  return HOST_RESULT( "test_timers" );
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,386 @@
+/**************************************************************************************************
+    Filename:       mem_buckets.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Generate OSAL_MemBuckets.h, the small-block bucket layout of the
+    first-fit heap, from an OSALMEM_PROFILER profile:
+
+      mem_buckets profile.txt > OSAL_MemBuckets.h
+
+    The profile is written by mem_replay_pro from a capture, or by hand
+    from proMax[], proTot[] and proSmallBlkMiss[] read off the badge:
+
+      heap <MAXMEMHEAP>
+      bin <largest block> <most live at once> <allocations>    per bin
+      bucket <largest block> <misses>                          per bucket
+
+    Following the rules in OSAL_MemBuckets.h, a bucket boundary is a
+    small bin (blocks up to GEN_SMALL_MAX bytes) that takes GEN_HOT
+    percent or more of the allocations; a bucket also serves the colder
+    bins below it. A bucket gets the bytes its bins held at their peak,
+    plus 1/8, or 1/4 when a bucket of the same boundary missed more than
+    GEN_MISS percent in the profile. Of the layouts whose buckets fit in
+    GEN_SHARE percent of the heap, the one serving the most allocations
+    wins: a bucket squeezed below its peak only misses, and the heap it
+    takes is lost to the large blocks. The profiler bins are kept, so
+    every boundary stays a bin.
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define GEN_BINS       8     // OSALMEM_PRO_CNT.
+#define GEN_BUCKETS    4     // Most buckets generated.
+#define GEN_SMALL_MAX  128   // Largest block, header included, kept out of the wilderness.
+#define GEN_HOT        10    // Percent of all allocations that makes a bin a bucket.
+#define GEN_MISS       15    // Percent of misses past which a bucket gets more room.
+#define GEN_SHARE      25    // Most percent of the heap given to buckets.
+#define GEN_HDRSZ      2     // sizeof( osalMemHdr_t ).
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Typedefs
+ * ------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+  unsigned size;     // Largest block of the bin, header included.
+  unsigned maxLive;  // Most blocks of the bin live at once.
+  unsigned long tot; // Allocations of the bin.
+} genBin_t;
+
+typedef struct
+{
+  unsigned blkSz;    // Largest block of the bucket.
+  unsigned long len; // Bytes of the bucket.
+} genBucket_t;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static unsigned heapLen;
+static genBin_t bin[GEN_BINS];
+static unsigned binCnt;
+
+// Buckets of the profiled layout and their misses.
+static unsigned oldBlkSz[GEN_BUCKETS * 2];
+static unsigned long oldMiss[GEN_BUCKETS * 2];
+static unsigned oldCnt;
+
+static genBucket_t bkt[GEN_BUCKETS];
+static unsigned bktCnt;
+
+
+/**************************************************************************************************
+ * @fn          genRead
+ *
+ * @brief       Read a profile.
+ *
+ * @param       in - profile.
+ *
+ * @return      0 on success, 1 if the profile is not usable.
+ **************************************************************************************************
+ */
+static int genRead( FILE *in )
+{
+  char line[128];
+
+  while ( fgets( line, sizeof( line ), in ) != NULL )
+  {
+    unsigned a, b;
+    unsigned long c;
+
+    if ( sscanf( line, "heap %u", &a ) == 1 )
+    {
+      heapLen = a;
+    }
+    else if ( sscanf( line, "bin %u %u %lu", &a, &b, &c ) == 3 )
+    {
+      if ( (binCnt == GEN_BINS) || ((binCnt != 0) && (a <= bin[binCnt - 1].size)) )
+      {
+        return 1;
+      }
+      bin[binCnt].size = a;
+      bin[binCnt].maxLive = b;
+      bin[binCnt].tot = c;
+      binCnt++;
+    }
+    else if ( sscanf( line, "bucket %u %lu", &a, &c ) == 2 )
+    {
+      if ( oldCnt < (GEN_BUCKETS * 2) )
+      {
+        oldBlkSz[oldCnt] = a;
+        oldMiss[oldCnt] = c;
+        oldCnt++;
+      }
+    }
+  }
+
+  return ( (heapLen == 0) || (binCnt != GEN_BINS) );
+}
+
+
+/**************************************************************************************************
+ * @fn          genMissRate
+ *
+ * @brief       Miss rate, in percent, of the profiled bucket with a given boundary.
+ *
+ * @param       blkSz - largest block of the bucket.
+ *
+ * @return      Percent of the allocations of its bins that missed; 0 if there was no such bucket.
+ **************************************************************************************************
+ */
+static unsigned genMissRate( unsigned blkSz )
+{
+  unsigned long tot = 0;
+  unsigned lower;
+  unsigned old, idx;
+
+  for ( old = 0; (old < oldCnt) && (oldBlkSz[old] != blkSz); old++ )
+  {
+  }
+  if ( old == oldCnt )
+  {
+    return 0;
+  }
+
+  lower = (old != 0) ? oldBlkSz[old - 1] : 0;
+  for ( idx = 0; idx < binCnt; idx++ )
+  {
+    if ( (bin[idx].size > lower) && (bin[idx].size <= blkSz) )
+    {
+      tot += bin[idx].tot;
+    }
+  }
+
+  return ( tot ? (unsigned)(100 * oldMiss[old] / tot) : 0 );
+}
+
+
+/**************************************************************************************************
+ * @fn          genLayout
+ *
+ * @brief       Place and size the buckets. Every set of hot small bins is tried as the bucket
+ *              boundaries; of the sets whose buckets fit whole in GEN_SHARE percent of the heap,
+ *              the one that serves the most allocations from buckets wins, the smaller on a tie.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void genLayout( void )
+{
+  unsigned long need[GEN_BINS];
+  unsigned long limit = (unsigned long)heapLen * GEN_SHARE / 100;
+  unsigned long all = 0;
+  unsigned long bestTot = 0, bestLen = 0;
+  unsigned hot = 0, best = 0;
+  unsigned small, set, idx;
+
+  for ( idx = 0; idx < binCnt; idx++ )
+  {
+    unsigned lower = (idx != 0) ? bin[idx - 1].size : 0;
+
+    // The blocks of a bin are taken to be halfway between its bounds on average.
+    need[idx] = (unsigned long)bin[idx].maxLive * (lower + bin[idx].size + 1) / 2;
+    all += bin[idx].tot;
+  }
+
+  for ( small = 0; (small < binCnt) && (bin[small].size <= GEN_SMALL_MAX); small++ )
+  {
+    if ( (all != 0) && ((bin[small].tot * 100 / all) >= GEN_HOT) )
+    {
+      hot |= 1U << small;
+    }
+  }
+
+  for ( set = hot; set != 0; set = (set - 1) & hot )
+  {
+    unsigned long tot = 0, len = 0, peak = 0, part = 0;
+    unsigned cnt = 0;
+
+    for ( idx = 0; idx < small; idx++ )
+    {
+      peak += need[idx];
+      part += bin[idx].tot;
+      if ( set & (1U << idx) )
+      {
+        unsigned miss = genMissRate( bin[idx].size );
+
+        len += peak + peak / ((miss > GEN_MISS) ? 4 : 8) + GEN_HDRSZ;
+        tot += part;
+        peak = part = 0;
+        cnt++;
+      }
+    }
+
+    if ( (cnt <= GEN_BUCKETS) && (len <= limit) &&
+         ((tot > bestTot) || ((tot == bestTot) && (len < bestLen))) )
+    {
+      best = set;
+      bestTot = tot;
+      bestLen = len;
+    }
+  }
+
+  if ( best == 0 )
+  {
+    // Nothing small is allocated often: one bucket of the smallest bin, as the default.
+    bkt[0].blkSz = bin[0].size;
+    bkt[0].len = 232;
+    bktCnt = 1;
+    return;
+  }
+
+  {
+    unsigned long peak = 0;
+
+    for ( idx = 0; idx < small; idx++ )
+    {
+      peak += need[idx];
+      if ( best & (1U << idx) )
+      {
+        unsigned miss = genMissRate( bin[idx].size );
+
+        bkt[bktCnt].blkSz = bin[idx].size;
+        bkt[bktCnt].len = peak + peak / ((miss > GEN_MISS) ? 4 : 8);
+
+        // A whole number of headers, and room for at least one block.
+        bkt[bktCnt].len += bkt[bktCnt].len % GEN_HDRSZ;
+        if ( bkt[bktCnt].len < (bkt[bktCnt].blkSz + GEN_HDRSZ) )
+        {
+          bkt[bktCnt].len = bkt[bktCnt].blkSz + GEN_HDRSZ;
+        }
+        bktCnt++;
+        peak = 0;
+      }
+    }
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          genWrite
+ *
+ * @brief       Write OSAL_MemBuckets.h.
+ *
+ * @param       name - profile file name, for the notes.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void genWrite( const char *name )
+{
+  unsigned idx;
+
+  printf( "#ifndef OSAL_MEMBUCKETS_H\n"
+          "#define OSAL_MEMBUCKETS_H\n\n"
+          "/*********************************************************************\n"
+          "    Filename:       OSAL_MemBuckets.h\n\n"
+          "    Description:    Small-block bucket layout of the first-fit heap,\n"
+          "                    used by osal_mem_init().\n\n"
+          "    Notes:\n\n"
+          "    Generated by mem_buckets from %s, a %u byte heap:\n\n", name, heapLen );
+  printf( "      bin      max live  allocations\n" );
+  for ( idx = 0; idx < binCnt; idx++ )
+  {
+    printf( "      %5u  %9u  %11lu\n", bin[idx].size, bin[idx].maxLive, bin[idx].tot );
+  }
+  printf( "*********************************************************************/\n\n"
+          "/*********************************************************************\n"
+          " * CONSTANTS\n"
+          " */\n\n" );
+
+  printf( "#if !defined ( OSALMEM_BUCKET_CNT )\n"
+          "// Number of small-block buckets, laid out from the bottom of the heap.\n"
+          "#define OSALMEM_BUCKET_CNT    %u\n\n"
+          "// Largest block, including its header, first tried in each bucket.\n"
+          "#define OSALMEM_BUCKET_BLKSZ  ", bktCnt );
+  for ( idx = 0; idx < bktCnt; idx++ )
+  {
+    printf( "%s%u", idx ? ", " : "", bkt[idx].blkSz );
+  }
+  printf( "\n\n// Bytes of heap given to each bucket.\n"
+          "#define OSALMEM_BUCKET_LEN    " );
+  for ( idx = 0; idx < bktCnt; idx++ )
+  {
+    printf( "%s%lu", idx ? ", " : "", bkt[idx].len );
+  }
+  printf( "\n#endif\n\n" );
+
+  printf( "#if !defined ( OSALMEM_PRO_BINS )\n"
+          "// Upper block size of each of the 8 OSALMEM_PROFILER bins.\n"
+          "#define OSALMEM_PRO_BINS      " );
+  for ( idx = 0; idx < binCnt; idx++ )
+  {
+    printf( "%s%u", idx ? ", " : "", bin[idx].size );
+  }
+  printf( "\n#endif\n\n"
+          "/*********************************************************************\n"
+          "*********************************************************************/\n\n"
+          "#endif /* OSAL_MEMBUCKETS_H */\n" );
+}
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Read a profile and write the bucket layout to stdout.
+ *
+ * @param       argc - 2.
+ * @param       argv - profile file name in argv[1].
+ *
+ * @return      0 on success, 1 if the profile could not be used.
+ **************************************************************************************************
+ */
+int main( int argc, char **argv )
+{
+  FILE *in;
+  int bad;
+
+  if ( argc != 2 )
+  {
+    fprintf( stderr, "usage: %s profile.txt > OSAL_MemBuckets.h\n", argv[0] );
+    return 1;
+  }
+
+  in = fopen( argv[1], "r" );
+  if ( in == NULL )
+  {
+    perror( argv[1] );
+    return 1;
+  }
+  bad = genRead( in );
+  fclose( in );
+
+  if ( bad )
+  {
+    fprintf( stderr, "%s: needs a heap line and %u bins of increasing size\n", argv[1], GEN_BINS );
+    return 1;
+  }
+
+  genLayout();
+  genWrite( argv[1] );
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
@@ -0,0 +1,498 @@
+/**************************************************************************************************
+    Filename:       mem_replay.c
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:
+
+    Replay a heap trace captured from the badge (OSALMEM_TRACE, see
+    OSAL_Memory.h) against the osal_mem_* build this tool is linked
+    with, one binary per OSALMEM_ALLOCATOR:
+
+      mem_replay_tlsf capture.bin
+
+    The capture is the raw byte stream of the trace UART port. Records
+    are found by their sync nibble and checked field by field, so
+    application output sharing the port is skipped. Every allocation is
+    replayed, freed by the heap offset it had on the badge; allocations
+    that failed on the badge are retried and freed at once if they now
+    succeed. An in-place osal_mem_realloc() shows as a free and an
+    allocation at the same offset and is replayed as such.
+
+    Reported: fragmentation as the largest free block after each event,
+    peak heap usage, allocation failures, and per-call latency
+    percentiles in host cycles. The trace is replayed REPLAY_REPS times
+    and the cheapest time of every call is kept, which takes out cache
+    misses and host interrupts.
+
+    The host heap is MAXMEMHEAP bytes; build with the badge's value
+    (make replay HEAP=<INT_HEAP_LEN>) for the figures to carry over.
+
+    Built with OSALMEM_PROFILER on the first-fit heap, the miss rate of
+    every small-block bucket is reported too, and the profile of one
+    replay can be written out for mem_buckets:
+
+      mem_replay_pro capture.bin profile.txt
+**************************************************************************************************/
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OSAL_MemBuckets.h"
+#include "OnBoard.h"
+#include "host_test.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Constants
+ * ------------------------------------------------------------------------------------------------
+ */
+#define REPLAY_REPS  5
+
+static const char *allocName[] = { "first-fit", "segfit", "tlsf" };
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Typedefs
+ * ------------------------------------------------------------------------------------------------
+ */
+typedef struct
+{
+  byte kind;     // OSALMEM_TRACE_ALOC .. OSALMEM_TRACE_LOST.
+  byte task;     // osal_self() on the badge.
+  uint16 size;   // Bytes requested, block size freed, or records lost.
+  uint16 off;    // Payload heap offset on the badge.
+} replayEvt_t;
+
+typedef struct
+{
+  unsigned long long *cost;  // Cheapest cycles per call.
+  unsigned long cnt;
+} replayLat_t;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static replayEvt_t *evt;
+static unsigned long evtCnt;
+
+// Replayed block of each badge heap offset.
+static void *byOff[0x10000];
+
+
+/**************************************************************************************************
+ * @fn          replayParse
+ *
+ * @brief       Pull the trace records out of a capture.
+ *
+ * @param       buf - capture bytes.
+ * @param       len - capture length.
+ *
+ * @return      Bytes skipped as not part of a record.
+ **************************************************************************************************
+ */
+static unsigned long replayParse( const byte *buf, unsigned long len )
+{
+  unsigned long skipped = 0;
+  unsigned long i = 0;
+
+  evt = malloc( (len / OSALMEM_TRACE_RECSZ + 1) * sizeof( replayEvt_t ) );
+
+  while ( (i + OSALMEM_TRACE_RECSZ) <= len )
+  {
+    const byte *rec = buf + i;
+    byte kind = rec[0] & 0x0F;
+    uint16 size = BUILD_UINT16( rec[2], rec[3] );
+    uint16 off = BUILD_UINT16( rec[4], rec[5] );
+    byte ok;
+
+    switch ( kind )
+    {
+      case OSALMEM_TRACE_ALOC:
+        ok = (size != 0) && (off != 0xFFFF);
+        break;
+
+      case OSALMEM_TRACE_FREE:
+        ok = (size != 0) && (off != 0xFFFF);
+        break;
+
+      case OSALMEM_TRACE_FAIL:
+      case OSALMEM_TRACE_LOST:
+        ok = (size != 0) && (off == 0xFFFF);
+        break;
+
+      default:
+        ok = FALSE;
+        break;
+    }
+
+    if ( ((rec[0] & 0xF0) != OSALMEM_TRACE_SYNC) || !ok )
+    {
+      skipped++;
+      i++;
+      continue;
+    }
+
+    evt[evtCnt].kind = kind;
+    evt[evtCnt].task = rec[1];
+    evt[evtCnt].size = size;
+    evt[evtCnt].off = off;
+    evtCnt++;
+    i += OSALMEM_TRACE_RECSZ;
+  }
+
+  return skipped + (len - i);
+}
+
+
+/**************************************************************************************************
+ * @fn          replayCmp
+ *
+ * @brief       qsort() order of call costs.
+ *
+ * @param       a, b - costs.
+ *
+ * @return      <0, 0, >0.
+ **************************************************************************************************
+ */
+static int replayCmp( const void *a, const void *b )
+{
+  unsigned long long x = *(const unsigned long long *)a;
+  unsigned long long y = *(const unsigned long long *)b;
+
+  return ( (x > y) - (x < y) );
+}
+
+
+/**************************************************************************************************
+ * @fn          replayLatency
+ *
+ * @brief       Print the latency percentiles of one kind of call.
+ *
+ * @param       name - call name.
+ * @param       lat - cheapest cost of every call.
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void replayLatency( const char *name, replayLat_t *lat )
+{
+  unsigned long n = lat->cnt;
+
+  if ( n == 0 )
+  {
+    printf( "  %-7s no calls\n", name );
+    return;
+  }
+
+  qsort( lat->cost, n, sizeof( unsigned long long ), replayCmp );
+  printf( "  %-7s %8lu calls  p50 %5llu  p90 %5llu  p99 %5llu  p99.9 %5llu  max %6llu cycles\n",
+          name, n, lat->cost[n / 2], lat->cost[n * 9 / 10], lat->cost[n * 99 / 100],
+          lat->cost[n * 999 / 1000], lat->cost[n - 1] );
+}
+
+
+#if ( OSALMEM_PROFILER )
+/**************************************************************************************************
+ * @fn          replayMiss
+ *
+ * @brief       Print the miss rate of every small-block bucket: allocations it could not serve,
+ *              of all the allocations of its profiler bins.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void replayMiss( void )
+{
+  static const uint16 blkSz[OSALMEM_BUCKET_CNT] = { OSALMEM_BUCKET_BLKSZ };
+  static const uint16 len[OSALMEM_BUCKET_CNT] = { OSALMEM_BUCKET_LEN };
+  uint16 lower = 0;
+  byte bkt;
+
+  for ( bkt = 0; bkt < OSALMEM_BUCKET_CNT; bkt++ )
+  {
+    unsigned long tot = 0;
+    uint16 maxLive, total, size;
+    uint16 miss = osal_mem_pro_miss( bkt );
+    byte bin;
+
+    for ( bin = 0; (size = osal_mem_pro_bin( bin, &maxLive, &total )) != 0; bin++ )
+    {
+      if ( (size > lower) && (size <= blkSz[bkt]) )
+      {
+        tot += total;
+      }
+    }
+
+    // The counters run on over every osal_mem_init(): report one replay.
+    printf( "  bucket  blocks %3u..%-3u in %4u bytes: %5u of %6lu allocations missed (%.1f%%)\n",
+            lower + 1, blkSz[bkt], len[bkt], miss / REPLAY_REPS, tot / REPLAY_REPS,
+            tot ? (100.0 * miss / tot) : 0.0 );
+    lower = blkSz[bkt];
+  }
+}
+
+
+/**************************************************************************************************
+ * @fn          replayProfile
+ *
+ * @brief       Write the profile of one replay, as mem_buckets reads it.
+ *
+ * @param       name - file name.
+ *
+ * @return      0 on success, 1 if the file could not be written.
+ **************************************************************************************************
+ */
+static int replayProfile( const char *name )
+{
+  static const uint16 blkSz[OSALMEM_BUCKET_CNT] = { OSALMEM_BUCKET_BLKSZ };
+  uint16 maxLive, total, size;
+  byte bin, bkt;
+  FILE *out;
+
+  out = fopen( name, "w" );
+  if ( out == NULL )
+  {
+    perror( name );
+    return 1;
+  }
+
+  // As in replayMiss(), the totals are of one replay.
+  fprintf( out, "heap %u\n", MAXMEMHEAP );
+  for ( bin = 0; (size = osal_mem_pro_bin( bin, &maxLive, &total )) != 0; bin++ )
+  {
+    fprintf( out, "bin %u %u %u\n", size, maxLive, total / REPLAY_REPS );
+  }
+  for ( bkt = 0; bkt < OSALMEM_BUCKET_CNT; bkt++ )
+  {
+    fprintf( out, "bucket %u %u\n", blkSz[bkt], osal_mem_pro_miss( bkt ) / REPLAY_REPS );
+  }
+
+  fclose( out );
+  return 0;
+}
+#endif
+
+
+/**************************************************************************************************
+ * @fn          main
+ *
+ * @brief       Replay a capture and report.
+ *
+ * @param       argc - 2, or 3 with a profile to write.
+ * @param       argv - capture file name in argv[1], profile file name in argv[2].
+ *
+ * @return      0 on success, 1 if the capture could not be used.
+ **************************************************************************************************
+ */
+int main( int argc, char **argv )
+{
+  replayLat_t lat[2];
+  unsigned long long sumLargest = 0;
+  unsigned long fails = 0, badgeFails = 0, recovered = 0;
+  unsigned long unmatched = 0, lost = 0, skipped;
+  unsigned long live = 0, peakLive = 0;
+  uint16 peakUsed = 0;
+  uint16 minLargest = 0xFFFF;
+  uint16 fresh;
+  unsigned long len;
+  byte *buf;
+  byte rep;
+  FILE *in;
+
+#if ( OSALMEM_PROFILER )
+  if ( (argc != 2) && (argc != 3) )
+  {
+    fprintf( stderr, "usage: %s capture.bin [profile.txt]\n", argv[0] );
+    return 1;
+  }
+#else
+  if ( argc != 2 )
+  {
+    fprintf( stderr, "usage: %s capture.bin\n", argv[0] );
+    return 1;
+  }
+#endif
+
+  in = fopen( argv[1], "rb" );
+  if ( in == NULL )
+  {
+    perror( argv[1] );
+    return 1;
+  }
+  fseek( in, 0, SEEK_END );
+  len = (unsigned long)ftell( in );
+  fseek( in, 0, SEEK_SET );
+  buf = malloc( len + 1 );
+  len = (unsigned long)fread( buf, 1, len, in );
+  fclose( in );
+
+  skipped = replayParse( buf, len );
+  free( buf );
+
+  if ( evtCnt == 0 )
+  {
+    fprintf( stderr, "%s: no trace records\n", argv[1] );
+    return 1;
+  }
+
+  lat[0].cost = malloc( evtCnt * sizeof( unsigned long long ) );
+  lat[1].cost = malloc( evtCnt * sizeof( unsigned long long ) );
+
+  osal_mem_init();
+  fresh = osal_heap_largest_free();
+
+  for ( rep = 0; rep < REPLAY_REPS; rep++ )
+  {
+    const byte last = (rep == (REPLAY_REPS - 1));
+    unsigned long n;
+
+    osal_mem_init();
+    memset( byOff, 0, sizeof( byOff ) );
+    lat[0].cnt = lat[1].cnt = 0;
+    live = 0;
+
+    for ( n = 0; n < evtCnt; n++ )
+    {
+      replayEvt_t *e = &evt[n];
+      unsigned long long t0, t;
+      void *ptr;
+
+      switch ( e->kind )
+      {
+        case OSALMEM_TRACE_ALOC:
+        case OSALMEM_TRACE_FAIL:
+          if ( (e->kind == OSALMEM_TRACE_ALOC) && (byOff[e->off] != NULL) )
+          {
+            // The free of the previous block here was lost on the badge.
+            osal_mem_free( byOff[e->off] );
+            byOff[e->off] = NULL;
+            live--;
+          }
+
+          t0 = host_cycles();
+          ptr = osal_mem_alloc( e->size );
+          t = host_cycles() - t0;
+
+          if ( (rep == 0) || (lat[0].cost[lat[0].cnt] > t) )
+          {
+            lat[0].cost[lat[0].cnt] = t;
+          }
+          lat[0].cnt++;
+
+          if ( e->kind == OSALMEM_TRACE_FAIL )
+          {
+            if ( last )
+            {
+              badgeFails++;
+              recovered += (ptr != NULL);
+            }
+            if ( ptr != NULL )
+            {
+              osal_mem_free( ptr );
+            }
+          }
+          else if ( ptr != NULL )
+          {
+            byOff[e->off] = ptr;
+            live++;
+          }
+
+          if ( last && (ptr == NULL) )
+          {
+            fails++;
+          }
+          break;
+
+        case OSALMEM_TRACE_FREE:
+          ptr = byOff[e->off];
+          if ( ptr == NULL )
+          {
+            // Allocation lost on the badge, or failed in the replay.
+            unmatched += last;
+            break;
+          }
+
+          t0 = host_cycles();
+          osal_mem_free( ptr );
+          t = host_cycles() - t0;
+
+          if ( (rep == 0) || (lat[1].cost[lat[1].cnt] > t) )
+          {
+            lat[1].cost[lat[1].cnt] = t;
+          }
+          lat[1].cnt++;
+
+          byOff[e->off] = NULL;
+          live--;
+          break;
+
+        default:
+          lost += (last) ? e->size : 0;
+          break;
+      }
+
+      if ( last )
+      {
+        uint16 largest = osal_heap_largest_free();
+
+        if ( minLargest > largest )
+        {
+          minLargest = largest;
+        }
+        sumLargest += largest;
+
+        if ( peakUsed < osal_heap_mem_used() )
+        {
+          peakUsed = osal_heap_mem_used();
+        }
+        if ( peakLive < live )
+        {
+          peakLive = live;
+        }
+      }
+    }
+
+    // Blocks still held at the end of the capture; the heap metrics carry over osal_mem_init().
+    for ( n = 0; n < 0x10000; n++ )
+    {
+      if ( byOff[n] != NULL )
+      {
+        osal_mem_free( byOff[n] );
+      }
+    }
+  }
+
+  printf( "%s: %lu records, %lu bytes skipped, %lu records lost on the badge, "
+          "%lu unmatched frees\n", argv[1], evtCnt, skipped, lost, unmatched );
+  printf( "%s heap of %u bytes:\n", allocName[OSALMEM_ALLOCATOR], MAXMEMHEAP );
+  printf( "  peak    %u bytes in %lu blocks\n", peakUsed, peakLive );
+  printf( "  failed  %lu allocations; on the badge %lu, of which %lu succeed here\n",
+          fails, badgeFails, recovered );
+  printf( "  largest free block min %u, avg %llu, fresh heap %u bytes\n",
+          minLargest, sumLargest / evtCnt, fresh );
+  replayLatency( "alloc", &lat[0] );
+  replayLatency( "free", &lat[1] );
+
+#if ( OSALMEM_PROFILER )
+  replayMiss();
+  if ( argc == 3 )
+  {
+    return replayProfile( argv[2] );
+  }
+#endif
+
+  return 0;
+}
+
+
+/**************************************************************************************************
+*/
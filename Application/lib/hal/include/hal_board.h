@@ -1 +1 @@
-#include "hal_board_cfg.h"
+#include "hal_board_cfg.h"
@@ -1,95 +1,95 @@
-/**************************************************************************************************
-    Filename: hal_defs.h
-    Revised:        $Date: 2006-08-17 16:27:51 -0700 (Thu, 17 Aug 2006) $
-    Revision:       $Revision: 11834 $
-
-    Description:  This file contains useful macros and data types
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-**************************************************************************************************/
-
-#ifndef HAL_DEFS_H
-#define HAL_DEFS_H
-
-
-/* ------------------------------------------------------------------------------------------------
- *                                             Macros
- * ------------------------------------------------------------------------------------------------
- */
-
-#ifndef BV
-#define BV(n)      (1 << (n))
-#endif
-
-#ifndef BF
-#define BF(x,b,s)  (((x) & (b)) >> (s))
-#endif
-
-#ifndef MIN
-#define MIN(n,m)   (((n) < (m)) ? (n) : (m))
-#endif
-
-#ifndef MAX
-#define MAX(n,m)   (((n) < (m)) ? (m) : (n))
-#endif
-
-#ifndef ABS
-#define ABS(n)     (((n) < 0) ? -(n) : (n))
-#endif
-
-
-/* takes a byte out of a uint32 : var - uint32,  ByteNum - byte to take out (0 - 3) */
-#define BREAK_UINT32( var, ByteNum ) \
-          (byte)((uint32)(((var) >>((ByteNum) * 8)) & 0x00FF))
-
-#define BUILD_UINT32(Byte0, Byte1, Byte2, Byte3) \
-          ((uint32)((uint32)((Byte0) & 0x00FF) \
-          + ((uint32)((Byte1) & 0x00FF) << 8) \
-          + ((uint32)((Byte2) & 0x00FF) << 16) \
-          + ((uint32)((Byte3) & 0x00FF) << 24)))
-
-#define BUILD_UINT16(loByte, hiByte) \
-          ((uint16)(((loByte) & 0x00FF) + (((hiByte) & 0x00FF) << 8)))
-
-#define HI_UINT16(a) (((a) >> 8) & 0xFF)
-#define LO_UINT16(a) ((a) & 0xFF)
-
-#define BUILD_UINT8(hiByte, loByte) \
-          ((uint8)(((loByte) & 0x0F) + (((hiByte) & 0x0F) << 4)))
-
-#define HI_UINT8(a) (((a) >> 4) & 0x0F)
-#define LO_UINT8(a) ((a) & 0x0F)
-
-/*
- *  This macro is for use by other macros to form a fully valid C statement.
- *  Without this, the if/else conditionals could show unexpected behavior.
- *
- *  For example, use...
- *    #define SET_REGS()  st( ioreg1 = 0; ioreg2 = 0; )
- *  instead of ...
- *    #define SET_REGS()  { ioreg1 = 0; ioreg2 = 0; }
- *  or
- *    #define  SET_REGS()    ioreg1 = 0; ioreg2 = 0;
- *  The last macro would not behave as expected in the if/else construct.
- *  The second to last macro will cause a compiler error in certain uses
- *  of if/else construct
- *
- *  It is not necessary, or recommended, to use this macro where there is
- *  already a valid C statement.  For example, the following is redundant...
- *    #define CALL_FUNC()   st(  func();  )
- *  This should simply be...
- *    #define CALL_FUNC()   func()
- *
- * (The while condition below evaluates false without generating a
- *  constant-controlling-loop type of warning on most compilers.)
- */
-#define st(x)      do { x } while (__LINE__ == -1)
-
-
-/**************************************************************************************************
- */
-#endif
+/**************************************************************************************************
+    Filename: hal_defs.h
+    Revised:        $Date: 2006-08-17 16:27:51 -0700 (Thu, 17 Aug 2006) $
+    Revision:       $Revision: 11834 $
+
+    Description:  This file contains useful macros and data types
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+**************************************************************************************************/
+
+#ifndef HAL_DEFS_H
+#define HAL_DEFS_H
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                             Macros
+ * ------------------------------------------------------------------------------------------------
+ */
+
+#ifndef BV
+#define BV(n)      (1 << (n))
+#endif
+
+#ifndef BF
+#define BF(x,b,s)  (((x) & (b)) >> (s))
+#endif
+
+#ifndef MIN
+#define MIN(n,m)   (((n) < (m)) ? (n) : (m))
+#endif
+
+#ifndef MAX
+#define MAX(n,m)   (((n) < (m)) ? (m) : (n))
+#endif
+
+#ifndef ABS
+#define ABS(n)     (((n) < 0) ? -(n) : (n))
+#endif
+
+
+/* takes a byte out of a uint32 : var - uint32,  ByteNum - byte to take out (0 - 3) */
+#define BREAK_UINT32( var, ByteNum ) \
+          (byte)((uint32)(((var) >>((ByteNum) * 8)) & 0x00FF))
+
+#define BUILD_UINT32(Byte0, Byte1, Byte2, Byte3) \
+          ((uint32)((uint32)((Byte0) & 0x00FF) \
+          + ((uint32)((Byte1) & 0x00FF) << 8) \
+          + ((uint32)((Byte2) & 0x00FF) << 16) \
+          + ((uint32)((Byte3) & 0x00FF) << 24)))
+
+#define BUILD_UINT16(loByte, hiByte) \
+          ((uint16)(((loByte) & 0x00FF) + (((hiByte) & 0x00FF) << 8)))
+
+#define HI_UINT16(a) (((a) >> 8) & 0xFF)
+#define LO_UINT16(a) ((a) & 0xFF)
+
+#define BUILD_UINT8(hiByte, loByte) \
+          ((uint8)(((loByte) & 0x0F) + (((hiByte) & 0x0F) << 4)))
+
+#define HI_UINT8(a) (((a) >> 4) & 0x0F)
+#define LO_UINT8(a) ((a) & 0x0F)
+
+/*
+ *  This macro is for use by other macros to form a fully valid C statement.
+ *  Without this, the if/else conditionals could show unexpected behavior.
+ *
+ *  For example, use...
+ *    #define SET_REGS()  st( ioreg1 = 0; ioreg2 = 0; )
+ *  instead of ...
+ *    #define SET_REGS()  { ioreg1 = 0; ioreg2 = 0; }
+ *  or
+ *    #define  SET_REGS()    ioreg1 = 0; ioreg2 = 0;
+ *  The last macro would not behave as expected in the if/else construct.
+ *  The second to last macro will cause a compiler error in certain uses
+ *  of if/else construct
+ *
+ *  It is not necessary, or recommended, to use this macro where there is
+ *  already a valid C statement.  For example, the following is redundant...
+ *    #define CALL_FUNC()   st(  func();  )
+ *  This should simply be...
+ *    #define CALL_FUNC()   func()
+ *
+ * (The while condition below evaluates false without generating a
+ *  constant-controlling-loop type of warning on most compilers.)
+ */
+#define st(x)      do { x } while (__LINE__ == -1)
+
+
+/**************************************************************************************************
+ */
+#endif
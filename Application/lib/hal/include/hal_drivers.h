@@ -1,85 +1,85 @@
-#ifndef HAL_DRIVER_H
-#define HAL_DRIVER_H
-
-/**************************************************************************************************
-  Filename:       hal_driver.h
-  Revised:        $Date: 2006-04-06 08:19:08 -0700 (Thu, 06 Apr 2006) $
-  Revision:       $Revision: 10396 $
-
-  Description:
-
-  This file contains the interface to the Drivers service.
-
-  Notes:
-
-  Copyright (c) 2006 by Texas Instruments, Inc.
-  All Rights Reserved.  Permission to use, reproduce, copy, prepare
-  derivative works, modify, distribute, perform, display or sell this
-  software and/or its documentation for any purpose is prohibited
-  without the express written consent of Texas Instruments, Inc.
-**************************************************************************************************/
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-/**************************************************************************************************
- * INCLUDES
- **************************************************************************************************/
-
-
-/**************************************************************************************************
- * MACROS
- **************************************************************************************************/
-
-
-
-/**************************************************************************************************
- * CONSTANTS
- **************************************************************************************************/
-#define HAL_KEY_EVENT         0x0001
-#define HAL_LED_BLINK_EVENT   0x0002
-
-/**************************************************************************************************
- * TYPEDEFS
- **************************************************************************************************/
-
-
-/**************************************************************************************************
- * GLOBAL VARIABLES
- **************************************************************************************************/
-extern uint8 Hal_TaskID;
-
-/**************************************************************************************************
- * FUNCTIONS - API
- **************************************************************************************************/
-
-/**************************************************************************************************
- * Serial Port Initialization
- **************************************************************************************************/
-extern void Hal_Init ( uint8 task_id );
-
-/*
- * Process Serial Buffer
- */
-extern uint16 Hal_ProcessEvent ( uint8 task_id, uint16 events );
-
-/*
- * Process Polls
- */
-extern void Hal_ProcessPoll (void);
-
-/*
- * Initialize HW
- */
-extern void HalDriverInit (void);
-
-/**************************************************************************************************
-**************************************************************************************************/
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
+#ifndef HAL_DRIVER_H
+#define HAL_DRIVER_H
+
+/**************************************************************************************************
+  Filename:       hal_driver.h
+  Revised:        $Date: 2006-04-06 08:19:08 -0700 (Thu, 06 Apr 2006) $
+  Revision:       $Revision: 10396 $
+
+  Description:
+
+  This file contains the interface to the Drivers service.
+
+  Notes:
+
+  Copyright (c) 2006 by Texas Instruments, Inc.
+  All Rights Reserved.  Permission to use, reproduce, copy, prepare
+  derivative works, modify, distribute, perform, display or sell this
+  software and/or its documentation for any purpose is prohibited
+  without the express written consent of Texas Instruments, Inc.
+**************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**************************************************************************************************
+ * INCLUDES
+ **************************************************************************************************/
+
+
+/**************************************************************************************************
+ * MACROS
+ **************************************************************************************************/
+
+
+
+/**************************************************************************************************
+ * CONSTANTS
+ **************************************************************************************************/
+#define HAL_KEY_EVENT         0x0001
+#define HAL_LED_BLINK_EVENT   0x0002
+
+/**************************************************************************************************
+ * TYPEDEFS
+ **************************************************************************************************/
+
+
+/**************************************************************************************************
+ * GLOBAL VARIABLES
+ **************************************************************************************************/
+extern uint8 Hal_TaskID;
+
+/**************************************************************************************************
+ * FUNCTIONS - API
+ **************************************************************************************************/
+
+/**************************************************************************************************
+ * Serial Port Initialization
+ **************************************************************************************************/
+extern void Hal_Init ( uint8 task_id );
+
+/*
+ * Process Serial Buffer
+ */
+extern uint16 Hal_ProcessEvent ( uint8 task_id, uint16 events );
+
+/*
+ * Process Polls
+ */
+extern void Hal_ProcessPoll (void);
+
+/*
+ * Initialize HW
+ */
+extern void HalDriverInit (void);
+
+/**************************************************************************************************
+**************************************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1 +1 @@
-/* empty */
+/* empty */
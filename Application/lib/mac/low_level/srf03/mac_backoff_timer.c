@@ -1,436 +1,704 @@
-/**************************************************************************************************
-    Filename:
-    Revised:        $Date: 2006-11-15 11:49:52 -0800 (Wed, 15 Nov 2006) $
-    Revision:       $Revision: 12720 $
-
-    Description:
-
-    Describe the purpose and contents of the file.
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-**************************************************************************************************/
-
-
-
-/* ------------------------------------------------------------------------------------------------
- *                                           Includes
- * ------------------------------------------------------------------------------------------------
- */
-
-/* hal */
-#include "hal_types.h"
-
-/* high-level specific */
-#include "mac_spec.h"
-
-/* exported low-level */
-#include "mac_low_level.h"
-
-/* low-level specific */
-#include "mac_backoff_timer.h"
-#include "mac_tx.h"
-
-/* target specific */
-#include "mac_radio_defs.h"
-
-/* debug */
-#include "mac_assert.h"
-
-
-/* ------------------------------------------------------------------------------------------------
- *                                            Defines
- * ------------------------------------------------------------------------------------------------
- */
-#define COMPARE_STATE_ROLLOVER_BV                 BV(0)
-#define COMPARE_STATE_TRIGGER_BV                  BV(1)
-#define COMPARE_STATE_ARM_BV                      BV(2)
-
-#define COMPARE_STATE_TRIGGER                     COMPARE_STATE_TRIGGER_BV
-#define COMPARE_STATE_ROLLOVER                    COMPARE_STATE_ROLLOVER_BV
-#define COMPARE_STATE_ROLLOVER_AND_TRIGGER        (COMPARE_STATE_ROLLOVER_BV | COMPARE_STATE_TRIGGER_BV)
-#define COMPARE_STATE_ROLLOVER_AND_ARM_TRIGGER    (COMPARE_STATE_ROLLOVER_BV | COMPARE_STATE_ARM_BV)
-
-
-/*
- *  The datasheet mentions a small delay on both receive and transmit side of approximately
- *  two microseconds.  The precise characterization is given below.
- *  (This data is not given in rev 1.03 datasheet)
- */
-#define RX_TX_PROP_DELAY_AVG_USEC         ((MAC_RADIO_RX_TX_PROP_DELAY_MIN_USEC + MAC_RADIO_RX_TX_PROP_DELAY_MAX_USEC) / 2)
-#define RX_TX_PROP_DELAY_AVG_TIMER_TICKS  ((uint16)(MAC_RADIO_TIMER_TICKS_PER_USEC() * RX_TX_PROP_DELAY_AVG_USEC + 0.5))
-
-/*
- *  For slotted receives, the SFD signal is expected to occur on a specifc symbol boundary.
- *  This does *not* correspond to the backoff boundary.  The SFD signal occurs at an
- *  offset from the backoff boundary.  This is done for efficiency of related algorithms.
- *
- *  Once transmit is strobed there is a fixed delay until the SFD signal occurs.  The frame
- *  does not start over-the-air transmit until after an internal radio delay of 12 symbols.
- *  Once transmitting over-the-air, the preamble is sent (8 symbols) followed by the
- *  SFD field (2 symbols). After the SFD field completes, the SFD signal occurs.  This
- *  adds up to a total of 22 symbols from strobe to SFD signal.
- *
- *  Since 22 symbols spans more than a backoff (20 symbols) the modulus operation is used
- *  to find the symbol offset which is 2 symbols.
- *
- *  This math is derived formally via the pre-processor.
- */
-#define SYMBOLS_FROM_STROBE_TO_PREAMBLE   12 /* from datasheet */
-#define SYMBOLS_FROM_PREAMBLE_TO_SFD      (MAC_SPEC_PREAMBLE_FIELD_LENGTH + MAC_SPEC_SFD_FIELD_LENGTH)
-#define SYMBOLS_FROM_STROBE_TO_SFD        (SYMBOLS_FROM_STROBE_TO_PREAMBLE + SYMBOLS_FROM_PREAMBLE_TO_SFD)
-#define SYMBOLS_EXPECTED_AT_SFD           (SYMBOLS_FROM_STROBE_TO_SFD % MAC_A_UNIT_BACKOFF_PERIOD)
-
-/* after all that formal math, make sure the result is as expected */
-#if (SYMBOLS_EXPECTED_AT_SFD != 2)
-#error "ERROR! Internal problem with pre-processor math of slotted alignment."
-#endif
-
-
-/*
- *  The expected SFD signal occurs at the symbol offset *plus* a small internal propagation delay
- *  internal to the radio.  This delay is given as the sum of a receive side delay and a transmit
- *  side delay.  When this delay is subtracted from the internal timer, the internal time base
- *  actually becomes the actual receive time *minus* the transmit delay.  This works out though.
- *  The transmit logic does *not* take into account this delay.  Since the timer is skewed by the
- *  transmit delay already, the transmits go out precisely on time.
- */
-#define TIMER_TICKS_EXPECTED_AT_SFD   ((SYMBOLS_EXPECTED_AT_SFD * MAC_RADIO_TIMER_TICKS_PER_SYMBOL()) \
-                                          + RX_TX_PROP_DELAY_AVG_TIMER_TICKS)
-
-
-/* ------------------------------------------------------------------------------------------------
- *                                         Local Variables
- * ------------------------------------------------------------------------------------------------
- */
-static uint32 backoffTimerRollover;
-static uint32 backoffTimerTrigger;
-static uint8 compareState;
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerInit
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-void macBackoffTimerInit(void)
-{
-  compareState = COMPARE_STATE_ROLLOVER;
-  MAC_RADIO_BACKOFF_SET_COUNT(0);
-  macBackoffTimerSetRollover(MAC_BACKOFF_TIMER_DEFAULT_ROLLOVER);
-  MAC_RADIO_BACKOFF_COMPARE_CLEAR_INTERRUPT();
-  MAC_RADIO_BACKOFF_COMPARE_ENABLE_INTERRUPT();
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerReset
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-void macBackoffTimerReset(void)
-{
-  MAC_RADIO_BACKOFF_COMPARE_DISABLE_INTERRUPT();
-  macBackoffTimerInit();
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerSetRollover
- *
- * @brief       Set rollover count of backoff timer.
- *
- * @param       rolloverBackoff - backoff count where count is reset to zero
- *
- * @return      none
- **************************************************************************************************
- */
-void macBackoffTimerSetRollover(uint32 rolloverBackoff)
-{
-  halIntState_t  s;
-
-  MAC_ASSERT(rolloverBackoff > MAC_RADIO_BACKOFF_COUNT());  /* rollover value must be greater than count */
-
-  HAL_ENTER_CRITICAL_SECTION(s);
-  backoffTimerRollover = rolloverBackoff;
-  MAC_RADIO_BACKOFF_SET_COMPARE(rolloverBackoff);
-  HAL_EXIT_CRITICAL_SECTION(s);
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerSetCount
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-void macBackoffTimerSetCount(uint32 backoff)
-{
-  halIntState_t  s;
-
-  MAC_ASSERT(compareState == COMPARE_STATE_ROLLOVER);   /* trigger cannot be active if changing count */
-  MAC_ASSERT(backoff < backoffTimerRollover);  /* count must be less than rollover value */
-
-  HAL_ENTER_CRITICAL_SECTION(s);
-  MAC_RADIO_BACKOFF_SET_COUNT(backoff);
-  HAL_EXIT_CRITICAL_SECTION(s);
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerCount
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-uint32 macBackoffTimerCount(void)
-{
-  halIntState_t  s;
-  uint32 backoffCount;
-
-  HAL_ENTER_CRITICAL_SECTION(s);
-  backoffCount = MAC_RADIO_BACKOFF_COUNT();
-  HAL_EXIT_CRITICAL_SECTION(s);
-  return(backoffCount);
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerGetTrigger
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-uint32 macBackoffTimerGetTrigger(void)
-{
-  return(backoffTimerTrigger);
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerSetTrigger
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-void macBackoffTimerSetTrigger(uint32 triggerBackoff)
-{
-  halIntState_t  s;
-
-  MAC_ASSERT(triggerBackoff < backoffTimerRollover); /* trigger backoff must be less than rollover backoff */
-
-  HAL_ENTER_CRITICAL_SECTION(s);
-  backoffTimerTrigger = triggerBackoff;
-  if (triggerBackoff > MAC_RADIO_BACKOFF_COUNT())
-  {
-    compareState = COMPARE_STATE_TRIGGER;
-    MAC_RADIO_BACKOFF_SET_COMPARE(triggerBackoff);
-  }
-  else
-  {
-    if (triggerBackoff == 0)
-    {
-      compareState = COMPARE_STATE_ROLLOVER_AND_TRIGGER;
-    }
-    else
-    {
-      compareState = COMPARE_STATE_ROLLOVER_AND_ARM_TRIGGER;
-    }
-    MAC_RADIO_BACKOFF_SET_COMPARE(backoffTimerRollover);
-  }
-  HAL_EXIT_CRITICAL_SECTION(s);
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerCancelTrigger
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-void macBackoffTimerCancelTrigger(void)
-{
-  halIntState_t  s;
-
-  HAL_ENTER_CRITICAL_SECTION(s);
-  compareState = COMPARE_STATE_ROLLOVER;
-  MAC_RADIO_BACKOFF_SET_COMPARE(backoffTimerRollover);
-  HAL_EXIT_CRITICAL_SECTION(s);
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerRealign
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-
-/*
- *  Realignment is accomplished by adjusting the internal time base to align with the expected
- *  reception time of an incoming frame.  The difference between the expected reception time and
- *  the actual reception time is computed and this difference is used to adjust the hardware
- *  timer count and backoff count.
- *
- *  The realignment is based on the SFD signal for the incoming frame.  The timer is aligned
- *  by adjusting it with the difference between the expected SFD time and the actual SFD time.
- */
-int32 macBackoffTimerRealign(macRx_t *pMsg)
-{
-  uint16 timerDelayTicks;
-  int32 backoffDelta;
-  int32 backoffCount;
-
-  MAC_ASSERT(!macTxActive);  /* cannot realign during transmit */
-
-  /*-------------------------------------------------------------------------------
-   *  Calculate the delta backoff difference between expected backoff count,
-   *  which is zero, and the backoff count of the received frame.
-   */
-
-  /* since expected receive time is zero, the delta is simply the receive time */
-  backoffDelta = pMsg->mac.timestamp;
-
-  /* if the frame was received more than halfway to the rollover count, use a negative delta value */
-  if (((uint32) backoffDelta) > (backoffTimerRollover / 2))
-  {
-    backoffDelta = backoffDelta - backoffTimerRollover;    /* result will be negative */
-  }
-
-  /*-------------------------------------------------------------------------------
-   *  Calculate the number of timer ticks to delay that will align the internal
-   *  time base with the received frame.
-   */
-
-  /* retrieve the timer count when frame was received */
-  timerDelayTicks = pMsg->mac.timestamp2;
-
-  /*
-   *  Subtract the expected SFD time from the actual SFD time to find the needed
-   *  timer adjustment. If subtracting the offset would result in a negative value,
-   *  the tick delay must wrap around.
-   */
-  if (timerDelayTicks >= TIMER_TICKS_EXPECTED_AT_SFD)
-  {
-    /* since delay count is greater than or equal to offset, subtract it directly */
-    timerDelayTicks = timerDelayTicks - TIMER_TICKS_EXPECTED_AT_SFD;
-  }
-  else
-  {
-    /*
-     *  The expected time is greater that actualy time so it cannot be subtracted directly.
-     *  The tick count per backoff is added to wrap around within the backoff.
-     *  Since a wrap around did happen, the backoff delta is adjusted by one.
-     */
-    timerDelayTicks = timerDelayTicks - TIMER_TICKS_EXPECTED_AT_SFD + MAC_RADIO_TIMER_TICKS_PER_BACKOFF();
-    backoffDelta--;
-  }
-
-  /*-------------------------------------------------------------------------------
-   *  Calculate the new backoff count.
-   */
-
-  backoffCount = MAC_RADIO_BACKOFF_COUNT() - backoffDelta;
-
-  if (backoffCount >= ((int32) backoffTimerRollover))
-  {
-    backoffCount -= backoffTimerRollover;
-  }
-  else if (backoffCount < 0)
-  {
-    backoffCount += backoffTimerRollover;
-  }
-
-  /////////////////////////////////////////////////////////////////////////////////////////
-  // TBD : must account for rare "rollover just as timer is adjusted" condition
-  /////////////////////////////////////////////////////////////////////////////////////////
-
-  MAC_RADIO_TIMER_FORCE_DELAY(timerDelayTicks);
-  MAC_RADIO_BACKOFF_SET_COUNT(backoffCount);
-
-  return(backoffDelta);
-}
-
-
-/**************************************************************************************************
- * @fn          macBackoffTimerCompareIsr
- *
- * @brief       -
- *
- * @param       none
- *
- * @return      none
- **************************************************************************************************
- */
-void macBackoffTimerCompareIsr(void)
-{
-  uint8 oldState;
-  halIntState_t  s;
-
-  HAL_ENTER_CRITICAL_SECTION(s);
-  oldState = compareState;
-
-  /* if compare is a rollover, set count to zero */
-  if (oldState & COMPARE_STATE_ROLLOVER_BV)
-  {
-    MAC_RADIO_BACKOFF_SET_COUNT(0);
-    macBackoffTimerRolloverCallback();
-  }
-
-  /* if compare is a trigger, reset for rollover and run the trigger callback */
-  if (oldState & COMPARE_STATE_TRIGGER_BV)
-  {
-    compareState = COMPARE_STATE_ROLLOVER;
-    MAC_RADIO_BACKOFF_SET_COMPARE(backoffTimerRollover);
-    HAL_EXIT_CRITICAL_SECTION(s);
-    macBackoffTimerTriggerCallback();
-  }
-  else if (oldState == COMPARE_STATE_ROLLOVER_AND_ARM_TRIGGER)
-  {
-    compareState = COMPARE_STATE_TRIGGER;
-    MAC_RADIO_BACKOFF_SET_COMPARE(backoffTimerTrigger);
-  }
-
-  HAL_EXIT_CRITICAL_SECTION(s);
-}
-
-
-/**************************************************************************************************
-*/
+/**************************************************************************************************
+    Filename:
+    Revised:        $Date: 2006-11-15 11:49:52 -0800 (Wed, 15 Nov 2006) $
+    Revision:       $Revision: 12720 $
+
+    Description:
+
+    Describe the purpose and contents of the file.
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+**************************************************************************************************/
+
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+
+/* hal */
+#include "hal_types.h"
+
+/* high-level specific */
+#include "mac_spec.h"
+
+/* exported low-level */
+#include "mac_low_level.h"
+
+/* low-level specific */
+#include "mac_backoff_timer.h"
+#include "mac_tx.h"
+
+/* target specific */
+#include "mac_radio_defs.h"
+
+/* debug */
+#include "mac_assert.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                            Defines
+ * ------------------------------------------------------------------------------------------------
+ */
+#define COMPARE_STATE_ROLLOVER_BV                 BV(0)
+#define COMPARE_STATE_TRIGGER_BV                  BV(1)
+#define COMPARE_STATE_ARM_BV                      BV(2)
+
+#define COMPARE_STATE_TRIGGER                     COMPARE_STATE_TRIGGER_BV
+#define COMPARE_STATE_ROLLOVER                    COMPARE_STATE_ROLLOVER_BV
+#define COMPARE_STATE_ROLLOVER_AND_TRIGGER        (COMPARE_STATE_ROLLOVER_BV | COMPARE_STATE_TRIGGER_BV)
+#define COMPARE_STATE_ROLLOVER_AND_ARM_TRIGGER    (COMPARE_STATE_ROLLOVER_BV | COMPARE_STATE_ARM_BV)
+
+
+/*
+ *  The datasheet mentions a small delay on both receive and transmit side of approximately
+ *  two microseconds.  The precise characterization is given below.
+ *  (This data is not given in rev 1.03 datasheet)
+ */
+#define RX_TX_PROP_DELAY_AVG_USEC         ((MAC_RADIO_RX_TX_PROP_DELAY_MIN_USEC + MAC_RADIO_RX_TX_PROP_DELAY_MAX_USEC) / 2)
+#define RX_TX_PROP_DELAY_AVG_TIMER_TICKS  ((uint16)(MAC_RADIO_TIMER_TICKS_PER_USEC() * RX_TX_PROP_DELAY_AVG_USEC + 0.5))
+
+/*
+ *  For slotted receives, the SFD signal is expected to occur on a specifc symbol boundary.
+ *  This does *not* correspond to the backoff boundary.  The SFD signal occurs at an
+ *  offset from the backoff boundary.  This is done for efficiency of related algorithms.
+ *
+ *  Once transmit is strobed there is a fixed delay until the SFD signal occurs.  The frame
+ *  does not start over-the-air transmit until after an internal radio delay of 12 symbols.
+ *  Once transmitting over-the-air, the preamble is sent (8 symbols) followed by the
+ *  SFD field (2 symbols). After the SFD field completes, the SFD signal occurs.  This
+ *  adds up to a total of 22 symbols from strobe to SFD signal.
+ *
+ *  Since 22 symbols spans more than a backoff (20 symbols) the modulus operation is used
+ *  to find the symbol offset which is 2 symbols.
+ *
+ *  This math is derived formally via the pre-processor.
+ */
+#define SYMBOLS_FROM_STROBE_TO_PREAMBLE   12 /* from datasheet */
+#define SYMBOLS_FROM_PREAMBLE_TO_SFD      (MAC_SPEC_PREAMBLE_FIELD_LENGTH + MAC_SPEC_SFD_FIELD_LENGTH)
+#define SYMBOLS_FROM_STROBE_TO_SFD        (SYMBOLS_FROM_STROBE_TO_PREAMBLE + SYMBOLS_FROM_PREAMBLE_TO_SFD)
+#define SYMBOLS_EXPECTED_AT_SFD           (SYMBOLS_FROM_STROBE_TO_SFD % MAC_A_UNIT_BACKOFF_PERIOD)
+
+/* after all that formal math, make sure the result is as expected */
+#if (SYMBOLS_EXPECTED_AT_SFD != 2)
+#error "ERROR! Internal problem with pre-processor math of slotted alignment."
+#endif
+
+
+/*
+ *  The expected SFD signal occurs at the symbol offset *plus* a small internal propagation delay
+ *  internal to the radio.  This delay is given as the sum of a receive side delay and a transmit
+ *  side delay.  When this delay is subtracted from the internal timer, the internal time base
+ *  actually becomes the actual receive time *minus* the transmit delay.  This works out though.
+ *  The transmit logic does *not* take into account this delay.  Since the timer is skewed by the
+ *  transmit delay already, the transmits go out precisely on time.
+ */
+#define TIMER_TICKS_EXPECTED_AT_SFD   ((SYMBOLS_EXPECTED_AT_SFD * MAC_RADIO_TIMER_TICKS_PER_SYMBOL()) \
+                                          + RX_TX_PROP_DELAY_AVG_TIMER_TICKS)
+
+#if (MAC_HR_TIMERS) && (MAC_HR_TIMER_CNT > 8)
+#error "ERROR! MAC_HR_TIMER_CNT must not exceed 8."
+#endif
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Typedefs
+ * ------------------------------------------------------------------------------------------------
+ */
+#if (MAC_HR_TIMERS)
+/* high resolution timer, free when the callback is NULL */
+typedef struct
+{
+  macHrTimerCback_t pCback;
+  uint32            backoff;      /* backoff count of the deadline */
+  uint32            rollovers;    /* rollovers left before the deadline */
+} hrTimer_t;
+#endif
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                         Local Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+static uint32 backoffTimerRollover;
+static uint32 backoffTimerTrigger;
+static uint32 backoffTimerCompare;
+static uint8 compareState;
+
+#if (MAC_HR_TIMERS)
+static hrTimer_t hrTimer[MAC_HR_TIMER_CNT];
+#endif
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                       Local Prototypes
+ * ------------------------------------------------------------------------------------------------
+ */
+static void backoffTimerSetCompare(void);
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerInit
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void macBackoffTimerInit(void)
+{
+  compareState = COMPARE_STATE_ROLLOVER;
+  MAC_RADIO_BACKOFF_SET_COUNT(0);
+  macBackoffTimerSetRollover(MAC_BACKOFF_TIMER_DEFAULT_ROLLOVER);
+  MAC_RADIO_BACKOFF_COMPARE_CLEAR_INTERRUPT();
+  MAC_RADIO_BACKOFF_COMPARE_ENABLE_INTERRUPT();
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerReset
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void macBackoffTimerReset(void)
+{
+  MAC_RADIO_BACKOFF_COMPARE_DISABLE_INTERRUPT();
+  macBackoffTimerInit();
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerSetRollover
+ *
+ * @brief       Set rollover count of backoff timer.
+ *
+ * @param       rolloverBackoff - backoff count where count is reset to zero
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void macBackoffTimerSetRollover(uint32 rolloverBackoff)
+{
+  halIntState_t  s;
+
+  MAC_ASSERT(rolloverBackoff > MAC_RADIO_BACKOFF_COUNT());  /* rollover value must be greater than count */
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+  backoffTimerRollover = rolloverBackoff;
+  backoffTimerSetCompare();
+  HAL_EXIT_CRITICAL_SECTION(s);
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerSetCount
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void macBackoffTimerSetCount(uint32 backoff)
+{
+  halIntState_t  s;
+
+  MAC_ASSERT(compareState == COMPARE_STATE_ROLLOVER);   /* trigger cannot be active if changing count */
+  MAC_ASSERT(backoff < backoffTimerRollover);  /* count must be less than rollover value */
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+  MAC_RADIO_BACKOFF_SET_COUNT(backoff);
+  backoffTimerSetCompare();
+  HAL_EXIT_CRITICAL_SECTION(s);
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerCount
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+uint32 macBackoffTimerCount(void)
+{
+  halIntState_t  s;
+  uint32 backoffCount;
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+  backoffCount = MAC_RADIO_BACKOFF_COUNT();
+  HAL_EXIT_CRITICAL_SECTION(s);
+  return(backoffCount);
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerGetTrigger
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+uint32 macBackoffTimerGetTrigger(void)
+{
+  return(backoffTimerTrigger);
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerSetTrigger
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void macBackoffTimerSetTrigger(uint32 triggerBackoff)
+{
+  halIntState_t  s;
+
+  MAC_ASSERT(triggerBackoff < backoffTimerRollover); /* trigger backoff must be less than rollover backoff */
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+  backoffTimerTrigger = triggerBackoff;
+  if (triggerBackoff > MAC_RADIO_BACKOFF_COUNT())
+  {
+    compareState = COMPARE_STATE_TRIGGER;
+  }
+  else
+  {
+    if (triggerBackoff == 0)
+    {
+      compareState = COMPARE_STATE_ROLLOVER_AND_TRIGGER;
+    }
+    else
+    {
+      compareState = COMPARE_STATE_ROLLOVER_AND_ARM_TRIGGER;
+    }
+  }
+  backoffTimerSetCompare();
+  HAL_EXIT_CRITICAL_SECTION(s);
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerCancelTrigger
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void macBackoffTimerCancelTrigger(void)
+{
+  halIntState_t  s;
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+  compareState = COMPARE_STATE_ROLLOVER;
+  backoffTimerSetCompare();
+  HAL_EXIT_CRITICAL_SECTION(s);
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerRealign
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+
+/*
+ *  Realignment is accomplished by adjusting the internal time base to align with the expected
+ *  reception time of an incoming frame.  The difference between the expected reception time and
+ *  the actual reception time is computed and this difference is used to adjust the hardware
+ *  timer count and backoff count.
+ *
+ *  The realignment is based on the SFD signal for the incoming frame.  The timer is aligned
+ *  by adjusting it with the difference between the expected SFD time and the actual SFD time.
+ */
+int32 macBackoffTimerRealign(macRx_t *pMsg)
+{
+  uint16 timerDelayTicks;
+  int32 backoffDelta;
+  int32 backoffCount;
+  halIntState_t  s;
+
+  MAC_ASSERT(!macTxActive);  /* cannot realign during transmit */
+
+  /*-------------------------------------------------------------------------------
+   *  Calculate the delta backoff difference between expected backoff count,
+   *  which is zero, and the backoff count of the received frame.
+   */
+
+  /* since expected receive time is zero, the delta is simply the receive time */
+  backoffDelta = pMsg->mac.timestamp;
+
+  /* if the frame was received more than halfway to the rollover count, use a negative delta value */
+  if (((uint32) backoffDelta) > (backoffTimerRollover / 2))
+  {
+    backoffDelta = backoffDelta - backoffTimerRollover;    /* result will be negative */
+  }
+
+  /*-------------------------------------------------------------------------------
+   *  Calculate the number of timer ticks to delay that will align the internal
+   *  time base with the received frame.
+   */
+
+  /* retrieve the timer count when frame was received */
+  timerDelayTicks = pMsg->mac.timestamp2;
+
+  /*
+   *  Subtract the expected SFD time from the actual SFD time to find the needed
+   *  timer adjustment. If subtracting the offset would result in a negative value,
+   *  the tick delay must wrap around.
+   */
+  if (timerDelayTicks >= TIMER_TICKS_EXPECTED_AT_SFD)
+  {
+    /* since delay count is greater than or equal to offset, subtract it directly */
+    timerDelayTicks = timerDelayTicks - TIMER_TICKS_EXPECTED_AT_SFD;
+  }
+  else
+  {
+    /*
+     *  The expected time is greater that actualy time so it cannot be subtracted directly.
+     *  The tick count per backoff is added to wrap around within the backoff.
+     *  Since a wrap around did happen, the backoff delta is adjusted by one.
+     */
+    timerDelayTicks = timerDelayTicks - TIMER_TICKS_EXPECTED_AT_SFD + MAC_RADIO_TIMER_TICKS_PER_BACKOFF();
+    backoffDelta--;
+  }
+
+  /*-------------------------------------------------------------------------------
+   *  Calculate the new backoff count.
+   */
+
+  backoffCount = MAC_RADIO_BACKOFF_COUNT() - backoffDelta;
+
+  if (backoffCount >= ((int32) backoffTimerRollover))
+  {
+    backoffCount -= backoffTimerRollover;
+  }
+  else if (backoffCount < 0)
+  {
+    backoffCount += backoffTimerRollover;
+  }
+
+  /////////////////////////////////////////////////////////////////////////////////////////
+  // TBD : must account for rare "rollover just as timer is adjusted" condition
+  /////////////////////////////////////////////////////////////////////////////////////////
+
+  MAC_RADIO_TIMER_FORCE_DELAY(timerDelayTicks);
+  MAC_RADIO_BACKOFF_SET_COUNT(backoffCount);
+
+  /* the count may have moved past a high resolution deadline */
+  HAL_ENTER_CRITICAL_SECTION(s);
+  backoffTimerSetCompare();
+  HAL_EXIT_CRITICAL_SECTION(s);
+
+  return(backoffDelta);
+}
+
+
+/**************************************************************************************************
+ * @fn          macBackoffTimerCompareIsr
+ *
+ * @brief       -
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+void macBackoffTimerCompareIsr(void)
+{
+  uint8 oldState;
+  uint8 trigger;
+  halIntState_t  s;
+#if (MAC_HR_TIMERS)
+  macHrTimerCback_t pCback[MAC_HR_TIMER_CNT];
+  uint32 backoffCount;
+  uint8 i;
+#endif
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+  oldState = compareState;
+  trigger = FALSE;
+
+  /* if compare is a rollover, set count to zero */
+  if (backoffTimerCompare == backoffTimerRollover)
+  {
+    MAC_RADIO_BACKOFF_SET_COUNT(0);
+    macBackoffTimerRolloverCallback();
+
+    /* a trigger set on the rollover count itself comes with the rollover */
+    if ((oldState == COMPARE_STATE_ROLLOVER_AND_TRIGGER) ||
+        ((oldState == COMPARE_STATE_TRIGGER) && (backoffTimerTrigger == backoffTimerRollover)))
+    {
+      trigger = TRUE;
+    }
+    else if (oldState == COMPARE_STATE_ROLLOVER_AND_ARM_TRIGGER)
+    {
+      compareState = COMPARE_STATE_TRIGGER;
+    }
+
+#if (MAC_HR_TIMERS)
+    /* count down the rollovers; a deadline of the period that ended is overdue */
+    for (i = 0; i < MAC_HR_TIMER_CNT; i++)
+    {
+      if (hrTimer[i].pCback != NULL)
+      {
+        if (hrTimer[i].rollovers == 0)
+        {
+          hrTimer[i].backoff = 0;
+        }
+        else
+        {
+          hrTimer[i].rollovers--;
+        }
+      }
+    }
+#endif
+  }
+
+  /* otherwise the compare can be the trigger or a high resolution deadline */
+  else if ((oldState == COMPARE_STATE_TRIGGER) && (backoffTimerCompare == backoffTimerTrigger))
+  {
+    trigger = TRUE;
+  }
+
+  /* a trigger that is run resets for rollover */
+  if (trigger)
+  {
+    compareState = COMPARE_STATE_ROLLOVER;
+  }
+
+#if (MAC_HR_TIMERS)
+  /* take out the high resolution timers that are due */
+  backoffCount = MAC_RADIO_BACKOFF_COUNT();
+  for (i = 0; i < MAC_HR_TIMER_CNT; i++)
+  {
+    pCback[i] = NULL;
+    if ((hrTimer[i].pCback != NULL) && (hrTimer[i].rollovers == 0) &&
+        (hrTimer[i].backoff <= backoffCount))
+    {
+      pCback[i] = hrTimer[i].pCback;
+      hrTimer[i].pCback = NULL;
+    }
+  }
+#endif
+
+  backoffTimerSetCompare();
+  HAL_EXIT_CRITICAL_SECTION(s);
+
+  if (trigger)
+  {
+    macBackoffTimerTriggerCallback();
+  }
+
+#if (MAC_HR_TIMERS)
+  for (i = 0; i < MAC_HR_TIMER_CNT; i++)
+  {
+    if (pCback[i] != NULL)
+    {
+      pCback[i](i);
+    }
+  }
+#endif
+}
+
+
+/**************************************************************************************************
+ * @fn          backoffTimerSetCompare
+ *
+ * @brief       Set the compare to the first of the rollover, the trigger and the high resolution
+ *              deadlines.  A deadline the count has already passed, when the count was moved, is
+ *              set for the next backoff.  Interrupts must be disabled.
+ *
+ * @param       none
+ *
+ * @return      none
+ **************************************************************************************************
+ */
+static void backoffTimerSetCompare(void)
+{
+  uint32 compare;
+#if (MAC_HR_TIMERS)
+  uint32 backoffCount;
+  uint32 backoff;
+  uint8 i;
+#endif
+
+  compare = backoffTimerRollover;
+  if (compareState == COMPARE_STATE_TRIGGER)
+  {
+    compare = backoffTimerTrigger;
+  }
+
+#if (MAC_HR_TIMERS)
+  backoffCount = MAC_RADIO_BACKOFF_COUNT();
+  for (i = 0; i < MAC_HR_TIMER_CNT; i++)
+  {
+    if ((hrTimer[i].pCback != NULL) && (hrTimer[i].rollovers == 0))
+    {
+      backoff = hrTimer[i].backoff;
+      if (backoff <= backoffCount)
+      {
+        backoff = backoffCount + 1;
+      }
+      if (backoff < compare)
+      {
+        compare = backoff;
+      }
+    }
+  }
+#endif
+
+  backoffTimerCompare = compare;
+  MAC_RADIO_BACKOFF_SET_COMPARE(compare);
+}
+
+
+#if (MAC_HR_TIMERS)
+/**************************************************************************************************
+ * @fn          MAC_HrTimerStart
+ *
+ * @brief       Start a one-shot timer on the backoff timer.  See mac_api.h.
+ *
+ * @param       backoffs - number of backoff boundaries to the deadline
+ * @param       pCback - function called with the timer ID at the deadline
+ *
+ * @return      timer ID or MAC_HR_TIMER_NONE
+ **************************************************************************************************
+ */
+uint8 MAC_HrTimerStart(uint32 backoffs, macHrTimerCback_t pCback)
+{
+  halIntState_t  s;
+  uint32 backoff;
+  uint8 i;
+
+  MAC_ASSERT(pCback != NULL);  /* a timer needs a callback */
+
+  if (backoffs == 0)
+  {
+    backoffs = 1;
+  }
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+
+  /* find a free timer */
+  for (i = 0; (i < MAC_HR_TIMER_CNT) && (hrTimer[i].pCback != NULL); i++);
+
+  if (i < MAC_HR_TIMER_CNT)
+  {
+    /* split the deadline in whole rollover periods and a backoff count */
+    hrTimer[i].rollovers = backoffs / backoffTimerRollover;
+    backoff = MAC_RADIO_BACKOFF_COUNT() + (backoffs % backoffTimerRollover);
+    if (backoff >= backoffTimerRollover)
+    {
+      backoff -= backoffTimerRollover;
+      hrTimer[i].rollovers++;
+    }
+    hrTimer[i].backoff = backoff;
+    hrTimer[i].pCback = pCback;
+
+    backoffTimerSetCompare();
+  }
+  else
+  {
+    i = MAC_HR_TIMER_NONE;
+  }
+
+  HAL_EXIT_CRITICAL_SECTION(s);
+
+  return(i);
+}
+
+
+/**************************************************************************************************
+ * @fn          MAC_HrTimerStop
+ *
+ * @brief       Stop a timer started with MAC_HrTimerStart().  See mac_api.h.
+ *
+ * @param       timerId - ID returned by MAC_HrTimerStart()
+ *
+ * @return      MAC_SUCCESS or MAC_INVALID_HANDLE
+ **************************************************************************************************
+ */
+uint8 MAC_HrTimerStop(uint8 timerId)
+{
+  halIntState_t  s;
+  uint8 status = MAC_INVALID_HANDLE;
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+  if ((timerId < MAC_HR_TIMER_CNT) && (hrTimer[timerId].pCback != NULL))
+  {
+    hrTimer[timerId].pCback = NULL;
+    backoffTimerSetCompare();
+    status = MAC_SUCCESS;
+  }
+  HAL_EXIT_CRITICAL_SECTION(s);
+
+  return(status);
+}
+
+
+/**************************************************************************************************
+ * @fn          MAC_HrTimerPending
+ *
+ * @brief       Return the number of running high resolution timers.  See mac_api.h.
+ *
+ * @param       none
+ *
+ * @return      number of running timers
+ **************************************************************************************************
+ */
+uint8 MAC_HrTimerPending(void)
+{
+  halIntState_t  s;
+  uint8 cnt = 0;
+  uint8 i;
+
+  HAL_ENTER_CRITICAL_SECTION(s);
+  for (i = 0; i < MAC_HR_TIMER_CNT; i++)
+  {
+    if (hrTimer[i].pCback != NULL)
+    {
+      cnt++;
+    }
+  }
+  HAL_EXIT_CRITICAL_SECTION(s);
+
+  return(cnt);
+}
+#endif
+
+
+/**************************************************************************************************
+*/
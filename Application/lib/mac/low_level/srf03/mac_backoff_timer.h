@@ -1,32 +1,32 @@
-/**************************************************************************************************
-    Filename:
-    Revised:        $Date: 2006-10-31 14:16:24 -0800 (Tue, 31 Oct 2006) $
-    Revision:       $Revision: 12457 $
-
-    Description:
-
-    Describe the purpose and contents of the file.
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-**************************************************************************************************/
-
-#ifndef MAC_BACKOFF_TIMER_H
-#define MAC_BACKOFF_TIMER_H
-
-
-/* ------------------------------------------------------------------------------------------------
- *                                           Prototypes
- * ------------------------------------------------------------------------------------------------
- */
-void macBackoffTimerInit(void);
-void macBackoffTimerReset(void);
-void macBackoffTimerCompareIsr(void);
-
-
-/**************************************************************************************************
- */
-#endif
+/**************************************************************************************************
+    Filename:
+    Revised:        $Date: 2006-10-31 14:16:24 -0800 (Tue, 31 Oct 2006) $
+    Revision:       $Revision: 12457 $
+
+    Description:
+
+    Describe the purpose and contents of the file.
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+**************************************************************************************************/
+
+#ifndef MAC_BACKOFF_TIMER_H
+#define MAC_BACKOFF_TIMER_H
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                           Prototypes
+ * ------------------------------------------------------------------------------------------------
+ */
+void macBackoffTimerInit(void);
+void macBackoffTimerReset(void);
+void macBackoffTimerCompareIsr(void);
+
+
+/**************************************************************************************************
+ */
+#endif
@@ -1,47 +1,47 @@
-/**************************************************************************************************
-    Filename:
-    Revised:        $Date: 2006-10-31 14:16:24 -0800 (Tue, 31 Oct 2006) $
-    Revision:       $Revision: 12457 $
-
-    Description:
-
-    Describe the purpose and contents of the file.
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-**************************************************************************************************/
-
-#ifndef MAC_RADIO_H
-#define MAC_RADIO_H
-
-/* ------------------------------------------------------------------------------------------------
- *                                         Includes
- * ------------------------------------------------------------------------------------------------
- */
-#include "hal_types.h"
-
-
-/* ------------------------------------------------------------------------------------------------
- *                                      Global Variables
- * ------------------------------------------------------------------------------------------------
- */
-extern uint8 macPhyChannel;
-extern uint8 macPhyTxPower;
-
-
-/* ------------------------------------------------------------------------------------------------
- *                                        Prototypes
- * ------------------------------------------------------------------------------------------------
- */
-void macRadioInit(void);
-void macRadioReset(void);
-void macRadioUpdateTxPower(void);
-void macRadioUpdateChannel(void);
-
-
-/**************************************************************************************************
- */
-#endif
+/**************************************************************************************************
+    Filename:
+    Revised:        $Date: 2006-10-31 14:16:24 -0800 (Tue, 31 Oct 2006) $
+    Revision:       $Revision: 12457 $
+
+    Description:
+
+    Describe the purpose and contents of the file.
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+**************************************************************************************************/
+
+#ifndef MAC_RADIO_H
+#define MAC_RADIO_H
+
+/* ------------------------------------------------------------------------------------------------
+ *                                         Includes
+ * ------------------------------------------------------------------------------------------------
+ */
+#include "hal_types.h"
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                      Global Variables
+ * ------------------------------------------------------------------------------------------------
+ */
+extern uint8 macPhyChannel;
+extern uint8 macPhyTxPower;
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                        Prototypes
+ * ------------------------------------------------------------------------------------------------
+ */
+void macRadioInit(void);
+void macRadioReset(void);
+void macRadioUpdateTxPower(void);
+void macRadioUpdateChannel(void);
+
+
+/**************************************************************************************************
+ */
+#endif
@@ -1,39 +1,39 @@
-/**************************************************************************************************
-    Filename:
-    Revised:        $Date: 2006-11-14 11:20:09 -0800 (Tue, 14 Nov 2006) $
-    Revision:       $Revision: 12700 $
-
-    Description:
-
-    Describe the purpose and contents of the file.
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-**************************************************************************************************/
-
-#ifndef MAC_CSP_TX_H
-#define MAC_CSP_TX_H
-
-
-/* ------------------------------------------------------------------------------------------------
- *                                         Prototypes
- * ------------------------------------------------------------------------------------------------
- */
-void macCspTxReset(void);
-void macCspTxPrepCsmaUnslotted(void);
-void macCspTxPrepCsmaSlotted(void);
-void macCspTxPrepSlotted(void);
-void macCspTxGoCsma(void);
-void macCspTxGoSlotted(void);
-void macCspTxRequestAckTimeoutCallback(void);
-void macCspTxCancelAckTimeoutCallback(void);
-void macCspTxStopIsr(void);
-void macCspTxIntIsr(void);
-
-
-/**************************************************************************************************
- */
-#endif
+/**************************************************************************************************
+    Filename:
+    Revised:        $Date: 2006-11-14 11:20:09 -0800 (Tue, 14 Nov 2006) $
+    Revision:       $Revision: 12700 $
+
+    Description:
+
+    Describe the purpose and contents of the file.
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+**************************************************************************************************/
+
+#ifndef MAC_CSP_TX_H
+#define MAC_CSP_TX_H
+
+
+/* ------------------------------------------------------------------------------------------------
+ *                                         Prototypes
+ * ------------------------------------------------------------------------------------------------
+ */
+void macCspTxReset(void);
+void macCspTxPrepCsmaUnslotted(void);
+void macCspTxPrepCsmaSlotted(void);
+void macCspTxPrepSlotted(void);
+void macCspTxGoCsma(void);
+void macCspTxGoSlotted(void);
+void macCspTxRequestAckTimeoutCallback(void);
+void macCspTxCancelAckTimeoutCallback(void);
+void macCspTxStopIsr(void);
+void macCspTxIntIsr(void);
+
+
+/**************************************************************************************************
+ */
+#endif
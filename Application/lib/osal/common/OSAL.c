@@ -1,1013 +1,1704 @@
-/*********************************************************************
-    Filename:       OSAL.c
-    Revised:        $Date: 2006-10-26 11:15:57 -0700 (Thu, 26 Oct 2006) $
-    Revision:       $Revision: 12421 $
-
-    Description:
-
-       This API allows the software components in the Z-stack to be
-       written independently of the specifics of the operating system,
-       kernel or tasking environment (including control loops or
-       connect-to-interrupt systems).
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-
-/*********************************************************************
- * INCLUDES
- */
-//#ifdef WIN32
-//  #include <stdio.h>
-//#endif
-
-#include <stdlib.h>
-#include <string.h>
-
-#include "ZComDef.h"
-#include "OSAL.h"
-#include "OSAL_Tasks.h"
-#include "OSAL_Custom.h"
-#include "OSAL_Memory.h"
-#include "OSAL_PwrMgr.h"
-#include "hal_mcu.h"
-
-#include "OnBoard.h"
-
-/* HAL */
-#include "hal_drivers.h"
-
-/*********************************************************************
- * MACROS
- */
-
-#define OSAL_MSG_LEN(msg_ptr)      ((osal_msg_hdr_t *) (msg_ptr) - 1)->len
-
-#define OSAL_MSG_ID(msg_ptr)      ((osal_msg_hdr_t *) (msg_ptr) - 1)->dest_id
-
-/*********************************************************************
- * CONSTANTS
- */
-
-/*********************************************************************
- * TYPEDEFS
- */
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
-
-// Message Pool Definitions
-osal_msg_q_t osal_qHead;
-
-#if defined( OSAL_TOTAL_MEM )
-  UINT16 osal_msg_cnt;
-#endif
-
-/*********************************************************************
- * EXTERNAL VARIABLES
- */
-
-/*********************************************************************
- * EXTERNAL FUNCTIONS
- */
-
-/*********************************************************************
- * LOCAL VARIABLES
- */
-
-/*********************************************************************
- * LOCAL FUNCTION PROTOTYPES
- */
-
-/*********************************************************************
- * HELPER FUNCTIONS
- */
-/* very ugly stub so Keil can compile */
-#ifdef __KEIL__
-char *  itoa ( int value, char * buffer, int radix )
-{
-  return(buffer);
-}
-#endif
-
-/*********************************************************************
- * @fn      osal_strlen
- *
- * @brief
- *
- *   Calculates the length of a string.  The string must be null
- *   terminated.
- *
- * @param   char *pString - pointer to text string
- *
- * @return  int - number of characters
- */
-int osal_strlen( char *pString )
-{
-  return strlen( pString );
-}
-
-/*********************************************************************
- * @fn      osal_memcpy
- *
- * @brief
- *
- *   Generic memory copy.
- *
- *   Note: This function differs from the standard memcpy(), since
- *         it returns the pointer to the next destination byte. The
- *         standard memcpy() returns the original destination address.
- *
- * @param   dst - destination address
- * @param   src - source address
- * @param   len - number of bytes to copy
- *
- * @return  pointer to end of destination buffer
- */
-void *osal_memcpy( void *dst, const void GENERIC *src, unsigned int len )
-{
-  byte *pDst;
-  const byte GENERIC *pSrc;
-
-  pSrc = src;
-  pDst = dst;
-
-  while ( len-- )
-    *pDst++ = *pSrc++;
-
-  return ( pDst );
-}
-
-/*********************************************************************
- * @fn      osal_cpyExtAddr
- *
- * @brief
- *
- *   Copy extended addresses.  This function will copy 8 bytes.
- *
- * @param   dest  destination address pointer
- * @param   src   source address pointer
- *
- * @return  dest + Z_EXTADDR_LEN
- */
-void *osal_cpyExtAddr( void *dest, void *src )
-{
-  return osal_memcpy( dest, src, Z_EXTADDR_LEN );
-}
-
-/*********************************************************************
- * @fn      osal_memset
- *
- * @brief
- *
- *   Set memory buffer to value.
- *
- * @param   dest - pointer to buffer
- * @param   value - what to set each byte of the message
- * @param   size - how big
- *
- * @return  value of next widget, 0 if no widget found
- */
-void *osal_memset( void *dest, byte value, int len )
-{
-  return memset( dest, value, len );
-}
-
-/*********************************************************************
- * @fn      osal_build_uint16
- *
- * @brief
- *
- *   Build a uint16 out of 2 bytes (0 then 1).
- *
- * @param   swapped - 0 then 1
- *
- * @return  uint16
- */
-uint16 osal_build_uint16( byte *swapped )
-{
-  return ( BUILD_UINT16( swapped[0], swapped[1] ) );
-}
-
-/*********************************************************************
- * @fn      osal_build_uint32
- *
- * @brief
- *
- *   Build a uint32 out of sequential bytes.
- *
- * @param   swapped - sequential bytes
- * @param   len - number of bytes in the byte array
- *
- * @return  uint32
- */
-uint32 osal_build_uint32( byte *swapped, byte len )
-{
-  if ( len == 2 )
-    return ( BUILD_UINT32( swapped[0], swapped[1], 0L, 0L ) );
-  else if ( len == 3 )
-    return ( BUILD_UINT32( swapped[0], swapped[1], swapped[2], 0L ) );
-  else if ( len == 4 )
-    return ( BUILD_UINT32( swapped[0], swapped[1], swapped[2], swapped[3] ) );
-  else
-    return ( (uint32)swapped[0] );
-}
-
-#if !defined ( ZBIT ) && !defined ( ZBIT2 )
-/*********************************************************************
- * @fn      _ltoa
- *
- * @brief
- *
- *   convert a long unsigned int to a string.
- *
- * @param  l - long to convert
- * @param  buf - buffer to convert to
- * @param  radix - 10 dec, 16 hex
- *
- * @return  pointer to buffer
- */
-unsigned char * _ltoa(unsigned long l, unsigned char *buf, unsigned char radix)
-{
-#if defined( __GNUC__ )
-  return ( (char*)ltoa( l, buf, radix ) );
-#else
-  unsigned char tmp1[10] = "", tmp2[10] = "", tmp3[10] = "";
-  unsigned short num1, num2, num3;
-  unsigned char i;
-
-  buf[0] = '\0';
-
-  if ( radix == 10 )
-  {
-    num1 = l % 10000;
-    num2 = (l / 10000) % 10000;
-    num3 = (unsigned short)(l / 100000000);
-
-    if (num3) _itoa(num3, tmp3, 10);
-    if (num2) _itoa(num2, tmp2, 10);
-    if (num1) _itoa(num1, tmp1, 10);
-
-    if (num3)
-    {
-      strcpy((char*)buf, (char const*)tmp3);
-      for (i = 0; i < 4 - strlen((char const*)tmp2); i++)
-        strcat((char*)buf, "0");
-    }
-    strcat((char*)buf, (char const*)tmp2);
-    if (num3 || num2)
-    {
-      for (i = 0; i < 4 - strlen((char const*)tmp1); i++)
-        strcat((char*)buf, "0");
-    }
-    strcat((char*)buf, (char const*)tmp1);
-    if (!num3 && !num2 && !num1)
-      strcpy((char*)buf, "0");
-  }
-  else if ( radix == 16 )
-  {
-    num1 = l & 0x0000FFFF;
-    num2 = l >> 16;
-
-    if (num2) _itoa(num2, tmp2, 16);
-    if (num1) _itoa(num1, tmp1, 16);
-
-    if (num2)
-    {
-      strcpy((char*)buf,(char const*)tmp2);
-      for (i = 0; i < 4 - strlen((char const*)tmp1); i++)
-        strcat((char*)buf, "0");
-    }
-    strcat((char*)buf, (char const*)tmp1);
-    if (!num2 && !num1)
-      strcpy((char*)buf, "0");
-  }
-  else
-    return NULL;
-
-  return buf;
-#endif
-}
-#endif // !defined(ZBIT) && !defined(ZBIT2)
-
-/*********************************************************************
- * @fn          osal_AddrEqual
- *
- * @brief       Compares two address_t structures.
- *
- * @param       a1 - first Address
- * @param       a2 - second endpoint
- *
- * @return      true - addresses are equal, false - not equal
- */
-byte osal_AddrEqual( zAddrType_t *a1, zAddrType_t *a2 )
-{
-  if ( a1->addrMode != a2->addrMode )
-    return ( false );
-
-  else if (a1->addrMode == AddrNotPresent )
-    return ( true );
-
-  else if (a1->addrMode == Addr16Bit )
-    return ( a1->addr.shortAddr == a2->addr.shortAddr );
-
-  else if ( a1->addrMode == Addr64Bit )
-    return ( osal_ExtAddrEqual( a1->addr.extAddr, a2->addr.extAddr ) );
-
-  else
-    return ( false );
-}
-
-/*********************************************************************
- * @fn      osal_ExtAddrEqual()
- *
- * @brief   Verify that the extended addresses are equal.
- *
- * @param   extAddr1 - extended address
- * @param   extAddr2 - extended address
- *
- * @return  TRUE - If addresses are same
- *          FALSE  - If not same
- */
-byte osal_ExtAddrEqual( byte *extAddr1, byte *extAddr2 )
-{
-  byte i;
-
-  for ( i = Z_EXTADDR_LEN; i ; i-- )
-  {
-    if ( *extAddr1++ != *extAddr2++ )
-      return ( false );
-  }
-
-  return ( true );
-}
-
-/*********************************************************************
- * @fn        osal_rand
- *
- * @brief    Random number generator
- *
- * @param   none
- *
- * @return  uint16 - new random number
- */
-uint16 osal_rand( void )
-{
-  return ( Onboard_rand() );
-}
-
-/*********************************************************************
- * API FUNCTIONS
- *********************************************************************/
-
-/*********************************************************************
- * @fn      osal_msg_allocate
- *
- * @brief
- *
- *    This function is called by a task to allocate a message buffer
- *    into which the task will encode the particular message it wishes
- *    to send.  This common buffer scheme is used to strictly limit the
- *    creation of message buffers within the system due to RAM size
- *    limitations on the microprocessor.   Note that all message buffers
- *    are a fixed size (at least initially).  The parameter len is kept
- *    in case a message pool with varying fixed message sizes is later
- *    created (for example, a pool of message buffers of size LARGE,
- *    MEDIUM and SMALL could be maintained and allocated based on request
- *    from the tasks).
- *
- *
- * @param   byte len  - wanted buffer length
- *
- *
- * @return  pointer to allocated buffer or NULL if allocation failed.
- */
-byte * osal_msg_allocate( uint16 len )
-{
-  osal_msg_hdr_t *hdr;
-
-  if ( len == 0 )
-    return ( NULL );
-
-  hdr = (osal_msg_hdr_t *) osal_mem_alloc( (short)(len + sizeof( osal_msg_hdr_t )) );
-  if ( hdr )
-  {
-    hdr->next = NULL;
-    hdr->len = len;
-    hdr->dest_id = TASK_NO_TASK;
-
-#if defined( OSAL_TOTAL_MEM )
-    osal_msg_cnt++;
-#endif
-    return ( (byte *) (hdr + 1) );
-  }
-  else
-    return ( NULL );
-}
-
-/*********************************************************************
- * @fn      osal_msg_deallocate
- *
- * @brief
- *
- *    This function is used to deallocate a message buffer. This function
- *    is called by a task (or processing element) after it has finished
- *    processing a received message.
- *
- *
- * @param   byte *msg_ptr - pointer to new message buffer
- *
- * @return  ZSUCCESS, INVALID_MSG_POINTER
- */
-byte osal_msg_deallocate( byte *msg_ptr )
-{
-  byte *x;
-
-  if ( msg_ptr == NULL )
-    return ( INVALID_MSG_POINTER );
-
-  // don't deallocate queued buffer
-  if ( OSAL_MSG_ID( msg_ptr ) != TASK_NO_TASK )
-    return ( MSG_BUFFER_NOT_AVAIL );
-
-  x = (byte *)((byte *)msg_ptr - sizeof( osal_msg_hdr_t ));
-
-  osal_mem_free( (void *)x );
-
-#if defined( OSAL_TOTAL_MEM )
-  if ( osal_msg_cnt )
-    osal_msg_cnt--;
-#endif
-
-  return ( ZSUCCESS );
-}
-
-#if defined( OSAL_TOTAL_MEM )
-/*********************************************************************
- * @fn      osal_num_msgs
- *
- * @brief
- *
- *    This function returns the number of allocated messages
- *
- * @param   void
- *
- * @return  UINT16 - number of msgs out
- */
-UINT16 osal_num_msgs( void )
-{
-  return ( osal_msg_cnt );
-}
-#endif
-
-/*********************************************************************
- * @fn      osal_msg_send
- *
- * @brief
- *
- *    This function is called by a task to send a command message to
- *    another task or processing element.  The sending_task field must
- *    refer to a valid task, since the task ID will be used
- *    for the response message.  This function will also set a message
- *    ready event in the destination tasks event list.
- *
- *
- * @param   byte destination task - Send msg to?  Task ID
- * @param   byte *msg_ptr - pointer to new message buffer
- * @param   byte len - length of data in message
- *
- * @return  ZSUCCESS, INVALID_SENDING_TASK, INVALID_DESTINATION_TASK,
- *          INVALID_MSG_POINTER, INVALID_LEN
- */
-byte osal_msg_send( byte destination_task, byte *msg_ptr )
-{
-  if ( msg_ptr == NULL )
-    return ( INVALID_MSG_POINTER );
-
-  if ( osalFindTask( destination_task ) == NULL )
-  {
-    osal_msg_deallocate( msg_ptr );
-    return ( INVALID_TASK );
-  }
-
-  // Check the message header
-  if ( OSAL_MSG_NEXT( msg_ptr ) != NULL ||
-       OSAL_MSG_ID( msg_ptr ) != TASK_NO_TASK )
-  {
-    osal_msg_deallocate( msg_ptr );
-    return ( INVALID_MSG_POINTER );
-  }
-
-  OSAL_MSG_ID( msg_ptr ) = destination_task;
-
-  // queue message
-  osal_msg_enqueue( &osal_qHead, msg_ptr );
-
-  // Signal the task that a message is waiting
-  osal_set_event( destination_task, SYS_EVENT_MSG );
-
-  return ( ZSUCCESS );
-}
-
-/*********************************************************************
- * @fn      osal_msg_receive
- *
- * @brief
- *
- *    This function is called by a task to retrieve a received command
- *    message. The calling task must deallocate the message buffer after
- *    processing the message using the osal_msg_deallocate() call.
- *
- * @param   byte task_id - receiving tasks ID
- *
- * @return  *byte - message information or NULL if no message
- */
-byte *osal_msg_receive( byte task_id )
-{
-  osal_msg_hdr_t *listHdr;
-  osal_msg_hdr_t *prevHdr=0;
-  halIntState_t   intState;
-
-  // Hold off interrupts
-  HAL_ENTER_CRITICAL_SECTION(intState);
-
-  // Point to the top of the queue
-  listHdr = osal_qHead;
-
-  // Look through the queue for a message that belongs to the asking task
-  while ( listHdr != NULL )
-  {
-    if ( (listHdr - 1)->dest_id == task_id )
-    {
-      break;
-    }
-    prevHdr = listHdr;
-    listHdr = OSAL_MSG_NEXT( listHdr );
-  }
-
-  // Did we find a message?
-  if ( listHdr == NULL )
-  {
-    // Release interrupts
-    HAL_EXIT_CRITICAL_SECTION(intState);
-    return NULL;
-  }
-
-  // Take out of the link list
-  osal_msg_extract( &osal_qHead, listHdr, prevHdr );
-
-  // Release interrupts
-  HAL_EXIT_CRITICAL_SECTION(intState);
-
-  return ( (byte*) listHdr );
-}
-
-/*********************************************************************
- * @fn      osal_msg_enqueue
- *
- * @brief
- *
- *    This function enqueues an OSAL message into an OSAL queue.
- *
- * @param   osal_msg_q_t *q_ptr - OSAL queue
- * @param   void *msg_ptr  - OSAL message
- *
- * @return  none
- */
-void osal_msg_enqueue( osal_msg_q_t *q_ptr, void *msg_ptr )
-{
-  void *list;
-  halIntState_t intState;
-
-  // Hold off interrupts
-  HAL_ENTER_CRITICAL_SECTION(intState);
-
-  // If first message in queue
-  if ( *q_ptr == NULL )
-  {
-    *q_ptr = msg_ptr;
-  }
-  else
-  {
-    // Find end of queue
-    for ( list = *q_ptr; OSAL_MSG_NEXT( list ) != NULL; list = OSAL_MSG_NEXT( list ) );
-
-    // Add message to end of queue
-    OSAL_MSG_NEXT( list ) = msg_ptr;
-  }
-
-  // Re-enable interrupts
-  HAL_EXIT_CRITICAL_SECTION(intState);
-}
-
-/*********************************************************************
- * @fn      osal_msg_dequeue
- *
- * @brief
- *
- *    This function dequeues an OSAL message from an OSAL queue.
- *
- * @param   osal_msg_q_t *q_ptr - OSAL queue
- *
- * @return  void * - pointer to OSAL message or NULL of queue is empty.
- */
-void *osal_msg_dequeue( osal_msg_q_t *q_ptr )
-{
-  void *msg_ptr;
-  halIntState_t intState;
-
-  // Hold off interrupts
-  HAL_ENTER_CRITICAL_SECTION(intState);
-
-  if ( *q_ptr == NULL )
-  {
-    HAL_EXIT_CRITICAL_SECTION(intState);
-    return NULL;
-  }
-
-  // Dequeue message
-  msg_ptr = *q_ptr;
-  *q_ptr = OSAL_MSG_NEXT( msg_ptr );
-  OSAL_MSG_NEXT( msg_ptr ) = NULL;
-  OSAL_MSG_ID( msg_ptr ) = TASK_NO_TASK;
-
-  // Re-enable interrupts
-  HAL_EXIT_CRITICAL_SECTION(intState);
-
-  return msg_ptr;
-}
-
-/*********************************************************************
- * @fn      osal_msg_push
- *
- * @brief
- *
- *    This function pushes an OSAL message to the head of an OSAL
- *    queue.
- *
- * @param   osal_msg_q_t *q_ptr - OSAL queue
- * @param   void *msg_ptr  - OSAL message
- *
- * @return  none
- */
-void osal_msg_push( osal_msg_q_t *q_ptr, void *msg_ptr )
-{
-  halIntState_t intState;
-
-  // Hold off interrupts
-  HAL_ENTER_CRITICAL_SECTION(intState);
-
-  if ( *q_ptr == NULL )
-  {
-    *q_ptr = msg_ptr;
-  }
-  else
-  {
-    // Push message to head of queue
-    OSAL_MSG_NEXT( msg_ptr ) = *q_ptr;
-    *q_ptr = msg_ptr;
-  }
-
-  // Re-enable interrupts
-  HAL_EXIT_CRITICAL_SECTION(intState);
-}
-
-/*********************************************************************
- * @fn      osal_msg_extract
- *
- * @brief
- *
- *    This function extracts and removes an OSAL message from the
- *    middle of an OSAL queue.
- *
- * @param   osal_msg_q_t *q_ptr - OSAL queue
- * @param   void *msg_ptr  - OSAL message to be extracted
- * @param   void *prev_ptr  - OSAL message before msg_ptr in queue
- *
- * @return  none
- */
-void osal_msg_extract( osal_msg_q_t *q_ptr, void *msg_ptr, void *prev_ptr )
-{
-  halIntState_t intState;
-
-  // Hold off interrupts
-  HAL_ENTER_CRITICAL_SECTION(intState);
-
-  if ( msg_ptr == *q_ptr )
-  {
-    // remove from first
-    *q_ptr = OSAL_MSG_NEXT( msg_ptr );
-  }
-  else
-  {
-    // remove from middle
-    OSAL_MSG_NEXT( prev_ptr ) = OSAL_MSG_NEXT( msg_ptr );
-  }
-  OSAL_MSG_NEXT( msg_ptr ) = NULL;
-  OSAL_MSG_ID( msg_ptr ) = TASK_NO_TASK;
-
-  // Re-enable interrupts
-  HAL_EXIT_CRITICAL_SECTION(intState);
-}
-
-/*********************************************************************
- * @fn      osal_msg_enqueue_max
- *
- * @brief
- *
- *    This function enqueues an OSAL message into an OSAL queue if
- *    the length of the queue is less than max.
- *
- * @param   osal_msg_q_t *q_ptr - OSAL queue
- * @param   void *msg_ptr  - OSAL message
- * @param   byte max - maximum length of queue
- *
- * @return  TRUE if message was enqueued, FALSE otherwise
- */
-byte osal_msg_enqueue_max( osal_msg_q_t *q_ptr, void *msg_ptr, byte max )
-{
-  void *list;
-  byte ret = FALSE;
-  halIntState_t intState;
-
-  // Hold off interrupts
-  HAL_ENTER_CRITICAL_SECTION(intState);
-
-  // If first message in queue
-  if ( *q_ptr == NULL )
-  {
-    *q_ptr = msg_ptr;
-    ret = TRUE;
-  }
-  else
-  {
-    // Find end of queue or max
-    list = *q_ptr;
-    max--;
-    while ( (OSAL_MSG_NEXT( list ) != NULL) && (max > 0) )
-    {
-      list = OSAL_MSG_NEXT( list );
-      max--;
-    }
-
-    // Add message to end of queue if max not reached
-    if ( max != 0 )
-    {
-      OSAL_MSG_NEXT( list ) = msg_ptr;
-      ret = TRUE;
-    }
-  }
-
-  // Re-enable interrupts
-  HAL_EXIT_CRITICAL_SECTION(intState);
-
-  return ret;
-}
-
-/*********************************************************************
- * @fn      osal_set_event
- *
- * @brief
- *
- *    This function is called to set the event flags for a task.  The
- *    event passed in is OR'd into the task's event variable.
- *
- * @param   byte task_id - receiving tasks ID
- * @param   byte event_flag - what event to set
- *
- * @return  ZSUCCESS, INVALID_TASK
- */
-byte osal_set_event( byte task_id, UINT16 event_flag )
-{
-  osalTaskRec_t *srchTask;
-  halIntState_t   intState;
-
-  srchTask = osalFindTask( task_id );
-  if ( srchTask ) {
-    // Hold off interrupts
-    HAL_ENTER_CRITICAL_SECTION(intState);
-    // Stuff the event bit(s)
-    srchTask->events |= event_flag;
-    // Release interrupts
-    HAL_EXIT_CRITICAL_SECTION(intState);
-  }
-   else
-    return ( INVALID_TASK );
-
-  return ( ZSUCCESS );
-}
-
-/*********************************************************************
- * @fn      osal_isr_register
- *
- * @brief
- *
- *   This function is called to register a service routine with an
- *   interrupt. When the interrupt occurs, this service routine is called.
- *
- * @param   byte interrupt_id - Interrupt number
- * @param   void (*isr_ptr)( byte* ) - function pointer to ISR
- *
- * @return  ZSUCCESS, INVALID_INTERRUPT_ID, or INVALID_ISR_PTR
- */
-byte osal_isr_register( byte interrupt_id, void (*isr_ptr)( byte* ) )
-{
-  return ( ZSUCCESS );
-}
-
-/*********************************************************************
- * @fn      osal_int_enable
- *
- * @brief
- *
- *   This function is called to enable an interrupt. Once enabled,
- *   occurrence of the interrupt causes the service routine associated
- *   with that interrupt to be called.
- *
- *   If INTS_ALL is the interrupt_id, interrupts (in general) are enabled.
- *   If a single interrupt is passed in, then interrupts still have
- *   to be enabled with another call to INTS_ALL.
- *
- * @param   byte interrupt_id - Interrupt number
- *
- * @return  ZSUCCESS or INVALID_INTERRUPT_ID
- */
-byte osal_int_enable( byte interrupt_id )
-{
-
-  if ( interrupt_id == INTS_ALL )
-  {
-    HAL_ENABLE_INTERRUPTS();
-  }
-  else
-    return ( INVALID_INTERRUPT_ID );
-
-  return ( ZSUCCESS );
-}
-
-/*********************************************************************
- * @fn      osal_int_disable
- *
- * @brief
- *
- *   This function is called to disable an interrupt. When a disabled
- *   interrupt occurs, the service routine associated with that
- *   interrupt is not called.
- *
- *   If INTS_ALL is the interrupt_id, interrupts (in general) are disabled.
- *   If a single interrupt is passed in, then just that interrupt is disabled.
- *
- * @param   byte interrupt_id - Interrupt number
- *
- * @return  ZSUCCESS or INVALID_INTERRUPT_ID
- */
-byte osal_int_disable( byte interrupt_id )
-{
-
-  if ( interrupt_id == INTS_ALL )
-  {
-    HAL_DISABLE_INTERRUPTS();
-  }
-  else
-    return ( INVALID_INTERRUPT_ID );
-
-  return ( ZSUCCESS );
-}
-
-/*********************************************************************
- * @fn      osal_init_system
- *
- * @brief
- *
- *   This function initializes the "task" system by creating the
- *   tasks defined in the task table (OSAL_Tasks.h).
- *
- * @param   void
- *
- * @return  ZSUCCESS
- */
-byte osal_init_system( void )
-{
-  // Initialize the Memory Allocation System
-  osal_mem_init();
-
-  // Initialize the message queue
-  osal_qHead = NULL;
-
-#if defined( OSAL_TOTAL_MEM )
-  osal_msg_cnt = 0;
-#endif
-
-  // Initialize the timers
-  osalTimerInit();
-
-  // Initialize the Power Management System
-  osal_pwrmgr_init();
-
-  // Initialize the tasking system
-  osalTaskInit();
-  osalAddTasks();
-  osalInitTasks();
-
-  // Setup efficient search for the first free block of heap.
-  osal_mem_kick();
-
-  return ( ZSUCCESS );
-}
-
-/*********************************************************************
- * @fn      osal_start_system
- *
- * @brief
- *
- *   This function is the main loop function of the task system.  It
- *   will look through all task events and call the task_event_processor()
- *   function for the task with the event.  If there are no events (for
- *   all tasks), this function puts the processor into Sleep.
- *   This Function doesn't return.
- *
- * @param   void
- *
- * @return  none
- */
-void osal_start_system( void )
-{
-  uint16 events;
-  uint16 retEvents;
-  byte activity;
-  halIntState_t intState;
-
-  // Forever Loop
-#if !defined ( ZBIT )
-  for(;;)
-#endif
-  {
-
-    /* This replaces MT_SerialPoll() and osal_check_timer() */
-    Hal_ProcessPoll();
-
-    activity = false;
-
-    activeTask = osalNextActiveTask();
-    if ( activeTask )
-    {
-      HAL_ENTER_CRITICAL_SECTION(intState);
-      events = activeTask->events;
-      // Clear the Events for this task
-      activeTask->events = 0;
-      HAL_EXIT_CRITICAL_SECTION(intState);
-
-      if ( events != 0 )
-      {
-        // Call the task to process the event(s)
-        if ( activeTask->pfnEventProcessor )
-        {
-          retEvents = (activeTask->pfnEventProcessor)( activeTask->taskID, events );
-
-          // Add back unprocessed events to the current task
-          HAL_ENTER_CRITICAL_SECTION(intState);
-          activeTask->events |= retEvents;
-          HAL_EXIT_CRITICAL_SECTION(intState);
-
-          activity = true;
-        }
-      }
-    }
-
-    // Complete pass through all task events with no activity?
-    if ( activity == false )
-    {
-#if defined( POWER_SAVING )
-      // Put the processor/system into sleep
-      osal_pwrmgr_powerconserve();
-#endif
-    }
-  }
-}
-
-/*********************************************************************
- * @fn      osal_self
- *
- * @brief
- *
- *   This function returns the task ID of the calling (current) task.
- *
- * @param   void
- *
- * @return  byte task ID, 0xFF bad task ID
- */
-byte osal_self( void )
-{
-  if ( activeTask )
-    return ( activeTask->taskID );
-  else
-    return ( TASK_NO_TASK );
-}
-
-/*********************************************************************
-*********************************************************************/
+/*********************************************************************
+    Filename:       OSAL.c
+    Revised:        $Date: 2006-10-26 11:15:57 -0700 (Thu, 26 Oct 2006) $
+    Revision:       $Revision: 12421 $
+
+    Description:
+
+       This API allows the software components in the Z-stack to be
+       written independently of the specifics of the operating system,
+       kernel or tasking environment (including control loops or
+       connect-to-interrupt systems).
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+
+/*********************************************************************
+ * INCLUDES
+ */
+//#ifdef WIN32
+//  #include <stdio.h>
+//#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Custom.h"
+#include "OSAL_Memory.h"
+#include "OSAL_PwrMgr.h"
+#include "hal_mcu.h"
+
+#include "OnBoard.h"
+
+/* HAL */
+#include "hal_drivers.h"
+#if ( OSALMEM_TRACE )
+  #include "hal_uart.h"
+#endif
+
+/*********************************************************************
+ * MACROS
+ */
+
+#define OSAL_MSG_LEN(msg_ptr)      ((osal_msg_hdr_t *) (msg_ptr) - 1)->len
+
+#define OSAL_MSG_ID(msg_ptr)      ((osal_msg_hdr_t *) (msg_ptr) - 1)->dest_id
+
+/*********************************************************************
+ * CONSTANTS
+ */
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+
+#if ( OSAL_MSG_POOLS )
+typedef struct
+{
+  byte *start;           // First block of the pool storage.
+  byte *end;             // First byte past the pool storage.
+  osal_msg_hdr_t *free;  // First free block, linked through 'next'.
+  osal_msg_pool_stats_t stats;
+} osal_msg_pool_t;
+#endif
+
+typedef struct
+{
+  // Task message queues, indexed by task ID.
+  osal_msg_q_t qHead[OSAL_MAX_TASKS];
+  void *qTail[OSAL_MAX_TASKS];
+  osal_msg_q_stats_t qStats[OSAL_MAX_TASKS];
+
+#if ( OSAL_MSG_BUDGET )
+  byte qBudget[OSAL_MAX_TASKS];  // Messages per handler call, 0 for no limit.
+  byte budgetTask;               // Task whose handler is running on a budget.
+  byte budget;                   // Messages it may still receive.
+#endif
+
+#if defined( OSAL_TOTAL_MEM )
+  UINT16 msgCnt;
+#endif
+
+#if ( OSAL_MSG_POOLS )
+  // Message pools, in increasing order of message length.
+  osal_msg_pool_t pool[OSAL_MSG_POOL_MAX];
+  byte poolCnt;
+#endif
+
+#if ( OSAL_MSG_RESERVE )
+  osal_msg_hdr_t *reserve;  // Reserve blocks, linked through 'next'.
+  osal_msg_reserve_stats_t reserveStats;
+  byte reserveArmed;
+  byte reserveFilling;      // Blocks being allocated into the reserve.
+#endif
+} osalMsgCtx_t;
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+
+#if ( OSAL_MULTI_INSTANCE )
+  static osalMsgCtx_t *osalMsgCur;
+  #define osalMsgCtx  (*osalMsgCur)
+#else
+  static osalMsgCtx_t osalMsgCtx;
+#endif
+
+
+/*********************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ */
+
+#if ( OSAL_MSG_POOLS )
+static osal_msg_hdr_t *osalMsgPoolAlloc( uint16 len );
+static byte osalMsgPoolFree( osal_msg_hdr_t *hdr );
+#endif
+
+#if ( OSAL_MSG_RESERVE )
+static osal_msg_hdr_t *osalMsgReserveAlloc( uint16 len );
+static void osalMsgReserveFill( void );
+#endif
+
+#if ( OSALMEM_TRACE )
+static void osalMemTraceFlush( void );
+#endif
+
+/*********************************************************************
+ * HELPER FUNCTIONS
+ */
+/* very ugly stub so Keil can compile */
+#ifdef __KEIL__
+char *  itoa ( int value, char * buffer, int radix )
+{
+  return(buffer);
+}
+#endif
+
+/*********************************************************************
+ * @fn      osal_strlen
+ *
+ * @brief
+ *
+ *   Calculates the length of a string.  The string must be null
+ *   terminated.
+ *
+ * @param   char *pString - pointer to text string
+ *
+ * @return  int - number of characters
+ */
+int osal_strlen( char *pString )
+{
+  return strlen( pString );
+}
+
+/*********************************************************************
+ * @fn      osal_memcpy
+ *
+ * @brief
+ *
+ *   Generic memory copy.
+ *
+ *   Note: This function differs from the standard memcpy(), since
+ *         it returns the pointer to the next destination byte. The
+ *         standard memcpy() returns the original destination address.
+ *
+ * @param   dst - destination address
+ * @param   src - source address
+ * @param   len - number of bytes to copy
+ *
+ * @return  pointer to end of destination buffer
+ */
+void *osal_memcpy( void *dst, const void GENERIC *src, unsigned int len )
+{
+  byte *pDst;
+  const byte GENERIC *pSrc;
+
+  pSrc = src;
+  pDst = dst;
+
+  while ( len-- )
+    *pDst++ = *pSrc++;
+
+  return ( pDst );
+}
+
+/*********************************************************************
+ * @fn      osal_cpyExtAddr
+ *
+ * @brief
+ *
+ *   Copy extended addresses.  This function will copy 8 bytes.
+ *
+ * @param   dest  destination address pointer
+ * @param   src   source address pointer
+ *
+ * @return  dest + Z_EXTADDR_LEN
+ */
+void *osal_cpyExtAddr( void *dest, void *src )
+{
+  return osal_memcpy( dest, src, Z_EXTADDR_LEN );
+}
+
+/*********************************************************************
+ * @fn      osal_memset
+ *
+ * @brief
+ *
+ *   Set memory buffer to value.
+ *
+ * @param   dest - pointer to buffer
+ * @param   value - what to set each byte of the message
+ * @param   size - how big
+ *
+ * @return  value of next widget, 0 if no widget found
+ */
+void *osal_memset( void *dest, byte value, int len )
+{
+  return memset( dest, value, len );
+}
+
+/*********************************************************************
+ * @fn      osal_build_uint16
+ *
+ * @brief
+ *
+ *   Build a uint16 out of 2 bytes (0 then 1).
+ *
+ * @param   swapped - 0 then 1
+ *
+ * @return  uint16
+ */
+uint16 osal_build_uint16( byte *swapped )
+{
+  return ( BUILD_UINT16( swapped[0], swapped[1] ) );
+}
+
+/*********************************************************************
+ * @fn      osal_build_uint32
+ *
+ * @brief
+ *
+ *   Build a uint32 out of sequential bytes.
+ *
+ * @param   swapped - sequential bytes
+ * @param   len - number of bytes in the byte array
+ *
+ * @return  uint32
+ */
+uint32 osal_build_uint32( byte *swapped, byte len )
+{
+  if ( len == 2 )
+    return ( BUILD_UINT32( swapped[0], swapped[1], 0L, 0L ) );
+  else if ( len == 3 )
+    return ( BUILD_UINT32( swapped[0], swapped[1], swapped[2], 0L ) );
+  else if ( len == 4 )
+    return ( BUILD_UINT32( swapped[0], swapped[1], swapped[2], swapped[3] ) );
+  else
+    return ( (uint32)swapped[0] );
+}
+
+#if !defined ( ZBIT ) && !defined ( ZBIT2 )
+/*********************************************************************
+ * @fn      _ltoa
+ *
+ * @brief
+ *
+ *   convert a long unsigned int to a string.
+ *
+ * @param  l - long to convert
+ * @param  buf - buffer to convert to
+ * @param  radix - 10 dec, 16 hex
+ *
+ * @return  pointer to buffer
+ */
+byte * _ltoa(uint32 l, byte *buf, byte radix)
+{
+#if defined( __GNUC__ )
+  return ( (byte *)ltoa( l, (char *)buf, radix ) );
+#else
+  unsigned char tmp1[10] = "", tmp2[10] = "", tmp3[10] = "";
+  unsigned short num1, num2, num3;
+  unsigned char i;
+
+  buf[0] = '\0';
+
+  if ( radix == 10 )
+  {
+    num1 = l % 10000;
+    num2 = (l / 10000) % 10000;
+    num3 = (unsigned short)(l / 100000000);
+
+    if (num3) _itoa(num3, tmp3, 10);
+    if (num2) _itoa(num2, tmp2, 10);
+    if (num1) _itoa(num1, tmp1, 10);
+
+    if (num3)
+    {
+      strcpy((char*)buf, (char const*)tmp3);
+      for (i = 0; i < 4 - strlen((char const*)tmp2); i++)
+        strcat((char*)buf, "0");
+    }
+    strcat((char*)buf, (char const*)tmp2);
+    if (num3 || num2)
+    {
+      for (i = 0; i < 4 - strlen((char const*)tmp1); i++)
+        strcat((char*)buf, "0");
+    }
+    strcat((char*)buf, (char const*)tmp1);
+    if (!num3 && !num2 && !num1)
+      strcpy((char*)buf, "0");
+  }
+  else if ( radix == 16 )
+  {
+    num1 = l & 0x0000FFFF;
+    num2 = l >> 16;
+
+    if (num2) _itoa(num2, tmp2, 16);
+    if (num1) _itoa(num1, tmp1, 16);
+
+    if (num2)
+    {
+      strcpy((char*)buf,(char const*)tmp2);
+      for (i = 0; i < 4 - strlen((char const*)tmp1); i++)
+        strcat((char*)buf, "0");
+    }
+    strcat((char*)buf, (char const*)tmp1);
+    if (!num2 && !num1)
+      strcpy((char*)buf, "0");
+  }
+  else
+    return NULL;
+
+  return buf;
+#endif
+}
+#endif // !defined(ZBIT) && !defined(ZBIT2)
+
+/*********************************************************************
+ * @fn          osal_AddrEqual
+ *
+ * @brief       Compares two address_t structures.
+ *
+ * @param       a1 - first Address
+ * @param       a2 - second endpoint
+ *
+ * @return      true - addresses are equal, false - not equal
+ */
+byte osal_AddrEqual( zAddrType_t *a1, zAddrType_t *a2 )
+{
+  if ( a1->addrMode != a2->addrMode )
+    return ( false );
+
+  else if (a1->addrMode == AddrNotPresent )
+    return ( true );
+
+  else if (a1->addrMode == Addr16Bit )
+    return ( a1->addr.shortAddr == a2->addr.shortAddr );
+
+  else if ( a1->addrMode == Addr64Bit )
+    return ( osal_ExtAddrEqual( a1->addr.extAddr, a2->addr.extAddr ) );
+
+  else
+    return ( false );
+}
+
+/*********************************************************************
+ * @fn      osal_ExtAddrEqual()
+ *
+ * @brief   Verify that the extended addresses are equal.
+ *
+ * @param   extAddr1 - extended address
+ * @param   extAddr2 - extended address
+ *
+ * @return  TRUE - If addresses are same
+ *          FALSE  - If not same
+ */
+byte osal_ExtAddrEqual( byte *extAddr1, byte *extAddr2 )
+{
+  byte i;
+
+  for ( i = Z_EXTADDR_LEN; i ; i-- )
+  {
+    if ( *extAddr1++ != *extAddr2++ )
+      return ( false );
+  }
+
+  return ( true );
+}
+
+/*********************************************************************
+ * @fn        osal_rand
+ *
+ * @brief    Random number generator
+ *
+ * @param   none
+ *
+ * @return  uint16 - new random number
+ */
+uint16 osal_rand( void )
+{
+  return ( Onboard_rand() );
+}
+
+/*********************************************************************
+ * API FUNCTIONS
+ *********************************************************************/
+
+/*********************************************************************
+ * @fn      osal_msg_allocate
+ *
+ * @brief
+ *
+ *    This function is called by a task to allocate a message buffer
+ *    into which the task will encode the particular message it wishes
+ *    to send.  This common buffer scheme is used to strictly limit the
+ *    creation of message buffers within the system due to RAM size
+ *    limitations on the microprocessor.   Note that all message buffers
+ *    are a fixed size (at least initially).  The parameter len is kept
+ *    in case a message pool with varying fixed message sizes is later
+ *    created (for example, a pool of message buffers of size LARGE,
+ *    MEDIUM and SMALL could be maintained and allocated based on request
+ *    from the tasks).
+ *
+ *
+ * @param   byte len  - wanted buffer length
+ *
+ *
+ * @return  pointer to allocated buffer or NULL if allocation failed.
+ */
+byte * osal_msg_allocate( uint16 len )
+{
+  osal_msg_hdr_t *hdr;
+
+  if ( len == 0 )
+    return ( NULL );
+
+#if ( OSAL_MSG_POOLS )
+  // Try the best-fit message pool before falling back to the heap.
+  hdr = osalMsgPoolAlloc( len );
+  if ( hdr == NULL )
+#endif
+  hdr = (osal_msg_hdr_t *) osal_mem_alloc( (short)(len + sizeof( osal_msg_hdr_t )) );
+
+#if ( OSAL_MSG_RESERVE )
+  if ( (hdr == NULL) && osalMsgCtx.reserveArmed )
+  {
+    hdr = osalMsgReserveAlloc( len );
+  }
+#endif
+
+  if ( hdr )
+  {
+    hdr->next = NULL;
+    hdr->len = len;
+    hdr->dest_id = TASK_NO_TASK;
+
+#if defined( OSAL_TOTAL_MEM )
+    osalMsgCtx.msgCnt++;
+#endif
+    return ( (byte *) (hdr + 1) );
+  }
+  else
+    return ( NULL );
+}
+
+/*********************************************************************
+ * @fn      osal_msg_deallocate
+ *
+ * @brief
+ *
+ *    This function is used to deallocate a message buffer. This function
+ *    is called by a task (or processing element) after it has finished
+ *    processing a received message.
+ *
+ *
+ * @param   byte *msg_ptr - pointer to new message buffer
+ *
+ * @return  ZSUCCESS, INVALID_MSG_POINTER
+ */
+byte osal_msg_deallocate( byte *msg_ptr )
+{
+  byte *x;
+
+  if ( msg_ptr == NULL )
+    return ( INVALID_MSG_POINTER );
+
+  // don't deallocate queued buffer
+  if ( OSAL_MSG_ID( msg_ptr ) != TASK_NO_TASK )
+    return ( MSG_BUFFER_NOT_AVAIL );
+
+  x = (byte *)((byte *)msg_ptr - sizeof( osal_msg_hdr_t ));
+
+#if ( OSAL_MSG_POOLS )
+  if ( osalMsgPoolFree( (osal_msg_hdr_t *)x ) == FALSE )
+#endif
+  {
+    osal_mem_free( (void *)x );
+
+#if ( OSAL_MSG_RESERVE )
+    // Heap memory was released, so top up the message reserve.
+    if ( osalMsgCtx.reserveStats.avail < osalMsgCtx.reserveStats.cnt )
+    {
+      osalMsgReserveFill();
+    }
+#endif
+  }
+
+#if defined( OSAL_TOTAL_MEM )
+  if ( osalMsgCtx.msgCnt )
+    osalMsgCtx.msgCnt--;
+#endif
+
+  return ( ZSUCCESS );
+}
+
+#if ( OSAL_MSG_POOLS )
+/*********************************************************************
+ * @fn      osal_msg_pool_add
+ *
+ * @brief
+ *
+ *    This function adds a pool of fixed-size message blocks. Messages
+ *    of up to 'len' bytes are drawn from the pool before the heap is
+ *    used. Pools must be added in increasing order of 'len', normally
+ *    from osalAddMsgPools().
+ *
+ * @param   byte *buf - storage of OSAL_MSG_POOL_BUF_SIZE( len, cnt ) bytes
+ * @param   uint16 len - message length served by each block
+ * @param   byte cnt - number of blocks in the pool
+ *
+ * @return  ZSUCCESS, INVALID_LEN, MSG_BUFFER_NOT_AVAIL
+ */
+byte osal_msg_pool_add( byte *buf, uint16 len, byte cnt )
+{
+  osal_msg_pool_t *pool;
+  osal_msg_hdr_t *hdr;
+  uint16 blkSz = sizeof( osal_msg_hdr_t ) + len;
+
+  if ( (buf == NULL) || (cnt == 0) || (osalMsgCtx.poolCnt >= OSAL_MSG_POOL_MAX) )
+    return ( MSG_BUFFER_NOT_AVAIL );
+
+  if ( (len == 0) ||
+       ((osalMsgCtx.poolCnt != 0) && (osalMsgCtx.pool[osalMsgCtx.poolCnt-1].stats.len >= len)) )
+    return ( INVALID_LEN );
+
+  pool = &osalMsgCtx.pool[osalMsgCtx.poolCnt];
+  pool->start = buf;
+  pool->end = buf + ((uint16)cnt * blkSz);
+  pool->free = NULL;
+
+  osal_memset( &pool->stats, 0, sizeof( osal_msg_pool_stats_t ) );
+  pool->stats.len = len;
+  pool->stats.cnt = cnt;
+
+  // Link the blocks so that the lowest address is handed out first
+  while ( cnt-- )
+  {
+    hdr = (osal_msg_hdr_t *)(buf + ((uint16)cnt * blkSz));
+    hdr->next = pool->free;
+    pool->free = hdr;
+  }
+
+  osalMsgCtx.poolCnt++;
+
+  return ( ZSUCCESS );
+}
+
+/*********************************************************************
+ * @fn      osal_msg_pool_stats
+ *
+ * @brief
+ *
+ *    This function returns the counters of a message pool: hits, misses
+ *    and the high-water mark of blocks in use. Use them to size the
+ *    pools in osalAddMsgPools() from field data.
+ *
+ * @param   byte pool - pool index, in order of osal_msg_pool_add() calls
+ *
+ * @return  pointer to the pool counters, NULL if no such pool
+ */
+const osal_msg_pool_stats_t *osal_msg_pool_stats( byte pool )
+{
+  if ( pool >= osalMsgCtx.poolCnt )
+    return ( NULL );
+
+  return ( &osalMsgCtx.pool[pool].stats );
+}
+
+/*********************************************************************
+ * @fn      osalMsgPoolAlloc
+ *
+ * @brief
+ *
+ *    Take a block from the smallest message pool that fits 'len'. When
+ *    that pool is empty a miss is counted and the caller falls back to
+ *    the heap.
+ *
+ * @param   uint16 len - wanted message length
+ *
+ * @return  message header of the block, NULL if none available
+ */
+static osal_msg_hdr_t *osalMsgPoolAlloc( uint16 len )
+{
+  osal_msg_pool_t *pool;
+  osal_msg_hdr_t *hdr = NULL;
+  halIntState_t intState;
+  byte idx;
+
+  for ( idx = 0; idx < osalMsgCtx.poolCnt; idx++ )
+  {
+    pool = &osalMsgCtx.pool[idx];
+    if ( pool->stats.len >= len )
+    {
+      // Hold off interrupts
+      HAL_ENTER_CRITICAL_SECTION(intState);
+
+      hdr = pool->free;
+      if ( hdr )
+      {
+        pool->free = hdr->next;
+        pool->stats.hit++;
+        if ( ++pool->stats.used > pool->stats.highWater )
+          pool->stats.highWater = pool->stats.used;
+      }
+      else
+      {
+        pool->stats.miss++;
+      }
+
+      // Release interrupts
+      HAL_EXIT_CRITICAL_SECTION(intState);
+      break;
+    }
+  }
+
+  return ( hdr );
+}
+
+/*********************************************************************
+ * @fn      osalMsgPoolFree
+ *
+ * @brief
+ *
+ *    Return a message block to the pool that owns it.
+ *
+ * @param   osal_msg_hdr_t *hdr - message header of the block
+ *
+ * @return  TRUE if the block belongs to a pool, FALSE if it is heap memory
+ */
+static byte osalMsgPoolFree( osal_msg_hdr_t *hdr )
+{
+  osal_msg_pool_t *pool;
+  halIntState_t intState;
+  byte idx;
+
+  for ( idx = 0; idx < osalMsgCtx.poolCnt; idx++ )
+  {
+    pool = &osalMsgCtx.pool[idx];
+    if ( ((byte *)hdr >= pool->start) && ((byte *)hdr < pool->end) )
+    {
+      // Hold off interrupts
+      HAL_ENTER_CRITICAL_SECTION(intState);
+
+      hdr->next = pool->free;
+      pool->free = hdr;
+      pool->stats.used--;
+
+      // Release interrupts
+      HAL_EXIT_CRITICAL_SECTION(intState);
+
+      return ( TRUE );
+    }
+  }
+
+  return ( FALSE );
+}
+#endif
+
+#if ( OSAL_MSG_RESERVE )
+/*********************************************************************
+ * @fn      osal_msg_reserve_set
+ *
+ * @brief
+ *
+ *    This function sizes the message reserve and fills it from the
+ *    heap. Messages of up to 'len' bytes allocated while the reserve is
+ *    armed are served from it when the heap cannot serve them. The
+ *    reserve is refilled each time a heap message is deallocated, so it
+ *    only grows back once memory has been released. Call it once, from
+ *    osalAddMsgPools(), which osal_init_system() calls whether or not
+ *    OSAL_MSG_POOLS is set.
+ *
+ * @param   uint16 len - message length served by each reserve block
+ * @param   byte cnt - number of blocks to keep in reserve
+ *
+ * @return  none
+ */
+void osal_msg_reserve_set( uint16 len, byte cnt )
+{
+  osalMsgCtx.reserveStats.len = len;
+  osalMsgCtx.reserveStats.cnt = cnt;
+
+  osalMsgReserveFill();
+  osalMsgCtx.reserveStats.lowWater = osalMsgCtx.reserveStats.avail;
+}
+
+/*********************************************************************
+ * @fn      osal_msg_reserve_arm
+ *
+ * @brief
+ *
+ *    This function arms the message reserve around an allocation that
+ *    must not fail for lack of heap, e.g. a MAC receive buffer.
+ *
+ * @param   byte armed - TRUE before the allocation, FALSE after it
+ *
+ * @return  none
+ */
+void osal_msg_reserve_arm( byte armed )
+{
+  osalMsgCtx.reserveArmed = armed;
+}
+
+/*********************************************************************
+ * @fn      osal_msg_reserve_stats
+ *
+ * @brief
+ *
+ *    This function returns the counters of the message reserve.
+ *
+ * @param   void
+ *
+ * @return  pointer to the reserve counters
+ */
+const osal_msg_reserve_stats_t *osal_msg_reserve_stats( void )
+{
+  return ( &osalMsgCtx.reserveStats );
+}
+
+/*********************************************************************
+ * @fn      osalMsgReserveAlloc
+ *
+ * @brief
+ *
+ *    Take a block from the message reserve.
+ *
+ * @param   uint16 len - wanted message length
+ *
+ * @return  message header of the block, NULL if none fits
+ */
+static osal_msg_hdr_t *osalMsgReserveAlloc( uint16 len )
+{
+  osal_msg_hdr_t *hdr = NULL;
+  halIntState_t intState;
+
+  // Hold off interrupts
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  if ( (osalMsgCtx.reserve != NULL) && (len <= osalMsgCtx.reserveStats.len) )
+  {
+    hdr = osalMsgCtx.reserve;
+    osalMsgCtx.reserve = hdr->next;
+    osalMsgCtx.reserveStats.hit++;
+
+    if ( osalMsgCtx.reserveStats.lowWater > --osalMsgCtx.reserveStats.avail )
+    {
+      osalMsgCtx.reserveStats.lowWater = osalMsgCtx.reserveStats.avail;
+    }
+  }
+  else
+  {
+    osalMsgCtx.reserveStats.miss++;
+  }
+
+  // Release interrupts
+  HAL_EXIT_CRITICAL_SECTION(intState);
+
+  return ( hdr );
+}
+
+/*********************************************************************
+ * @fn      osalMsgReserveFill
+ *
+ * @brief
+ *
+ *    Allocate heap blocks into the message reserve until it is full or
+ *    the heap cannot serve another block. A slot is claimed before its
+ *    block is allocated, under the same critical section as the check,
+ *    so an interrupt refilling the reserve meanwhile cannot overfill it.
+ *    The blocks are held for the system, outside any task's quota.
+ *
+ * @param   void
+ *
+ * @return  none
+ */
+static void osalMsgReserveFill( void )
+{
+  osal_msg_hdr_t *hdr;
+  halIntState_t intState;
+  byte claimed;
+
+  do
+  {
+    // Hold off interrupts
+    HAL_ENTER_CRITICAL_SECTION(intState);
+
+    claimed = ( (osalMsgCtx.reserveStats.avail + osalMsgCtx.reserveFilling) <
+                osalMsgCtx.reserveStats.cnt );
+    if ( claimed )
+      osalMsgCtx.reserveFilling++;
+
+    // Release interrupts
+    HAL_EXIT_CRITICAL_SECTION(intState);
+
+    if ( !claimed )
+      break;
+
+#if ( OSALMEM_OWNERS )
+    // Held for the system, not charged to the task that freed memory.
+    osal_mem_system( TRUE );
+#endif
+    hdr = (osal_msg_hdr_t *) osal_mem_alloc(
+                 (short)(osalMsgCtx.reserveStats.len + sizeof( osal_msg_hdr_t )) );
+#if ( OSALMEM_OWNERS )
+    osal_mem_system( FALSE );
+#endif
+
+    // Hold off interrupts
+    HAL_ENTER_CRITICAL_SECTION(intState);
+
+    osalMsgCtx.reserveFilling--;
+    if ( hdr != NULL )
+    {
+      hdr->next = osalMsgCtx.reserve;
+      osalMsgCtx.reserve = hdr;
+      osalMsgCtx.reserveStats.avail++;
+    }
+
+    // Release interrupts
+    HAL_EXIT_CRITICAL_SECTION(intState);
+  } while ( hdr != NULL );
+}
+#endif
+
+#if ( OSALMEM_TRACE )
+/*********************************************************************
+ * @fn      osalMemTraceFlush
+ *
+ * @brief
+ *
+ *    Hand the pending heap trace records to the UART, one whole record
+ *    per write, so that a record never straddles a full Tx buffer. The
+ *    records that do not fit stay queued for the next pass.
+ *
+ * @param   void
+ *
+ * @return  none
+ */
+static void osalMemTraceFlush( void )
+{
+  uint16 len;
+  byte *buf = osal_mem_trace_peek( &len );
+
+  while ( len >= OSALMEM_TRACE_RECSZ )
+  {
+    if ( HalUARTWrite( OSALMEM_TRACE_PORT, buf, OSALMEM_TRACE_RECSZ ) != OSALMEM_TRACE_RECSZ )
+      break;
+
+    osal_mem_trace_consume( OSALMEM_TRACE_RECSZ );
+    buf += OSALMEM_TRACE_RECSZ;
+    len -= OSALMEM_TRACE_RECSZ;
+  }
+}
+#endif
+
+#if defined( OSAL_TOTAL_MEM )
+/*********************************************************************
+ * @fn      osal_num_msgs
+ *
+ * @brief
+ *
+ *    This function returns the number of allocated messages
+ *
+ * @param   void
+ *
+ * @return  UINT16 - number of msgs out
+ */
+UINT16 osal_num_msgs( void )
+{
+  return ( osalMsgCtx.msgCnt );
+}
+#endif
+
+/*********************************************************************
+ * @fn      osal_msg_send
+ *
+ * @brief
+ *
+ *    This function is called by a task to send a command message to
+ *    another task or processing element.  The sending_task field must
+ *    refer to a valid task, since the task ID will be used
+ *    for the response message.  This function will also set a message
+ *    ready event in the destination tasks event list.
+ *
+ *
+ * @param   byte destination task - Send msg to?  Task ID
+ * @param   byte *msg_ptr - pointer to new message buffer
+ * @param   byte len - length of data in message
+ *
+ * @return  ZSUCCESS, INVALID_SENDING_TASK, INVALID_DESTINATION_TASK,
+ *          INVALID_MSG_POINTER, INVALID_LEN
+ */
+byte osal_msg_send( byte destination_task, byte *msg_ptr )
+{
+  osal_msg_q_stats_t *qStats;
+  halIntState_t intState;
+
+  if ( msg_ptr == NULL )
+    return ( INVALID_MSG_POINTER );
+
+  if ( osalFindTask( destination_task ) == NULL )
+  {
+    osal_msg_deallocate( msg_ptr );
+    return ( INVALID_TASK );
+  }
+
+  // Check the message header
+  if ( OSAL_MSG_NEXT( msg_ptr ) != NULL ||
+       OSAL_MSG_ID( msg_ptr ) != TASK_NO_TASK )
+  {
+    osal_msg_deallocate( msg_ptr );
+    return ( INVALID_MSG_POINTER );
+  }
+
+  OSAL_MSG_ID( msg_ptr ) = destination_task;
+
+#if ( OSALMEM_OWNERS )
+  // The queued message is now held by the destination task.
+  osal_mem_set_owner( (osal_msg_hdr_t *)msg_ptr - 1, destination_task );
+#endif
+
+  // queue message at the tail of the task's queue
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  if ( osalMsgCtx.qHead[destination_task] == NULL )
+    osalMsgCtx.qHead[destination_task] = msg_ptr;
+  else
+    OSAL_MSG_NEXT( osalMsgCtx.qTail[destination_task] ) = msg_ptr;
+  osalMsgCtx.qTail[destination_task] = msg_ptr;
+
+  qStats = &osalMsgCtx.qStats[destination_task];
+  if ( qStats->highWater < ++qStats->depth )
+    qStats->highWater = qStats->depth;
+
+  HAL_EXIT_CRITICAL_SECTION(intState);
+
+  // Signal the task that a message is waiting
+  osal_set_event( destination_task, SYS_EVENT_MSG );
+
+  return ( ZSUCCESS );
+}
+
+/*********************************************************************
+ * @fn      osal_msg_receive
+ *
+ * @brief
+ *
+ *    This function is called by a task to retrieve a received command
+ *    message. The calling task must deallocate the message buffer after
+ *    processing the message using the osal_msg_deallocate() call.
+ *
+ * @param   byte task_id - receiving tasks ID
+ *
+ * @return  *byte - message information or NULL if no message
+ */
+byte *osal_msg_receive( byte task_id )
+{
+  osal_msg_hdr_t *listHdr;
+  halIntState_t   intState;
+
+  if ( task_id >= OSAL_MAX_TASKS )
+    return NULL;
+
+#if ( OSAL_MSG_BUDGET )
+  // A task that used its budget gets the rest on its next turn
+  if ( (task_id == osalMsgCtx.budgetTask) && (osalMsgCtx.budget == 0) )
+    return NULL;
+#endif
+
+  // Hold off interrupts
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  // The oldest message of the asking task is at the top of its queue
+  listHdr = osalMsgCtx.qHead[task_id];
+
+  if ( listHdr != NULL )
+  {
+    // Take out of the link list
+    osalMsgCtx.qHead[task_id] = OSAL_MSG_NEXT( listHdr );
+    OSAL_MSG_NEXT( listHdr ) = NULL;
+    OSAL_MSG_ID( listHdr ) = TASK_NO_TASK;
+    osalMsgCtx.qStats[task_id].depth--;
+
+#if ( OSAL_MSG_BUDGET )
+    if ( task_id == osalMsgCtx.budgetTask )
+      osalMsgCtx.budget--;
+#endif
+  }
+
+  // Release interrupts
+  HAL_EXIT_CRITICAL_SECTION(intState);
+
+  return ( (byte*) listHdr );
+}
+
+/*********************************************************************
+ * @fn      osal_msg_q_stats
+ *
+ * @brief
+ *
+ *    This function returns the counters of a task's message queue:
+ *    the messages now queued and the most ever queued at once.
+ *
+ * @param   byte task_id - task ID of the queue
+ *
+ * @return  pointer to the queue counters, NULL if no such task
+ */
+const osal_msg_q_stats_t *osal_msg_q_stats( byte task_id )
+{
+  if ( osalFindTask( task_id ) == NULL )
+    return ( NULL );
+
+  return ( &osalMsgCtx.qStats[task_id] );
+}
+
+#if ( OSAL_MSG_BUDGET )
+/*********************************************************************
+ * @fn      osal_msg_budget
+ *
+ * @brief
+ *
+ *    This function sets how many messages a task receives per call of
+ *    its event handler. Once it has received them, osal_msg_receive()
+ *    returns NULL until the next call, so a handler that drains its
+ *    queue yields to higher priority tasks. Messages left are kept and
+ *    SYS_EVENT_MSG is set again.
+ *
+ * @param   byte task_id - task ID of the queue
+ * @param   byte budget - messages per handler call, 0 for no limit
+ *
+ * @return  ZSUCCESS, INVALID_TASK
+ */
+byte osal_msg_budget( byte task_id, byte budget )
+{
+  if ( osalFindTask( task_id ) == NULL )
+    return ( INVALID_TASK );
+
+  osalMsgCtx.qBudget[task_id] = budget;
+
+  return ( ZSUCCESS );
+}
+#endif
+
+/*********************************************************************
+ * @fn      osal_msg_enqueue
+ *
+ * @brief
+ *
+ *    This function enqueues an OSAL message into an OSAL queue.
+ *
+ * @param   osal_msg_q_t *q_ptr - OSAL queue
+ * @param   void *msg_ptr  - OSAL message
+ *
+ * @return  none
+ */
+void osal_msg_enqueue( osal_msg_q_t *q_ptr, void *msg_ptr )
+{
+  void *list;
+  halIntState_t intState;
+
+  // Hold off interrupts
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  // If first message in queue
+  if ( *q_ptr == NULL )
+  {
+    *q_ptr = msg_ptr;
+  }
+  else
+  {
+    // Find end of queue
+    for ( list = *q_ptr; OSAL_MSG_NEXT( list ) != NULL; list = OSAL_MSG_NEXT( list ) );
+
+    // Add message to end of queue
+    OSAL_MSG_NEXT( list ) = msg_ptr;
+  }
+
+  // Re-enable interrupts
+  HAL_EXIT_CRITICAL_SECTION(intState);
+}
+
+/*********************************************************************
+ * @fn      osal_msg_dequeue
+ *
+ * @brief
+ *
+ *    This function dequeues an OSAL message from an OSAL queue.
+ *
+ * @param   osal_msg_q_t *q_ptr - OSAL queue
+ *
+ * @return  void * - pointer to OSAL message or NULL of queue is empty.
+ */
+void *osal_msg_dequeue( osal_msg_q_t *q_ptr )
+{
+  void *msg_ptr;
+  halIntState_t intState;
+
+  // Hold off interrupts
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  if ( *q_ptr == NULL )
+  {
+    HAL_EXIT_CRITICAL_SECTION(intState);
+    return NULL;
+  }
+
+  // Dequeue message
+  msg_ptr = *q_ptr;
+  *q_ptr = OSAL_MSG_NEXT( msg_ptr );
+  OSAL_MSG_NEXT( msg_ptr ) = NULL;
+  OSAL_MSG_ID( msg_ptr ) = TASK_NO_TASK;
+
+  // Re-enable interrupts
+  HAL_EXIT_CRITICAL_SECTION(intState);
+
+  return msg_ptr;
+}
+
+/*********************************************************************
+ * @fn      osal_msg_push
+ *
+ * @brief
+ *
+ *    This function pushes an OSAL message to the head of an OSAL
+ *    queue.
+ *
+ * @param   osal_msg_q_t *q_ptr - OSAL queue
+ * @param   void *msg_ptr  - OSAL message
+ *
+ * @return  none
+ */
+void osal_msg_push( osal_msg_q_t *q_ptr, void *msg_ptr )
+{
+  halIntState_t intState;
+
+  // Hold off interrupts
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  if ( *q_ptr == NULL )
+  {
+    *q_ptr = msg_ptr;
+  }
+  else
+  {
+    // Push message to head of queue
+    OSAL_MSG_NEXT( msg_ptr ) = *q_ptr;
+    *q_ptr = msg_ptr;
+  }
+
+  // Re-enable interrupts
+  HAL_EXIT_CRITICAL_SECTION(intState);
+}
+
+/*********************************************************************
+ * @fn      osal_msg_extract
+ *
+ * @brief
+ *
+ *    This function extracts and removes an OSAL message from the
+ *    middle of an OSAL queue.
+ *
+ * @param   osal_msg_q_t *q_ptr - OSAL queue
+ * @param   void *msg_ptr  - OSAL message to be extracted
+ * @param   void *prev_ptr  - OSAL message before msg_ptr in queue
+ *
+ * @return  none
+ */
+void osal_msg_extract( osal_msg_q_t *q_ptr, void *msg_ptr, void *prev_ptr )
+{
+  halIntState_t intState;
+
+  // Hold off interrupts
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  if ( msg_ptr == *q_ptr )
+  {
+    // remove from first
+    *q_ptr = OSAL_MSG_NEXT( msg_ptr );
+  }
+  else
+  {
+    // remove from middle
+    OSAL_MSG_NEXT( prev_ptr ) = OSAL_MSG_NEXT( msg_ptr );
+  }
+  OSAL_MSG_NEXT( msg_ptr ) = NULL;
+  OSAL_MSG_ID( msg_ptr ) = TASK_NO_TASK;
+
+  // Re-enable interrupts
+  HAL_EXIT_CRITICAL_SECTION(intState);
+}
+
+/*********************************************************************
+ * @fn      osal_msg_enqueue_max
+ *
+ * @brief
+ *
+ *    This function enqueues an OSAL message into an OSAL queue if
+ *    the length of the queue is less than max.
+ *
+ * @param   osal_msg_q_t *q_ptr - OSAL queue
+ * @param   void *msg_ptr  - OSAL message
+ * @param   byte max - maximum length of queue
+ *
+ * @return  TRUE if message was enqueued, FALSE otherwise
+ */
+byte osal_msg_enqueue_max( osal_msg_q_t *q_ptr, void *msg_ptr, byte max )
+{
+  void *list;
+  byte ret = FALSE;
+  halIntState_t intState;
+
+  // Hold off interrupts
+  HAL_ENTER_CRITICAL_SECTION(intState);
+
+  // If first message in queue
+  if ( *q_ptr == NULL )
+  {
+    *q_ptr = msg_ptr;
+    ret = TRUE;
+  }
+  else
+  {
+    // Find end of queue or max
+    list = *q_ptr;
+    max--;
+    while ( (OSAL_MSG_NEXT( list ) != NULL) && (max > 0) )
+    {
+      list = OSAL_MSG_NEXT( list );
+      max--;
+    }
+
+    // Add message to end of queue if max not reached
+    if ( max != 0 )
+    {
+      OSAL_MSG_NEXT( list ) = msg_ptr;
+      ret = TRUE;
+    }
+  }
+
+  // Re-enable interrupts
+  HAL_EXIT_CRITICAL_SECTION(intState);
+
+  return ret;
+}
+
+/*********************************************************************
+ * @fn      osal_set_event
+ *
+ * @brief
+ *
+ *    This function is called to set the event flags for a task.  The
+ *    event passed in is OR'd into the task's event variable.
+ *
+ * @param   byte task_id - receiving tasks ID
+ * @param   byte event_flag - what event to set
+ *
+ * @return  ZSUCCESS, INVALID_TASK
+ */
+byte osal_set_event( byte task_id, UINT16 event_flag )
+{
+  osalTaskRec_t *srchTask;
+  halIntState_t   intState;
+
+  srchTask = osalFindTask( task_id );
+  if ( srchTask ) {
+    // Hold off interrupts
+    HAL_ENTER_CRITICAL_SECTION(intState);
+#if ( OSAL_DISPATCH_STATS )
+    // The wait for dispatch starts with the first event
+    if ( srchTask->events == 0 )
+      srchTask->readyAt = OSAL_DISPATCH_CLOCK();
+#endif
+    // Stuff the event bit(s)
+    srchTask->events |= event_flag;
+    OSAL_TASK_READY( srchTask );
+    // Release interrupts
+    HAL_EXIT_CRITICAL_SECTION(intState);
+  }
+   else
+    return ( INVALID_TASK );
+
+  return ( ZSUCCESS );
+}
+
+/*********************************************************************
+ * @fn      osal_isr_register
+ *
+ * @brief
+ *
+ *   This function is called to register a service routine with an
+ *   interrupt. When the interrupt occurs, this service routine is called.
+ *
+ * @param   byte interrupt_id - Interrupt number
+ * @param   void (*isr_ptr)( byte* ) - function pointer to ISR
+ *
+ * @return  ZSUCCESS, INVALID_INTERRUPT_ID, or INVALID_ISR_PTR
+ */
+byte osal_isr_register( byte interrupt_id, void (*isr_ptr)( byte* ) )
+{
+  return ( ZSUCCESS );
+}
+
+/*********************************************************************
+ * @fn      osal_int_enable
+ *
+ * @brief
+ *
+ *   This function is called to enable an interrupt. Once enabled,
+ *   occurrence of the interrupt causes the service routine associated
+ *   with that interrupt to be called.
+ *
+ *   If INTS_ALL is the interrupt_id, interrupts (in general) are enabled.
+ *   If a single interrupt is passed in, then interrupts still have
+ *   to be enabled with another call to INTS_ALL.
+ *
+ * @param   byte interrupt_id - Interrupt number
+ *
+ * @return  ZSUCCESS or INVALID_INTERRUPT_ID
+ */
+byte osal_int_enable( byte interrupt_id )
+{
+
+  if ( interrupt_id == INTS_ALL )
+  {
+    HAL_ENABLE_INTERRUPTS();
+  }
+  else
+    return ( INVALID_INTERRUPT_ID );
+
+  return ( ZSUCCESS );
+}
+
+/*********************************************************************
+ * @fn      osal_int_disable
+ *
+ * @brief
+ *
+ *   This function is called to disable an interrupt. When a disabled
+ *   interrupt occurs, the service routine associated with that
+ *   interrupt is not called.
+ *
+ *   If INTS_ALL is the interrupt_id, interrupts (in general) are disabled.
+ *   If a single interrupt is passed in, then just that interrupt is disabled.
+ *
+ * @param   byte interrupt_id - Interrupt number
+ *
+ * @return  ZSUCCESS or INVALID_INTERRUPT_ID
+ */
+byte osal_int_disable( byte interrupt_id )
+{
+
+  if ( interrupt_id == INTS_ALL )
+  {
+    HAL_DISABLE_INTERRUPTS();
+  }
+  else
+    return ( INVALID_INTERRUPT_ID );
+
+  return ( ZSUCCESS );
+}
+
+/*********************************************************************
+ * @fn      osal_init_system
+ *
+ * @brief
+ *
+ *   This function initializes the "task" system by creating the
+ *   tasks defined in the task table (OSAL_Tasks.h).
+ *
+ * @param   void
+ *
+ * @return  ZSUCCESS
+ */
+byte osal_init_system( void )
+{
+  // Initialize the Memory Allocation System
+  osal_mem_init();
+
+#if ( OSAL_MSG_POOLS )
+  // Initialize the message pools
+  osalMsgCtx.poolCnt = 0;
+#endif
+
+#if ( OSAL_MSG_RESERVE )
+  // Initialize the message reserve
+  osalMsgCtx.reserve = NULL;
+  osal_memset( &osalMsgCtx.reserveStats, 0, sizeof( osalMsgCtx.reserveStats ) );
+  osalMsgCtx.reserveArmed = FALSE;
+  osalMsgCtx.reserveFilling = 0;
+#endif
+
+  // Add the message pools and size the message reserve
+  osalAddMsgPools();
+
+  // Initialize the message queues
+  osal_memset( osalMsgCtx.qHead, 0, sizeof( osalMsgCtx.qHead ) );
+  osal_memset( osalMsgCtx.qStats, 0, sizeof( osalMsgCtx.qStats ) );
+#if ( OSAL_MSG_BUDGET )
+  osal_memset( osalMsgCtx.qBudget, 0, sizeof( osalMsgCtx.qBudget ) );
+  osalMsgCtx.budgetTask = TASK_NO_TASK;
+#endif
+
+#if defined( OSAL_TOTAL_MEM )
+  osalMsgCtx.msgCnt = 0;
+#endif
+
+  // Initialize the timers
+  osalTimerInit();
+
+  // Initialize the Power Management System
+  osal_pwrmgr_init();
+
+  // Initialize the tasking system
+  osalTaskInit();
+  osalAddTasks();
+  osalInitTasks();
+
+  // Setup efficient search for the first free block of heap.
+  osal_mem_kick();
+
+  return ( ZSUCCESS );
+}
+
+/*********************************************************************
+ * @fn      osal_start_system
+ *
+ * @brief
+ *
+ *   This function is the main loop function of the task system.  It
+ *   will look through all task events and call the task_event_processor()
+ *   function for the task with the event.  If there are no events (for
+ *   all tasks), this function puts the processor into Sleep.
+ *   This Function doesn't return.
+ *
+ * @param   void
+ *
+ * @return  none
+ */
+void osal_start_system( void )
+{
+  uint16 events;
+  uint16 retEvents;
+  byte activity;
+  halIntState_t intState;
+#if ( OSAL_DISPATCH_STATS )
+  uint16 delay;
+#endif
+
+  // Forever Loop
+#if !defined ( ZBIT )
+  for(;;)
+#endif
+  {
+
+    /* This replaces MT_SerialPoll() and osal_check_timer() */
+    Hal_ProcessPoll();
+
+#if ( OSALMEM_TRACE )
+    osalMemTraceFlush();
+#endif
+
+    activity = false;
+
+    activeTask = osalNextActiveTask();
+    if ( activeTask )
+    {
+      HAL_ENTER_CRITICAL_SECTION(intState);
+      events = activeTask->events;
+      // Clear the Events for this task
+      activeTask->events = 0;
+      OSAL_TASK_IDLE( activeTask );
+      HAL_EXIT_CRITICAL_SECTION(intState);
+
+      if ( events != 0 )
+      {
+        // Call the task to process the event(s)
+        if ( activeTask->pfnEventProcessor )
+        {
+#if ( OSAL_DISPATCH_STATS )
+          delay = OSAL_DISPATCH_CLOCK() - activeTask->readyAt;
+          if ( activeTask->dispatch.worstDelay < delay )
+            activeTask->dispatch.worstDelay = delay;
+          activeTask->dispatch.dispatches++;
+#endif
+
+#if ( OSAL_MSG_BUDGET )
+          if ( osalMsgCtx.qBudget[activeTask->taskID] )
+          {
+            osalMsgCtx.budgetTask = activeTask->taskID;
+            osalMsgCtx.budget = osalMsgCtx.qBudget[activeTask->taskID];
+          }
+#endif
+
+          retEvents = (activeTask->pfnEventProcessor)( activeTask->taskID, events );
+
+#if ( OSAL_MSG_BUDGET )
+          // Messages over the budget wait for the next turn
+          osalMsgCtx.budgetTask = TASK_NO_TASK;
+          if ( osalMsgCtx.qHead[activeTask->taskID] != NULL )
+            retEvents |= SYS_EVENT_MSG;
+#endif
+
+#if ( OSALMEM_SCRATCH )
+          // Scratch buffers never outlive the event handler.
+          osal_mem_scratch_release( 0 );
+#endif
+
+          // Add back unprocessed events to the current task
+          HAL_ENTER_CRITICAL_SECTION(intState);
+#if ( OSAL_DISPATCH_STATS )
+          if ( (activeTask->events == 0) && retEvents )
+            activeTask->readyAt = OSAL_DISPATCH_CLOCK();
+#endif
+          activeTask->events |= retEvents;
+          OSAL_TASK_READY( activeTask );
+          HAL_EXIT_CRITICAL_SECTION(intState);
+
+          activity = true;
+        }
+      }
+    }
+
+    // Complete pass through all task events with no activity?
+    if ( activity == false )
+    {
+#if defined( POWER_SAVING )
+      // Put the processor/system into sleep
+      osal_pwrmgr_powerconserve();
+#endif
+    }
+  }
+}
+
+/*********************************************************************
+ * @fn      osal_self
+ *
+ * @brief
+ *
+ *   This function returns the task ID of the calling (current) task.
+ *
+ * @param   void
+ *
+ * @return  byte task ID, 0xFF bad task ID
+ */
+byte osal_self( void )
+{
+  if ( activeTask )
+    return ( activeTask->taskID );
+  else
+    return ( TASK_NO_TASK );
+}
+
+#if ( OSAL_DISPATCH_STATS )
+/*********************************************************************
+ * @fn      osal_dispatch_stats
+ *
+ * @brief
+ *
+ *   This function returns the dispatch counters of a task: the calls
+ *   of its event handler and the longest wait, in OSAL_DISPATCH_CLOCK()
+ *   ticks, from its first event being set to the call. Compare the
+ *   MAC task's worst wait with and without message budgets.
+ *
+ * @param   byte task_id - task ID
+ *
+ * @return  pointer to the task counters, NULL if no such task
+ */
+const osal_dispatch_stats_t *osal_dispatch_stats( byte task_id )
+{
+  osalTaskRec_t *srchTask;
+
+  srchTask = osalFindTask( task_id );
+  if ( srchTask == NULL )
+    return ( NULL );
+
+  return ( &srchTask->dispatch );
+}
+#endif
+
+#if ( OSAL_MULTI_INSTANCE )
+/*********************************************************************
+ * @fn      osal_ctx_create
+ *
+ * @brief
+ *
+ *   Allocate the zeroed state of a new OSAL instance, for host builds
+ *   that run several instances in one process. Make it current with
+ *   osal_ctx_switch() and then call osal_init_system() as usual.
+ *
+ * @param   void
+ *
+ * @return  the new instance, NULL if out of host memory
+ */
+osal_ctx_t *osal_ctx_create( void )
+{
+  osal_ctx_t *ctx;
+
+  ctx = calloc( 1, sizeof( osal_ctx_t ) );
+  if ( ctx == NULL )
+    return ( NULL );
+
+  ctx->mem = osalMemCtxNew();
+  ctx->msg = calloc( 1, sizeof( osalMsgCtx_t ) );
+  ctx->tasks = osalTaskCtxNew();
+  ctx->timers = osalTimerCtxNew();
+
+  if ( !ctx->mem || !ctx->msg || !ctx->tasks || !ctx->timers )
+  {
+    osal_ctx_destroy( ctx );
+    ctx = NULL;
+  }
+
+  return ( ctx );
+}
+
+/*********************************************************************
+ * @fn      osal_ctx_switch
+ *
+ * @brief
+ *
+ *   Make an OSAL instance the current one. Every OSAL call that follows,
+ *   including osal_start_system(), works on that instance's heap,
+ *   messages, tasks and timers. The HAL, the power manager and the MAC
+ *   are not per instance.
+ *
+ * @param   osal_ctx_t *ctx - instance from osal_ctx_create()
+ *
+ * @return  none
+ */
+void osal_ctx_switch( osal_ctx_t *ctx )
+{
+  osalMemCtxUse( ctx->mem );
+  osalMsgCur = (osalMsgCtx_t *)ctx->msg;
+  osalTaskCtxUse( ctx->tasks );
+  osalTimerCtxUse( ctx->timers );
+}
+
+/*********************************************************************
+ * @fn      osal_ctx_destroy
+ *
+ * @brief
+ *
+ *   Free an OSAL instance. Its heap, and so every message, task and
+ *   timer record of the instance, goes with it. The instance must not
+ *   be the current one.
+ *
+ * @param   osal_ctx_t *ctx - instance from osal_ctx_create()
+ *
+ * @return  none
+ */
+void osal_ctx_destroy( osal_ctx_t *ctx )
+{
+  if ( ctx )
+  {
+    free( ctx->mem );
+    free( ctx->msg );
+    free( ctx->tasks );
+    free( ctx->timers );
+    free( ctx );
+  }
+}
+#endif
+
+/*********************************************************************
+*********************************************************************/
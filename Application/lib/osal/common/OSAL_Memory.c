@@ -1,568 +1,3139 @@
-/*********************************************************************
-    Filename:       OSAL_Memory.c
-    Revised:        $Date: 2006-10-26 11:15:57 -0700 (Thu, 26 Oct 2006) $
-    Revision:       $Revision: 12421 $
-
-    Description: OSAL Heap Memory management functions.
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-/*********************************************************************
- * INCLUDES
- */
-
-#include "ZComDef.h"
-#include "OSAL_Memory.h"
-#include "OnBoard.h"
-#include "hal_assert.h"
-
-#if ( MAXMEMHEAP >= 32768 )
-  #error MAXMEMHEAP is too big to manage!
-#endif
-
-// Minimum wasted bytes to justify splitting a block before allocation.
-#if !defined ( OSALMEM_MIN_BLKSZ )
-  #define OSALMEM_MIN_BLKSZ    4
-#endif
-
-/* Profiling memory allocations showed that a significant % of very high
- * frequency allocations/frees are for block sizes less than or equal to 16.
- */
-#if !defined ( OSALMEM_SMALL_BLKSZ )
-  #define OSALMEM_SMALL_BLKSZ  16
-#endif
-
-#if !defined ( OSALMEM_NODEBUG )
-  #define OSALMEM_NODEBUG      TRUE
-#endif
-
-#if !defined ( OSALMEM_PROFILER )
-  #define OSALMEM_PROFILER     FALSE
-#endif
-
-#if !defined ( OSALMEM_GUARD )
-  #define OSALMEM_GUARD  TRUE  // TBD - Hacky workaround til Bugzilla 1252 is fixed!
-  #define OSALMEM_READY  0xE2
-#endif
-
-#if ( OSALMEM_PROFILER )
-  #define OSALMEM_INIT   'X'
-  #define OSALMEM_ALOC   'A'
-  #define OSALMEM_REIN   'F'
-#endif
-
-/*********************************************************************
- * MACROS
- */
-
-/*
- *  The MAC_ASSERT macro is for use during debugging.
- *  The given expression must evaluate as "true" or else fatal error occurs.
- *  At that point, the call stack feature of the debugger can pinpoint where
- *  the problem occurred.
- *
- *  To disable this feature and save code size, the project should define
- *  OSALMEM_NODEBUG to TRUE.
- */
-#if ( OSALMEM_NODEBUG )
-  #define OSALMEM_ASSERT( expr )
-  #define OSALMEM_DEBUG( statement )
-#else
-  #define OSALMEM_ASSERT( expr)        HAL_ASSERT( expr )
-  #define OSALMEM_DEBUG( statement)    st( statement )
-#endif
-
-/*********************************************************************
- * TYPEDEFS
- */
-
-typedef uint16  osalMemHdr_t;
-
-/*********************************************************************
- * CONSTANTS
- */
-
-#define OSALMEM_IN_USE  0x8000
-
-/* This number sets the size of the small-block bucket. Although profiling
- * shows max simultaneous alloc of 16x18, timing without profiling overhead
- * shows that the best worst case is achieved with the following.
- */
-#define SMALLBLKHEAP    232
-
-// To maintain data alignment of the pointer returned, reserve the greater
-// space for the memory block header.
-#define HDRSZ  ( (sizeof ( halDataAlign_t ) > sizeof( osalMemHdr_t )) ? \
-                  sizeof ( halDataAlign_t ) : sizeof( osalMemHdr_t ) )
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
-
-/*********************************************************************
- * EXTERNAL VARIABLES
- */
-
-/*********************************************************************
- * EXTERNAL FUNCTIONS
- */
-
-/*********************************************************************
- * LOCAL VARIABLES
- */
-
-#if ( OSALMEM_GUARD )
-  static byte ready = 0;
-#endif
-
-static osalMemHdr_t *ff1;  // First free block in the small-block bucket.
-static osalMemHdr_t *ff2;  // First free block after the small-block bucket.
-
-#if ( OSALMEM_METRICS )
-  static uint16 blkMax;  // Max cnt of all blocks ever seen at once.
-  static uint16 blkCnt;  // Current cnt of all blocks.
-  static uint16 blkFree; // Current cnt of free blocks.
-  static uint16 memAlo;  // Current total memory allocated.
-  static uint16 memMax;  // Max total memory ever allocated at once.
-#endif
-
-#if ( OSALMEM_PROFILER )
-  #define OSALMEM_PROMAX  8
-  /* The profiling buckets must differ by at least OSALMEM_MIN_BLKSZ; the
-   * last bucket must equal the max alloc size. Set the bucket sizes to
-   * whatever sizes necessary to show how your application is using memory.
-   */
-  static uint16 proCnt[OSALMEM_PROMAX] = { 
-    OSALMEM_SMALL_BLKSZ, 48, 112, 176, 192, 224, 256, 65535 };
-  static uint16 proCur[OSALMEM_PROMAX] = { 0 };
-  static uint16 proMax[OSALMEM_PROMAX] = { 0 };
-  static uint16 proTot[OSALMEM_PROMAX] = { 0 };
-  static uint16 proSmallBlkMiss;
-#endif
-
-// Memory Allocation Heap.
-#if defined( EXTERNAL_RAM )
-  static byte *theHeap = (byte *)EXT_RAM_BEG;
-#else
-  static halDataAlign_t _theHeap[ MAXMEMHEAP / sizeof( halDataAlign_t ) ];
-  static byte *theHeap = (byte *)_theHeap;
-#endif
-
-/*********************************************************************
- * LOCAL FUNCTIONS
- */
-
-/*********************************************************************
- * @fn      osal_mem_init
- *
- * @brief   Initialize the heap memory management system.
- *
- * @param   void
- *
- * @return  void
- */
-void osal_mem_init( void )
-{
-  osalMemHdr_t *tmp;
-
-#if ( OSALMEM_PROFILER )
-  osal_memset( theHeap, OSALMEM_INIT, MAXMEMHEAP );
-#endif
-
-  // Setup a NULL block at the end of the heap for fast comparisons with zero.
-  tmp = (osalMemHdr_t *)theHeap + (MAXMEMHEAP / HDRSZ) - 1;
-  *tmp = 0;
-
-  // Setup a small-block bucket.
-  tmp = (osalMemHdr_t *)theHeap;
-  *tmp = SMALLBLKHEAP;
-
-  // Setup the wilderness.
-  tmp = (osalMemHdr_t *)theHeap + (SMALLBLKHEAP / HDRSZ);
-  *tmp = ((MAXMEMHEAP / HDRSZ) * HDRSZ) - SMALLBLKHEAP - HDRSZ;
-
-#if ( OSALMEM_GUARD )
-  ready = OSALMEM_READY;
-#endif
-
-  // Setup a NULL block that is never freed so that the small-block bucket
-  // is never coalesced with the wilderness.
-  ff1 = tmp;
-  ff2 = osal_mem_alloc( 0 );
-  ff1 = (osalMemHdr_t *)theHeap;
-
-#if ( OSALMEM_METRICS )
-  /* Start with the small-block bucket and the wilderness - don't count the
-   * end-of-heap NULL block nor the end-of-small-block NULL block.
-   */
-  blkCnt = blkFree = 2;
-#endif
-}
-
-/*********************************************************************
- * @fn      osal_mem_kick
- *
- * @brief   Kick the ff1 pointer out past the long-lived OSAL Task blocks.
- *          Invoke this once after all long-lived blocks have been allocated -
- *          presently at the end of osal_init_system().
- *
- * @param   void
- *
- * @return  void
- */
-void osal_mem_kick( void )
-{
-  halIntState_t intState;
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  /* Logic in osal_mem_free() will ratchet ff1 back down to the first free
-   * block in the small-block bucket.
-   */
-  ff1 = ff2;
-
-  HAL_EXIT_CRITICAL_SECTION( intState );  // Re-enable interrupts.
-}
-
-/*********************************************************************
- * @fn      osal_mem_alloc
- *
- * @brief   Implementation of the allocator functionality.
- *
- * @param   size - number of bytes to allocate from the heap.
- *
- * @return  void * - pointer to the heap allocation; NULL if error or failure.
- */
-void *osal_mem_alloc( uint16 size )
-{
-  osalMemHdr_t *prev;
-  osalMemHdr_t *hdr;
-  halIntState_t intState;
-  uint16 tmp;
-  byte coal = 0;
-
-#if ( OSALMEM_GUARD )
-  // Try to protect against premature use by HAL / OSAL.
-  if ( ready != OSALMEM_READY )
-  {
-    osal_mem_init();
-  }
-#endif
-
-  OSALMEM_ASSERT( size );
-
-  size += HDRSZ;
-
-  // Calculate required bytes to add to 'size' to align to halDataAlign_t.
-  if ( sizeof( halDataAlign_t ) == 2 )
-  {
-    size += (size & 0x01);
-  }
-  else if ( sizeof( halDataAlign_t ) != 1 )
-  {
-    const byte mod = size % sizeof( halDataAlign_t );
-
-    if ( mod != 0 )
-    {
-      size += (sizeof( halDataAlign_t ) - mod);
-    }
-  }
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  // Smaller allocations are first attempted in the small-block bucket.
-  if ( size <= OSALMEM_SMALL_BLKSZ )
-  {
-    hdr = ff1;
-  }
-  else
-  {
-    hdr = ff2;
-  }
-  tmp = *hdr;
-
-  do
-  {
-    if ( tmp & OSALMEM_IN_USE )
-    {
-      tmp ^= OSALMEM_IN_USE;
-      coal = 0;
-    }
-    else
-    {
-      if ( coal != 0 )
-      {
-#if ( OSALMEM_METRICS )
-        blkCnt--;
-        blkFree--;
-#endif
-
-        *prev += *hdr;
-
-        if ( *prev >= size )
-        {
-          hdr = prev;
-          tmp = *hdr;
-          break;
-        }
-      }
-      else
-      {
-        if ( tmp >= size )
-        {
-          break;
-        }
-
-        coal = 1;
-        prev = hdr;
-      }
-    }
-
-    hdr = (osalMemHdr_t *)((byte *)hdr + tmp);
-
-    tmp = *hdr;
-    if ( tmp == 0 )
-    {
-      hdr = NULL;
-      break;
-    }
-
-
-  } while ( 1 );
-
-  if ( hdr != NULL )
-  {
-    tmp -= size;
-
-    // Determine whether the threshold for splitting is met.
-    if ( tmp >= OSALMEM_MIN_BLKSZ )
-    {
-      // Split the block before allocating it.
-      osalMemHdr_t *next = (osalMemHdr_t *)((byte *)hdr + size);
-      *next = tmp;
-      *hdr = (size | OSALMEM_IN_USE);
-
-#if ( OSALMEM_METRICS )
-      blkCnt++;
-      if ( blkMax < blkCnt )
-      {
-        blkMax = blkCnt;
-      }
-      memAlo += size;
-#endif
-    }
-    else
-    {
-#if ( OSALMEM_METRICS )
-      memAlo += *hdr;
-      blkFree--;
-#endif
-
-      *hdr |= OSALMEM_IN_USE;
-    }
-
-#if ( OSALMEM_METRICS )
-    if ( memMax < memAlo )
-    {
-      memMax = memAlo;
-    }
-#endif
-
-#if ( OSALMEM_PROFILER )
-  {
-    byte idx;
-    size = *hdr ^ OSALMEM_IN_USE;
-
-    for ( idx = 0; idx < OSALMEM_PROMAX; idx++ )
-    {
-      if ( size <= proCnt[idx] )
-      {
-        break;
-      }
-    }
-    proCur[idx]++;
-    if ( proMax[idx] < proCur[idx] )
-    {
-      proMax[idx] = proCur[idx];
-    }
-    proTot[idx]++;
-  }
-#endif
-
-    hdr++;
-
-#if ( OSALMEM_PROFILER )
-    osal_memset( (byte *)hdr, OSALMEM_ALOC, (size - HDRSZ) );
-
-    /* A small-block could not be allocated in the small-block bucket.
-     * When this occurs significantly frequently, increase the size of the
-     * bucket in order to restore better worst case run times. Set the first
-     * profiling bucket size in proCnt[] to the small-block bucket size and
-     * divide proSmallBlkMiss by the corresponding proTot[] size to get % miss.
-     * Best worst case time on TrasmitApp was achieved at a 0-15% miss rate
-     * during steady state Tx load, 0% during idle and steady state Rx load.
-     */
-    if ( (size <= OSALMEM_SMALL_BLKSZ) && (hdr > ff2) )
-    {
-      proSmallBlkMiss++;
-    }
-#endif
-  }
-
-  HAL_EXIT_CRITICAL_SECTION( intState );  // Re-enable interrupts.
-
-  return (void *)hdr;
-}
-
-/*********************************************************************
- * @fn      osal_mem_free
- *
- * @brief   Implementation of the de-allocator functionality.
- *
- * @param   ptr - pointer to the memory to free.
- *
- * @return  void
- */
-void osal_mem_free( void *ptr )
-{
-  osalMemHdr_t *currHdr;
-  halIntState_t intState;
-
-#if ( OSALMEM_GUARD )
-  // Try to protect against premature use by HAL / OSAL.
-  if ( ready != OSALMEM_READY )
-  {
-    osal_mem_init();
-  }
-#endif
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  OSALMEM_ASSERT( ptr );
-
-  currHdr = (osalMemHdr_t *)ptr - 1;
-
-  // Has this block already been freed?
-  OSALMEM_ASSERT( *currHdr & OSALMEM_IN_USE );
-
-  *currHdr &= ~OSALMEM_IN_USE;
-
-#if ( OSALMEM_PROFILER )
-  {
-    uint16 size = *currHdr;
-    byte idx;
-
-    for ( idx = 0; idx < OSALMEM_PROMAX; idx++ )
-    {
-      if ( size <= proCnt[idx] )
-      {
-        break;
-      }
-    }
-
-    proCur[idx]--;
-  }
-#endif
-
-#if ( OSALMEM_METRICS )
-  memAlo -= *currHdr;
-  blkFree++;
-#endif
-
-  if ( ff1 > currHdr )
-  {
-    ff1 = currHdr;
-  }
-
-#if ( OSALMEM_PROFILER )
-  osal_memset( (byte *)currHdr+HDRSZ, OSALMEM_REIN, (*currHdr - HDRSZ) );
-#endif
-
-  HAL_EXIT_CRITICAL_SECTION( intState );  // Re-enable interrupts.
-}
-
-#if ( OSALMEM_METRICS )
-/*********************************************************************
- * @fn      osal_heap_block_max
- *
- * @brief   Return the maximum number of blocks ever allocated at once.
- *
- * @param   none
- *
- * @return  Maximum number of blocks ever allocated at once.
- */
-uint16 osal_heap_block_max( void )
-{
-  return blkMax;
-}
-
-/*********************************************************************
- * @fn      osal_heap_block_cnt
- *
- * @brief   Return the current number of blocks now allocated.
- *
- * @param   none
- *
- * @return  Current number of blocks now allocated.
- */
-uint16 osal_heap_block_cnt( void )
-{
-  return blkCnt;
-}
-
-/*********************************************************************
- * @fn      osal_heap_block_free
- *
- * @brief   Return the current number of free blocks.
- *
- * @param   none
- *
- * @return  Current number of free blocks.
- */
-uint16 osal_heap_block_free( void )
-{
-  return blkFree;
-}
-
-/*********************************************************************
- * @fn      osal_heap_mem_used
- *
- * @brief   Return the current number of bytes allocated.
- *
- * @param   none
- *
- * @return  Current number of bytes allocated.
- */
-uint16 osal_heap_mem_used( void )
-{
-  return memAlo;
-}
-#endif
-
-#if defined (ZTOOL_P1) || defined (ZTOOL_P2)
-/*********************************************************************
- * @fn      osal_heap_high_water
- *
- * @brief   Return the highest byte ever allocated in the heap.
- *
- * @param   none
- *
- * @return  Highest number of bytes ever used by the stack.
- */
-uint16 osal_heap_high_water( void )
-{
-#if ( OSALMEM_METRICS )
-  return memMax;
-#else
-  return MAXMEMHEAP;
-#endif
-}
-#endif
-
-/*********************************************************************
-*********************************************************************/
+/*********************************************************************
+    Filename:       OSAL_Memory.c
+    Revised:        $Date: 2006-10-26 11:15:57 -0700 (Thu, 26 Oct 2006) $
+    Revision:       $Revision: 12421 $
+
+    Description: OSAL Heap Memory management functions.
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+/*********************************************************************
+ * INCLUDES
+ */
+
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Memory.h"
+#include "OSAL_MemBuckets.h"
+#include "OnBoard.h"
+#include "hal_assert.h"
+
+#if ( OSAL_MULTI_INSTANCE )
+  #include <stdlib.h>
+#endif
+
+#if ( MAXMEMHEAP >= 32768 )
+  #error MAXMEMHEAP is too big to manage!
+#endif
+
+// Minimum wasted bytes to justify splitting a block before allocation.
+#if !defined ( OSALMEM_MIN_BLKSZ )
+  #define OSALMEM_MIN_BLKSZ    4
+#endif
+
+#if !defined ( OSALMEM_NODEBUG )
+  #define OSALMEM_NODEBUG      TRUE
+#endif
+
+#if !defined ( OSALMEM_PROFILER )
+  #define OSALMEM_PROFILER     FALSE
+#endif
+
+#if !defined ( OSALMEM_GUARD )
+  #define OSALMEM_GUARD  TRUE  // TBD - Hacky workaround til Bugzilla 1252 is fixed!
+  #define OSALMEM_READY  0xE2
+#endif
+
+/* The first-fit allocator keeps a boundary tag (footer) at the end of every
+ * free block so that osal_mem_free() can merge a block with both physical
+ * neighbours immediately, instead of leaving it to the next allocation walk.
+ */
+#if !defined ( OSALMEM_FREE_COALESCE )
+  #define OSALMEM_FREE_COALESCE  TRUE
+#endif
+
+/* The first-fit walk lets interrupts in after every OSALMEM_FF_WALK blocks,
+ * and starts over if the heap changed meanwhile, so the interrupt-disabled
+ * window no longer grows with fragmentation.
+ */
+#if !defined ( OSALMEM_FF_WALK )
+  #define OSALMEM_FF_WALK  8
+#endif
+
+#if ( OSALMEM_PROFILER )
+  #define OSALMEM_INIT   'X'
+  #define OSALMEM_ALOC   'A'
+  #define OSALMEM_REIN   'F'
+#endif
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+  #if ( MAXMEMHEAP >= 16384 )
+    #error MAXMEMHEAP is too big for the segregated-fit allocator!
+  #endif
+
+  /* Largest block, including its header, whose size class is looked up in
+   * segIdx[] by 8 bytes. Above it the classes step by half powers of two,
+   * up to the class of the largest block the heap can hold, and are looked
+   * up in segBig[] by 128 bytes.
+   */
+  #define OSALMEM_SEG_MAXBLK   256
+  #if ( MAXMEMHEAP <= 1024 )
+    #define OSALMEM_SEG_CLASSES  14  // Up to 1024.
+  #elif ( MAXMEMHEAP <= 4096 )
+    #define OSALMEM_SEG_CLASSES  18  // Up to 4096.
+  #else
+    #define OSALMEM_SEG_CLASSES  21  // Up to 12288.
+  #endif
+  #define OSALMEM_SEG_TOPCLS   2  // Classes carved from the top: 8 and 16.
+#elif ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_TLSF )
+  #if ( MAXMEMHEAP >= 16384 )
+    #error MAXMEMHEAP is too big for the TLSF allocator!
+  #endif
+
+  /* Each power-of-two size range (first level) is split into
+   * 2^OSALMEM_TLSF_SL_LOG2 free lists (second level). Blocks below
+   * OSALMEM_TLSF_SMALL all share first level 0, linearly subdivided.
+   */
+  #define OSALMEM_TLSF_SL_LOG2  2
+  #define OSALMEM_TLSF_SL_CNT   (1 << OSALMEM_TLSF_SL_LOG2)
+  #define OSALMEM_TLSF_SMALL    16
+  #define OSALMEM_TLSF_FL_CNT   11  // Covers block sizes up to 16383.
+#elif ( OSALMEM_ALLOCATOR != OSALMEM_ALLOC_FIRSTFIT )
+  #error Unknown OSALMEM_ALLOCATOR!
+#elif ( OSALMEM_BUCKET_CNT < 1 )
+  #error OSALMEM_BUCKET_CNT must be at least 1!
+#elif ( OSALMEM_FREE_COALESCE )
+  #if ( MAXMEMHEAP >= 16384 )
+    #error MAXMEMHEAP is too big for OSALMEM_FREE_COALESCE!
+  #endif
+  #if ( OSALMEM_MIN_BLKSZ < 4 )
+    #error OSALMEM_MIN_BLKSZ must leave room for a header and a footer!
+  #endif
+#endif
+
+/*********************************************************************
+ * MACROS
+ */
+
+/*
+ *  The MAC_ASSERT macro is for use during debugging.
+ *  The given expression must evaluate as "true" or else fatal error occurs.
+ *  At that point, the call stack feature of the debugger can pinpoint where
+ *  the problem occurred.
+ *
+ *  To disable this feature and save code size, the project should define
+ *  OSALMEM_NODEBUG to TRUE.
+ */
+/*
+ *  Every interrupt-disabled window of the heap goes through these macros.
+ *  With OSALMEM_IRQOFF_STATS the longest window of each call site is kept;
+ *  only outermost windows, entered with interrupts enabled, are timed.
+ */
+#if ( OSALMEM_IRQOFF_STATS )
+  #define OSALMEM_ENTER_CRITICAL( s )  st( HAL_ENTER_CRITICAL_SECTION( s ); \
+                                           if ( s ) { osalMemCtx.irqOffStart = OSALMEM_IRQOFF_NOW(); } )
+  #define OSALMEM_EXIT_CRITICAL( s, site )  st( if ( s ) { osalMemIrqOffEnd( site ); } \
+                                                HAL_EXIT_CRITICAL_SECTION( s ); )
+#else
+  #define OSALMEM_ENTER_CRITICAL( s )       HAL_ENTER_CRITICAL_SECTION( s )
+  #define OSALMEM_EXIT_CRITICAL( s, site )  HAL_EXIT_CRITICAL_SECTION( s )
+#endif
+
+#if ( OSALMEM_NODEBUG )
+  #define OSALMEM_ASSERT( expr )
+  #define OSALMEM_DEBUG( statement )
+#else
+  #define OSALMEM_ASSERT( expr)        HAL_ASSERT( expr )
+  #define OSALMEM_DEBUG( statement)    st( statement )
+#endif
+
+#if ( OSALMEM_ALLOCATOR != OSALMEM_ALLOC_FIRSTFIT )
+  // Free blocks are linked by their byte offset into the heap.
+  #define OSALMEM_BLK_HDR( off )   ((osalMemHdr_t *)(theHeap + (off)))
+  #define OSALMEM_BLK_NEXT( off )  (*(uint16 *)(theHeap + (off) + HDRSZ))
+  #define OSALMEM_BLK_PREV( off )  (*(uint16 *)(theHeap + (off) + HDRSZ + 2))
+
+  // The last word of a free block repeats its size (boundary tag).
+  #define OSALMEM_BLK_FOOT( off, sz )  (*(uint16 *)(theHeap + (off) + (sz) - 2))
+#endif
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+
+typedef uint16  osalMemHdr_t;
+
+/*********************************************************************
+ * CONSTANTS
+ */
+
+#define OSALMEM_IN_USE  0x8000
+
+// To maintain data alignment of the pointer returned, reserve the greater
+// space for the memory block header.
+#define HDRSZ  ( (sizeof ( halDataAlign_t ) > sizeof( osalMemHdr_t )) ? \
+                  sizeof ( halDataAlign_t ) : sizeof( osalMemHdr_t ) )
+
+#if ( OSALMEM_ALLOCATOR != OSALMEM_ALLOC_FIRSTFIT )
+  #define OSALMEM_NIL     0xFFFF
+  #define OSALMEM_HEAPSZ  ((MAXMEMHEAP / HDRSZ) * HDRSZ)
+#endif
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+  // Every block is a multiple of 8 bytes, and so is the heap used; an
+  // in-use NULL block at OSALMEM_SEG_END ends it.
+  #define OSALMEM_SEG_END  ((OSALMEM_HEAPSZ - HDRSZ) & ~7)
+#endif
+
+#if ( OSALMEM_ALLOCATOR != OSALMEM_ALLOC_FIRSTFIT ) || ( OSALMEM_FREE_COALESCE )
+  #define OSALMEM_PREV_FREE  0x4000  // The physically preceding block is free.
+  #define OSALMEM_SIZE_MASK  0x3FFF
+
+  // The last word of a free block repeats its size (boundary tag).
+  #define OSALMEM_HDR_FOOT( hdr, sz )  (*((osalMemHdr_t *)((byte *)(hdr) + (sz)) - 1))
+#else
+  #define OSALMEM_SIZE_MASK  0x7FFF
+#endif
+
+#if ( OSALMEM_OWNERS )
+  // Task IDs at or above OSALMEM_OWNER_MAX share one account; the
+  // system owner has its own, after it.
+  #define OSALMEM_OWNER_ACCT( task ) \
+    (((task) < OSALMEM_OWNER_MAX) ? (task) : \
+     (((task) == OSALMEM_OWNER_SYSTEM) ? (OSALMEM_OWNER_MAX + 1) : OSALMEM_OWNER_MAX))
+
+  // The owning task is kept in the last byte of the block.
+  #define OSALMEM_HDR_OWNER( hdr ) \
+    (((byte *)(hdr))[(*(hdr) & OSALMEM_SIZE_MASK) - 1])
+#endif
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_TLSF )
+  // A free block holds its header, two free-list links and its footer.
+  #define OSALMEM_TLSF_MINBLK  (HDRSZ + 6)
+#endif
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_FIRSTFIT )
+/* Small-block buckets from OSAL_MemBuckets.h: the largest block first tried
+ * in each bucket, and the bytes of each bucket. Profiling memory allocations
+ * showed that a significant % of very high frequency allocations/frees are
+ * for small blocks, which these keep clear of the long-lived large ones.
+ */
+static const CODE uint16 bktBlkSz[OSALMEM_BUCKET_CNT] = { OSALMEM_BUCKET_BLKSZ };
+static const CODE uint16 bktLen[OSALMEM_BUCKET_CNT] = { OSALMEM_BUCKET_LEN };
+#elif ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_TLSF )
+// Index of the most significant set bit of a nibble.
+static const CODE byte tlsfLog2[16] = {
+  0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3 };
+#elif ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+/* The size classes, smallest block of each including the header:
+ *   8, 16, 24, 32, 48, 64, 96, 128, 192, 256,
+ *   384, 512, 768, 1024, 1536, 2048, 3072, 4096, 6144, 8192, 12288.
+ * A free block is kept on the list of the largest class it holds, which
+ * is looked up in one step: every class up to OSALMEM_SEG_MAXBLK is a
+ * multiple of 8 bytes, and every class above it a multiple of 128.
+ */
+
+// Largest class a block holds, indexed by (size / 8).
+static const CODE byte segIdx[OSALMEM_SEG_MAXBLK / 8 + 1] = {
+  0, 0, 1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6,
+  7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 9 };
+
+// Largest class a block above OSALMEM_SEG_MAXBLK holds, indexed by (size / 128).
+static const CODE byte segBig[] = {
+  0, 0, 9, 10, 11, 11, 12, 12,                                   // Up to 1024.
+#if ( MAXMEMHEAP > 1024 )
+  13, 13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 15, 15, 15, 15,
+  16, 16, 16, 16, 16, 16, 16, 16,                                 // Up to 4096.
+#endif
+#if ( MAXMEMHEAP > 4096 )
+  17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20  // Up to 16384.
+#endif
+};
+#endif
+
+#if ( OSALMEM_PROFILER )
+  #define OSALMEM_PROMAX  OSALMEM_PRO_CNT
+  /* The profiling buckets must differ by at least OSALMEM_MIN_BLKSZ; the
+   * last bucket must equal the max alloc size. Set the bucket sizes to
+   * whatever sizes necessary to show how your application is using memory.
+   */
+  static uint16 proCnt[OSALMEM_PROMAX] = { OSALMEM_PRO_BINS };
+#endif
+
+#if ( OSALMEM_TRACE )
+  #if ( (OSALMEM_TRACE_BUFSZ % OSALMEM_TRACE_RECSZ) != 0 ) || ( OSALMEM_TRACE_BUFSZ > 248 )
+    #error Bad OSALMEM_TRACE_BUFSZ!
+  #endif
+#endif
+
+/* All of the heap state. There is one static instance on the target, so
+ * every osalMemCtx.x below is a plain direct access; with
+ * OSAL_MULTI_INSTANCE it is the instance selected by osal_ctx_switch().
+ */
+typedef struct
+{
+#if ( OSALMEM_GUARD )
+  byte ready;
+#endif
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_FIRSTFIT )
+  osalMemHdr_t *ff1[OSALMEM_BUCKET_CNT];  // First free block in each small-block bucket.
+  osalMemHdr_t *ff2[OSALMEM_BUCKET_CNT];  // First block after each small-block bucket.
+  uint16 ffGen;  // Bumped by every change to the blocks, see OSALMEM_FF_WALK.
+#elif ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_TLSF )
+  uint16 tlsfFL;                     // Bit per first level with free blocks.
+  byte tlsfSL[OSALMEM_TLSF_FL_CNT];  // Bit per second level with free blocks.
+  uint16 tlsfFree[OSALMEM_TLSF_FL_CNT][OSALMEM_TLSF_SL_CNT];  // List heads.
+#else
+  uint16 segFree[OSALMEM_SEG_CLASSES];  // Free list head of each class.
+  uint16 segBrk;    // Offset of the first byte not yet carved into blocks.
+  uint16 segTop;    // Offset of the lowest block carved from the top.
+#endif
+
+#if ( OSALMEM_METRICS )
+  uint16 blkMax;  // Max cnt of all blocks ever seen at once.
+  uint16 blkCnt;  // Current cnt of all blocks.
+  uint16 blkFree; // Current cnt of free blocks.
+  uint16 memAlo;  // Current total memory allocated.
+  uint16 memMax;  // Max total memory ever allocated at once.
+#endif
+
+#if ( OSALMEM_PROFILER )
+  uint16 proCur[OSALMEM_PROMAX];
+  uint16 proMax[OSALMEM_PROMAX];
+  uint16 proTot[OSALMEM_PROMAX];
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_FIRSTFIT )
+  uint16 proSmallBlkMiss[OSALMEM_BUCKET_CNT];
+#endif
+#endif
+
+#if ( OSALMEM_OWNERS )
+  uint16 ownUsed[OSALMEM_OWNER_MAX + 2];    // Bytes held, incl. headers.
+  uint16 ownQuota[OSALMEM_OWNER_MAX + 2];   // 0 means no quota.
+  uint16 ownDenied[OSALMEM_OWNER_MAX + 2];  // Allocations refused.
+  byte ownSys;                              // Open osal_mem_system() brackets.
+#endif
+
+#if ( OSALMEM_IRQOFF_STATS )
+  uint16 irqOffStart;  // OSALMEM_IRQOFF_NOW() when interrupts went off.
+  uint16 irqOffMax[OSALMEM_IRQ_SITES];
+#endif
+
+#if ( OSALMEM_TRACE )
+  byte traceBuf[OSALMEM_TRACE_BUFSZ];
+  byte traceHead;    // Next record to send.
+  byte traceCnt;     // Bytes waiting to be sent.
+  uint16 traceLost;  // Records dropped since the last LOST record.
+#endif
+
+#if ( OSALMEM_SCRATCH )
+  halDataAlign_t scratch[ OSALMEM_SCRATCH_LEN / sizeof( halDataAlign_t ) ];
+  uint16 scratchTop;  // Bytes of the scratch arena in use.
+#if ( OSALMEM_METRICS )
+  uint16 scratchMax;  // Most bytes of the scratch arena ever in use.
+#endif
+#endif
+
+#if !defined( EXTERNAL_RAM )
+  // Memory Allocation Heap.
+  halDataAlign_t heap[ MAXMEMHEAP / sizeof( halDataAlign_t ) ];
+#endif
+} osalMemCtx_t;
+
+#if ( OSAL_MULTI_INSTANCE )
+  #if defined( EXTERNAL_RAM )
+    #error OSAL_MULTI_INSTANCE needs the heap in internal RAM!
+  #endif
+  static osalMemCtx_t *osalMemCur;
+  #define osalMemCtx  (*osalMemCur)
+#else
+  static osalMemCtx_t osalMemCtx;
+#endif
+
+#if defined( EXTERNAL_RAM )
+  #define theHeap  ((byte *)EXT_RAM_BEG)
+#else
+  #define theHeap  ((byte *)osalMemCtx.heap)
+#endif
+
+/*********************************************************************
+ * LOCAL FUNCTIONS
+ */
+
+#if ( OSALMEM_OWNERS )
+static void *osalMemAlloc( uint16 size );
+static void osalMemFree( void *ptr );
+#else
+  // Without ownership accounting the allocator is the public API itself.
+  #define osalMemAlloc  osal_mem_alloc
+  #define osalMemFree   osal_mem_free
+#endif
+
+#if ( OSALMEM_PROFILER )
+static byte osalMemProIdx( uint16 size );
+#endif
+
+#if ( OSALMEM_IRQOFF_STATS )
+static void osalMemIrqOffEnd( byte site );
+#if !defined ( OSALMEM_IRQOFF_NOW )
+  // Time windows with the 32.768 kHz sleep timer, about 30.5 us per tick.
+  #define OSALMEM_IRQOFF_NOW()  osalMemSleepTimer()
+  #define OSALMEM_IRQOFF_SLEEP_TIMER
+static uint16 osalMemSleepTimer( void );
+#endif
+#endif
+
+#if ( OSALMEM_TRACE )
+static void osalMemTracePut( byte kind, uint16 size, uint16 off );
+static void osalMemTraceRec( byte kind, uint16 size, void *ptr );
+#endif
+
+static uint16 osalMemGrow( osalMemHdr_t *hdr, uint16 size );
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER )
+static void osalMemGrowAcct( uint16 oldSz, uint16 newSz );
+#endif
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_TLSF )
+static byte tlsfMsb( uint16 x );
+static void tlsfMapping( uint16 size, byte *fl, byte *sl );
+static void tlsfInsert( uint16 blk, uint16 size );
+static void tlsfRemove( uint16 blk, uint16 size );
+#elif ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+static byte segClass( uint16 size );
+static void segInsert( uint16 blk, uint16 size );
+static void segRemove( uint16 blk, uint16 size );
+static void segRelease( uint16 blk, uint16 size );
+static uint16 segFind( uint16 size );
+#endif
+
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_FIRSTFIT )
+/*********************************************************************
+ * @fn      osal_mem_init
+ *
+ * @brief   Initialize the heap memory management system.
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void osal_mem_init( void )
+{
+  osalMemHdr_t *tmp;
+  byte bkt;
+
+#if ( OSALMEM_PROFILER )
+  osal_memset( theHeap, OSALMEM_INIT, MAXMEMHEAP );
+#endif
+
+  // Setup a NULL block at the end of the heap for fast comparisons with zero.
+  tmp = (osalMemHdr_t *)theHeap + (MAXMEMHEAP / HDRSZ) - 1;
+#if ( OSALMEM_FREE_COALESCE )
+  // Marked in use so that osal_mem_free() never merges with it.
+  *tmp = OSALMEM_IN_USE | OSALMEM_PREV_FREE;
+#else
+  *tmp = 0;
+#endif
+
+  // Setup the small-block buckets, each followed by a NULL block that is
+  // never freed so that a bucket is never coalesced with its neighbours.
+  tmp = (osalMemHdr_t *)theHeap;
+  for ( bkt = 0; bkt < OSALMEM_BUCKET_CNT; bkt++ )
+  {
+    osalMemCtx.ff1[bkt] = tmp;
+    *tmp = bktLen[bkt];
+#if ( OSALMEM_FREE_COALESCE )
+    OSALMEM_HDR_FOOT( tmp, bktLen[bkt] ) = bktLen[bkt];
+#endif
+
+    tmp = (osalMemHdr_t *)((byte *)tmp + bktLen[bkt]);
+#if ( OSALMEM_FREE_COALESCE )
+    // Tag the bucket as a free block preceding the NULL block.
+    *tmp = HDRSZ | OSALMEM_IN_USE | OSALMEM_PREV_FREE;
+#else
+    *tmp = HDRSZ | OSALMEM_IN_USE;
+#endif
+
+    tmp = (osalMemHdr_t *)((byte *)tmp + HDRSZ);
+    osalMemCtx.ff2[bkt] = tmp;
+  }
+
+  // Setup the wilderness.
+  *tmp = ((MAXMEMHEAP / HDRSZ) * HDRSZ) - (uint16)((byte *)tmp - theHeap) - HDRSZ;
+#if ( OSALMEM_FREE_COALESCE )
+  OSALMEM_HDR_FOOT( tmp, *tmp ) = *tmp;
+#endif
+
+#if ( OSALMEM_GUARD )
+  osalMemCtx.ready = OSALMEM_READY;
+#endif
+
+#if ( OSALMEM_METRICS )
+  /* Start with the small-block buckets and the wilderness - don't count the
+   * end-of-heap NULL block nor the end-of-bucket NULL blocks.
+   */
+  osalMemCtx.blkCnt = osalMemCtx.blkFree = OSALMEM_BUCKET_CNT + 1;
+#endif
+}
+
+/*********************************************************************
+ * @fn      osal_mem_kick
+ *
+ * @brief   Kick the ff1 pointer out past the long-lived OSAL Task blocks.
+ *          Invoke this once after all long-lived blocks have been allocated -
+ *          presently at the end of osal_init_system().
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void osal_mem_kick( void )
+{
+  halIntState_t intState;
+  byte bkt;
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  /* Logic in osal_mem_free() will ratchet ff1 back down to the first free
+   * block in each small-block bucket.
+   */
+  for ( bkt = 0; bkt < OSALMEM_BUCKET_CNT; bkt++ )
+  {
+    osalMemCtx.ff1[bkt] = osalMemCtx.ff2[bkt];
+  }
+  osalMemCtx.ffGen++;
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+}
+
+/*********************************************************************
+ * @fn      osalMemAlloc
+ *
+ * @brief   Implementation of the allocator functionality.
+ *
+ * @param   size - number of bytes to allocate from the heap.
+ *
+ * @return  void * - pointer to the heap allocation; NULL if error or failure.
+ */
+void *osalMemAlloc( uint16 size )
+{
+  osalMemHdr_t *hdr = NULL;
+  halIntState_t intState;
+  uint16 tmp = 0;
+  uint16 gen;
+  byte walked = 0;
+  byte bkt;
+#if ( !OSALMEM_FREE_COALESCE )
+  osalMemHdr_t *prev = NULL;
+  byte coal = 0;
+#endif
+#if ( OSALMEM_TRACE )
+  const uint16 reqSize = size;
+#endif
+
+#if ( OSALMEM_GUARD )
+  // Try to protect against premature use by HAL / OSAL.
+  if ( osalMemCtx.ready != OSALMEM_READY )
+  {
+    osal_mem_init();
+  }
+#endif
+
+  OSALMEM_ASSERT( size );
+
+#if ( OSALMEM_FREE_COALESCE )
+  // Once freed, the payload must hold the footer. Only the NULL block that
+  // osal_mem_init() allocates is smaller, and it is never freed.
+  if ( size == 1 )
+  {
+    size = sizeof( osalMemHdr_t );
+  }
+#endif
+
+  size += HDRSZ;
+
+  // Calculate required bytes to add to 'size' to align to halDataAlign_t.
+  if ( sizeof( halDataAlign_t ) == 2 )
+  {
+    size += (size & 0x01);
+  }
+  else if ( sizeof( halDataAlign_t ) != 1 )
+  {
+    const byte mod = size % sizeof( halDataAlign_t );
+
+    if ( mod != 0 )
+    {
+      size += (sizeof( halDataAlign_t ) - mod);
+    }
+  }
+
+  // Smaller allocations are first attempted in the smallest small-block
+  // bucket that fits; bkt is OSALMEM_BUCKET_CNT for the others.
+  for ( bkt = 0; bkt < OSALMEM_BUCKET_CNT; bkt++ )
+  {
+    if ( size <= bktBlkSz[bkt] )
+    {
+      break;
+    }
+  }
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  // Differs from ffGen so that the walk starts.
+  gen = osalMemCtx.ffGen + 1;
+
+  do
+  {
+    if ( gen != osalMemCtx.ffGen )
+    {
+      // Start, or start over when the heap changed while interrupts were in.
+      gen = osalMemCtx.ffGen;
+      if ( bkt < OSALMEM_BUCKET_CNT )
+      {
+        hdr = osalMemCtx.ff1[bkt];
+      }
+      else
+      {
+        hdr = osalMemCtx.ff2[OSALMEM_BUCKET_CNT - 1];
+      }
+      tmp = *hdr;
+#if ( !OSALMEM_FREE_COALESCE )
+      coal = 0;
+#endif
+    }
+
+#if ( OSALMEM_FREE_COALESCE )
+    /* osal_mem_free() never leaves two free blocks adjacent, so the walk only
+     * has to find the first free block that is big enough. A free block never
+     * carries OSALMEM_PREV_FREE, so its header is its size.
+     */
+    if ( tmp & OSALMEM_IN_USE )
+    {
+      tmp &= OSALMEM_SIZE_MASK;
+      if ( tmp == 0 )
+      {
+        hdr = NULL;
+        break;
+      }
+    }
+    else if ( tmp >= size )
+    {
+      break;
+    }
+
+    hdr = (osalMemHdr_t *)((byte *)hdr + tmp);
+    tmp = *hdr;
+#else
+    if ( tmp & OSALMEM_IN_USE )
+    {
+      tmp ^= OSALMEM_IN_USE;
+      coal = 0;
+    }
+    else
+    {
+      if ( coal != 0 )
+      {
+#if ( OSALMEM_METRICS )
+        osalMemCtx.blkCnt--;
+        osalMemCtx.blkFree--;
+#endif
+
+        *prev += *hdr;
+        gen = ++osalMemCtx.ffGen;
+
+        if ( *prev >= size )
+        {
+          hdr = prev;
+          tmp = *hdr;
+          break;
+        }
+      }
+      else
+      {
+        if ( tmp >= size )
+        {
+          break;
+        }
+
+        coal = 1;
+        prev = hdr;
+      }
+    }
+
+    hdr = (osalMemHdr_t *)((byte *)hdr + tmp);
+
+    tmp = *hdr;
+    if ( tmp == 0 )
+    {
+      hdr = NULL;
+      break;
+    }
+#endif
+
+    if ( ++walked == OSALMEM_FF_WALK )
+    {
+      walked = 0;
+      OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Let interrupts in.
+      OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+    }
+  } while ( 1 );
+
+  if ( hdr != NULL )
+  {
+    osalMemCtx.ffGen++;
+    tmp -= size;
+
+    // Determine whether the threshold for splitting is met.
+    if ( tmp >= OSALMEM_MIN_BLKSZ )
+    {
+      // Split the block before allocating it.
+      osalMemHdr_t *next = (osalMemHdr_t *)((byte *)hdr + size);
+      *next = tmp;
+      *hdr = (size | OSALMEM_IN_USE);
+
+#if ( OSALMEM_FREE_COALESCE )
+      OSALMEM_HDR_FOOT( next, tmp ) = tmp;
+#endif
+
+#if ( OSALMEM_METRICS )
+      osalMemCtx.blkCnt++;
+      if ( osalMemCtx.blkMax < osalMemCtx.blkCnt )
+      {
+        osalMemCtx.blkMax = osalMemCtx.blkCnt;
+      }
+      osalMemCtx.memAlo += size;
+#endif
+    }
+    else
+    {
+#if ( OSALMEM_METRICS )
+      osalMemCtx.memAlo += *hdr;
+      osalMemCtx.blkFree--;
+#endif
+
+#if ( OSALMEM_FREE_COALESCE )
+      // The following block no longer follows a free block.
+      *(osalMemHdr_t *)((byte *)hdr + *hdr) &= ~OSALMEM_PREV_FREE;
+#endif
+
+      *hdr |= OSALMEM_IN_USE;
+    }
+
+#if ( OSALMEM_METRICS )
+    if ( osalMemCtx.memMax < osalMemCtx.memAlo )
+    {
+      osalMemCtx.memMax = osalMemCtx.memAlo;
+    }
+#endif
+
+#if ( OSALMEM_PROFILER )
+  {
+    byte idx;
+    size = *hdr ^ OSALMEM_IN_USE;
+
+    idx = osalMemProIdx( size );
+    osalMemCtx.proCur[idx]++;
+    if ( osalMemCtx.proMax[idx] < osalMemCtx.proCur[idx] )
+    {
+      osalMemCtx.proMax[idx] = osalMemCtx.proCur[idx];
+    }
+    osalMemCtx.proTot[idx]++;
+  }
+#endif
+
+    hdr++;
+
+#if ( OSALMEM_PROFILER )
+    /* A small-block could not be allocated in its small-block bucket.
+     * When this occurs significantly frequently, increase the size of the
+     * bucket in order to restore better worst case run times. Make the
+     * bucket sizes profiling bins in OSALMEM_PRO_BINS and divide
+     * proSmallBlkMiss[] by the corresponding proTot[] sizes to get % miss.
+     * Best worst case time on TrasmitApp was achieved at a 0-15% miss rate
+     * during steady state Tx load, 0% during idle and steady state Rx load.
+     */
+    if ( (bkt < OSALMEM_BUCKET_CNT) && (hdr > osalMemCtx.ff2[bkt]) )
+    {
+      osalMemCtx.proSmallBlkMiss[bkt]++;
+    }
+#endif
+  }
+
+#if ( OSALMEM_TRACE )
+  osalMemTraceRec( ((hdr != NULL) ? OSALMEM_TRACE_ALOC : OSALMEM_TRACE_FAIL), reqSize, hdr );
+#endif
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Re-enable interrupts.
+
+#if ( OSALMEM_PROFILER )
+  // The block is private now, so it is filled with interrupts enabled.
+  if ( hdr != NULL )
+  {
+    osal_memset( (byte *)hdr, OSALMEM_ALOC, (size - HDRSZ) );
+  }
+#endif
+
+  return (void *)hdr;
+}
+
+/*********************************************************************
+ * @fn      osalMemFree
+ *
+ * @brief   Implementation of the de-allocator functionality.
+ *
+ * @param   ptr - pointer to the memory to free.
+ *
+ * @return  void
+ */
+void osalMemFree( void *ptr )
+{
+  osalMemHdr_t *currHdr;
+  halIntState_t intState;
+  byte bkt;
+#if ( OSALMEM_FREE_COALESCE )
+  osalMemHdr_t *next;
+  uint16 size;
+#endif
+
+#if ( OSALMEM_GUARD )
+  // Try to protect against premature use by HAL / OSAL.
+  if ( osalMemCtx.ready != OSALMEM_READY )
+  {
+    osal_mem_init();
+  }
+#endif
+
+  OSALMEM_ASSERT( ptr );
+
+  currHdr = (osalMemHdr_t *)ptr - 1;
+
+#if ( OSALMEM_PROFILER )
+  // The block is still private, so it is scrubbed with interrupts enabled.
+  osal_memset( (byte *)ptr, OSALMEM_REIN, ((*currHdr & OSALMEM_SIZE_MASK) - HDRSZ) );
+#endif
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  // Has this block already been freed?
+  OSALMEM_ASSERT( *currHdr & OSALMEM_IN_USE );
+
+  *currHdr &= ~OSALMEM_IN_USE;
+  osalMemCtx.ffGen++;
+
+#if ( OSALMEM_FREE_COALESCE )
+  size = *currHdr & OSALMEM_SIZE_MASK;
+
+#if ( OSALMEM_TRACE )
+  osalMemTraceRec( OSALMEM_TRACE_FREE, size, ptr );
+#endif
+
+#if ( OSALMEM_PROFILER )
+  osalMemCtx.proCur[osalMemProIdx( size )]--;
+#endif
+
+#if ( OSALMEM_METRICS )
+  osalMemCtx.memAlo -= size;
+  osalMemCtx.blkFree++;
+#endif
+
+  // Merge with the following block if it is free (the end-of-heap and
+  // end-of-small-block NULL blocks are always in use).
+  next = (osalMemHdr_t *)((byte *)currHdr + size);
+  if ( !(*next & OSALMEM_IN_USE) )
+  {
+    size += *next;
+
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkCnt--;
+    osalMemCtx.blkFree--;
+#endif
+  }
+
+  // Merge with the preceding block if it is free, found via its footer.
+  if ( *currHdr & OSALMEM_PREV_FREE )
+  {
+    uint16 prevSz = *(currHdr - 1);
+
+    currHdr = (osalMemHdr_t *)((byte *)currHdr - prevSz);
+    size += prevSz;
+
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkCnt--;
+    osalMemCtx.blkFree--;
+#endif
+  }
+
+  *currHdr = size;
+  OSALMEM_HDR_FOOT( currHdr, size ) = size;
+  *(osalMemHdr_t *)((byte *)currHdr + size) |= OSALMEM_PREV_FREE;
+
+  // A merged block may start before ff1, which must stay on a block header.
+  for ( bkt = 0; bkt < OSALMEM_BUCKET_CNT; bkt++ )
+  {
+    if ( currHdr < osalMemCtx.ff2[bkt] )
+    {
+      if ( osalMemCtx.ff1[bkt] > currHdr )
+      {
+        osalMemCtx.ff1[bkt] = currHdr;
+      }
+      break;
+    }
+  }
+#else
+#if ( OSALMEM_TRACE )
+  osalMemTraceRec( OSALMEM_TRACE_FREE, *currHdr, ptr );
+#endif
+
+#if ( OSALMEM_PROFILER )
+  osalMemCtx.proCur[osalMemProIdx( *currHdr )]--;
+#endif
+
+#if ( OSALMEM_METRICS )
+  osalMemCtx.memAlo -= *currHdr;
+  osalMemCtx.blkFree++;
+#endif
+
+  for ( bkt = 0; bkt < OSALMEM_BUCKET_CNT; bkt++ )
+  {
+    if ( currHdr < osalMemCtx.ff2[bkt] )
+    {
+      if ( osalMemCtx.ff1[bkt] > currHdr )
+      {
+        osalMemCtx.ff1[bkt] = currHdr;
+      }
+      break;
+    }
+  }
+#endif
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_FREE );  // Re-enable interrupts.
+}
+
+/*********************************************************************
+ * @fn      osalMemGrow
+ *
+ * @brief   Grow an allocated block in place by taking in the following
+ *          block when it is free and big enough; a remainder worth a
+ *          block is split off again.
+ *
+ * @param   hdr - header of the allocated block.
+ * @param   size - number of bytes the block must now hold.
+ *
+ * @return  New block size, including the header; 0 if it cannot grow.
+ */
+static uint16 osalMemGrow( osalMemHdr_t *hdr, uint16 size )
+{
+  osalMemHdr_t *next;
+  halIntState_t intState;
+  uint16 oldSz;
+  uint16 blkSz;
+  uint16 tmp;
+  byte bkt;
+
+#if ( OSALMEM_FREE_COALESCE )
+  // Once freed, the payload must hold the footer.
+  if ( size == 1 )
+  {
+    size = sizeof( osalMemHdr_t );
+  }
+#endif
+
+  size += HDRSZ;
+
+  // Calculate required bytes to add to 'size' to align to halDataAlign_t.
+  if ( sizeof( halDataAlign_t ) == 2 )
+  {
+    size += (size & 0x01);
+  }
+  else if ( sizeof( halDataAlign_t ) != 1 )
+  {
+    const byte mod = size % sizeof( halDataAlign_t );
+
+    if ( mod != 0 )
+    {
+      size += (sizeof( halDataAlign_t ) - mod);
+    }
+  }
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  oldSz = blkSz = *hdr & OSALMEM_SIZE_MASK;
+
+  if ( oldSz < size )
+  {
+    next = (osalMemHdr_t *)((byte *)hdr + oldSz);
+    tmp = *next;
+
+    // The NULL blocks are in use; without OSALMEM_FREE_COALESCE the
+    // end-of-heap NULL block has size 0 and never fits.
+    if ( (tmp & OSALMEM_IN_USE) || ((oldSz + tmp) < size) )
+    {
+      blkSz = 0;
+    }
+    else
+    {
+      blkSz = oldSz + tmp;
+
+      // Determine whether the threshold for splitting is met.
+      if ( (blkSz - size) >= OSALMEM_MIN_BLKSZ )
+      {
+        tmp = blkSz - size;
+        blkSz = size;
+        next = (osalMemHdr_t *)((byte *)hdr + size);
+        *next = tmp;
+
+#if ( OSALMEM_FREE_COALESCE )
+        OSALMEM_HDR_FOOT( next, tmp ) = tmp;
+#endif
+      }
+      else
+      {
+#if ( OSALMEM_METRICS )
+        osalMemCtx.blkCnt--;
+        osalMemCtx.blkFree--;
+#endif
+
+        next = (osalMemHdr_t *)((byte *)hdr + blkSz);
+
+#if ( OSALMEM_FREE_COALESCE )
+        // The following block no longer follows a free block.
+        *next &= ~OSALMEM_PREV_FREE;
+#endif
+      }
+
+      osalMemCtx.ffGen++;
+
+      // An ff1 on the block taken in must stay on a block header.
+      for ( bkt = 0; bkt < OSALMEM_BUCKET_CNT; bkt++ )
+      {
+        if ( osalMemCtx.ff1[bkt] == (osalMemHdr_t *)((byte *)hdr + oldSz) )
+        {
+          osalMemCtx.ff1[bkt] = next;
+        }
+      }
+
+      *hdr = (*hdr & ~OSALMEM_SIZE_MASK) | blkSz;
+
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER )
+      osalMemGrowAcct( oldSz, blkSz );
+#endif
+    }
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Re-enable interrupts.
+
+  return blkSz;
+}
+
+#elif ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_TLSF )
+/*********************************************************************
+ * Two-Level Segregated Fit allocator.
+ *
+ * Free blocks are kept in OSALMEM_TLSF_FL_CNT x OSALMEM_TLSF_SL_CNT
+ * doubly linked lists, indexed by a first level (power of two of the
+ * size) and a second level (linear subdivision of that power of two).
+ * A bitmap per level records which lists are non-empty, so a fitting
+ * list is found with two most-significant-bit lookups instead of a
+ * heap walk. Boundary tags (the OSALMEM_PREV_FREE header bit and the
+ * free block footer) let osal_mem_free merge both neighbours at once.
+ *
+ * Worst-case bounds, independent of heap size and fragmentation:
+ *   osal_mem_alloc - 2 tlsfMsb(), 1 list unlink, at most 1 split insert.
+ *   osal_mem_free  - at most 2 merges (list unlinks) and 1 list insert.
+ * tlsfMsb() is 2 compares and 1 table lookup. None of these loop, so
+ * the interrupt-disabled time is a fixed number of instructions and is
+ * safe for allocation from the MAC receive ISR. Allocation holds
+ * interrupts off twice, for the search and unlink, then for the split
+ * insert; metrics, profiling and trace records take a third, short
+ * window, and the profiler fills run with interrupts enabled.
+ *
+ * Requests are rounded up to the next list boundary, which wastes at
+ * most 1/OSALMEM_TLSF_SL_CNT of a block in exchange for "good fit".
+ */
+
+/*********************************************************************
+ * @fn      tlsfMsb
+ *
+ * @brief   Index of the most significant set bit, in constant time.
+ *
+ * @param   x - non-zero value.
+ *
+ * @return  Bit index 0..15.
+ */
+static byte tlsfMsb( uint16 x )
+{
+  if ( x & 0xFF00 )
+  {
+    return ( x & 0xF000 ) ? (12 + tlsfLog2[x >> 12]) : (8 + tlsfLog2[(x >> 8) & 0x0F]);
+  }
+  else
+  {
+    return ( x & 0x00F0 ) ? (4 + tlsfLog2[(x >> 4) & 0x0F]) : tlsfLog2[x & 0x0F];
+  }
+}
+
+/*********************************************************************
+ * @fn      tlsfMapping
+ *
+ * @brief   Map a block size to its first and second level list.
+ *
+ * @param   size - block size, including the header.
+ * @param   fl - first level index returned.
+ * @param   sl - second level index returned.
+ *
+ * @return  void
+ */
+static void tlsfMapping( uint16 size, byte *fl, byte *sl )
+{
+  if ( size < OSALMEM_TLSF_SMALL )
+  {
+    *fl = 0;
+    *sl = (byte)(size / (OSALMEM_TLSF_SMALL / OSALMEM_TLSF_SL_CNT));
+  }
+  else
+  {
+    byte msb = tlsfMsb( size );
+
+    *fl = msb - 3;
+    *sl = (byte)(size >> (msb - OSALMEM_TLSF_SL_LOG2)) & (OSALMEM_TLSF_SL_CNT - 1);
+  }
+}
+
+/*********************************************************************
+ * @fn      tlsfInsert
+ *
+ * @brief   Insert a free block at the head of its list.
+ *          Ints must be disabled.
+ *
+ * @param   blk - heap offset of the block.
+ * @param   size - block size, including the header.
+ *
+ * @return  void
+ */
+static void tlsfInsert( uint16 blk, uint16 size )
+{
+  uint16 head;
+  byte fl, sl;
+
+  tlsfMapping( size, &fl, &sl );
+  head = osalMemCtx.tlsfFree[fl][sl];
+
+  OSALMEM_BLK_NEXT( blk ) = head;
+  OSALMEM_BLK_PREV( blk ) = OSALMEM_NIL;
+  if ( head != OSALMEM_NIL )
+  {
+    OSALMEM_BLK_PREV( head ) = blk;
+  }
+  osalMemCtx.tlsfFree[fl][sl] = blk;
+
+  osalMemCtx.tlsfFL |= BV( fl );
+  osalMemCtx.tlsfSL[fl] |= BV( sl );
+
+  *OSALMEM_BLK_HDR( blk ) = (*OSALMEM_BLK_HDR( blk ) & OSALMEM_PREV_FREE) | size;
+  OSALMEM_BLK_FOOT( blk, size ) = size;
+
+  // Tell the next block that this one is free.
+  *OSALMEM_BLK_HDR( blk + size ) |= OSALMEM_PREV_FREE;
+}
+
+/*********************************************************************
+ * @fn      tlsfRemove
+ *
+ * @brief   Unlink a free block from its list.
+ *          Ints must be disabled.
+ *
+ * @param   blk - heap offset of the block.
+ * @param   size - block size, including the header.
+ *
+ * @return  void
+ */
+static void tlsfRemove( uint16 blk, uint16 size )
+{
+  uint16 next = OSALMEM_BLK_NEXT( blk );
+  uint16 prev = OSALMEM_BLK_PREV( blk );
+  byte fl, sl;
+
+  if ( next != OSALMEM_NIL )
+  {
+    OSALMEM_BLK_PREV( next ) = prev;
+  }
+
+  if ( prev != OSALMEM_NIL )
+  {
+    OSALMEM_BLK_NEXT( prev ) = next;
+  }
+  else
+  {
+    tlsfMapping( size, &fl, &sl );
+    osalMemCtx.tlsfFree[fl][sl] = next;
+
+    if ( next == OSALMEM_NIL )
+    {
+      osalMemCtx.tlsfSL[fl] &= ~BV( sl );
+      if ( osalMemCtx.tlsfSL[fl] == 0 )
+      {
+        osalMemCtx.tlsfFL &= ~BV( fl );
+      }
+    }
+  }
+
+  *OSALMEM_BLK_HDR( blk + size ) &= ~OSALMEM_PREV_FREE;
+}
+
+/*********************************************************************
+ * @fn      osal_mem_init
+ *
+ * @brief   Initialize the heap memory management system.
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void osal_mem_init( void )
+{
+  byte fl, sl;
+
+#if ( OSALMEM_PROFILER )
+  osal_memset( theHeap, OSALMEM_INIT, MAXMEMHEAP );
+#endif
+
+  osalMemCtx.tlsfFL = 0;
+  for ( fl = 0; fl < OSALMEM_TLSF_FL_CNT; fl++ )
+  {
+    osalMemCtx.tlsfSL[fl] = 0;
+    for ( sl = 0; sl < OSALMEM_TLSF_SL_CNT; sl++ )
+    {
+      osalMemCtx.tlsfFree[fl][sl] = OSALMEM_NIL;
+    }
+  }
+
+  // Setup an in-use NULL block at the end of the heap that is never merged.
+  *OSALMEM_BLK_HDR( OSALMEM_HEAPSZ - HDRSZ ) = OSALMEM_IN_USE;
+
+  // Setup the wilderness as one free block.
+  *OSALMEM_BLK_HDR( 0 ) = 0;
+  tlsfInsert( 0, OSALMEM_HEAPSZ - HDRSZ );
+
+#if ( OSALMEM_GUARD )
+  osalMemCtx.ready = OSALMEM_READY;
+#endif
+
+#if ( OSALMEM_METRICS )
+  // Start with the wilderness - don't count the end-of-heap NULL block.
+  osalMemCtx.blkCnt = osalMemCtx.blkFree = 1;
+#endif
+}
+
+/*********************************************************************
+ * @fn      osal_mem_kick
+ *
+ * @brief   The TLSF lists need no search hint, so there is nothing to do.
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void osal_mem_kick( void )
+{
+}
+
+/*********************************************************************
+ * @fn      osalMemAlloc
+ *
+ * @brief   Implementation of the allocator functionality.
+ *
+ * @param   size - number of bytes to allocate from the heap.
+ *
+ * @return  void * - pointer to the heap allocation; NULL if error or failure.
+ */
+void *osalMemAlloc( uint16 size )
+{
+  osalMemHdr_t *hdr = NULL;
+  halIntState_t intState;
+  uint16 blk;
+  uint16 tmp;
+  byte fl, sl;
+#if ( OSALMEM_TRACE )
+  const uint16 reqSize = size;
+#endif
+
+#if ( OSALMEM_GUARD )
+  // Try to protect against premature use by HAL / OSAL.
+  if ( osalMemCtx.ready != OSALMEM_READY )
+  {
+    osal_mem_init();
+  }
+#endif
+
+  OSALMEM_ASSERT( size );
+
+  size += HDRSZ;
+
+  // Calculate required bytes to add to 'size' to align to halDataAlign_t.
+  if ( sizeof( halDataAlign_t ) == 2 )
+  {
+    size += (size & 0x01);
+  }
+  else if ( sizeof( halDataAlign_t ) != 1 )
+  {
+    const byte mod = size % sizeof( halDataAlign_t );
+
+    if ( mod != 0 )
+    {
+      size += (sizeof( halDataAlign_t ) - mod);
+    }
+  }
+
+  if ( size < OSALMEM_TLSF_MINBLK )
+  {
+    size = OSALMEM_TLSF_MINBLK;
+  }
+  else if ( size > OSALMEM_SIZE_MASK )
+  {
+#if ( OSALMEM_TRACE )
+    OSALMEM_ENTER_CRITICAL( intState );
+    osalMemTraceRec( OSALMEM_TRACE_FAIL, reqSize, NULL );
+    OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );
+#endif
+    return NULL;
+  }
+
+  // Round up to the next list boundary so that any block found fits.
+  tmp = size;
+  if ( tmp >= OSALMEM_TLSF_SMALL )
+  {
+    tmp += (1 << (tlsfMsb( tmp ) - OSALMEM_TLSF_SL_LOG2)) - 1;
+  }
+  else
+  {
+    tmp += (OSALMEM_TLSF_SMALL / OSALMEM_TLSF_SL_CNT) - 1;
+  }
+  tlsfMapping( tmp, &fl, &sl );
+
+  if ( fl < OSALMEM_TLSF_FL_CNT )
+  {
+    OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+    // Look for a non-empty list at this first level, then any larger one.
+    tmp = osalMemCtx.tlsfSL[fl] & (0xFF << sl);
+    if ( tmp == 0 )
+    {
+      tmp = osalMemCtx.tlsfFL & (0xFFFF << (fl + 1));
+      if ( tmp != 0 )
+      {
+        fl = tlsfMsb( tmp & (~tmp + 1) );
+        tmp = osalMemCtx.tlsfSL[fl];
+      }
+    }
+
+    if ( tmp != 0 )
+    {
+      sl = tlsfMsb( tmp & (~tmp + 1) );
+      blk = osalMemCtx.tlsfFree[fl][sl];
+      hdr = OSALMEM_BLK_HDR( blk );
+      tmp = *hdr & OSALMEM_SIZE_MASK;
+
+      tlsfRemove( blk, tmp );
+
+      // In use from here on, so neighbours being freed leave it alone.
+      *hdr = (*hdr & OSALMEM_PREV_FREE) | OSALMEM_IN_USE | tmp;
+
+#if ( OSALMEM_METRICS )
+      osalMemCtx.blkFree--;
+#endif
+    }
+
+    OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Re-enable interrupts.
+
+    // Split off the tail when it can hold a free block.
+    if ( (hdr != NULL) && ((tmp - size) >= OSALMEM_TLSF_MINBLK) )
+    {
+      uint16 tail = blk + size;
+      uint16 tailSz = tmp - size;
+
+      OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+      // The following block may have been freed since; it did not merge
+      // with the in-use block then, so the tail takes it in now.
+      tmp = *OSALMEM_BLK_HDR( blk + tmp );
+      if ( !(tmp & OSALMEM_IN_USE) )
+      {
+        tmp &= OSALMEM_SIZE_MASK;
+        tlsfRemove( tail + tailSz, tmp );
+        tailSz += tmp;
+
+#if ( OSALMEM_METRICS )
+        osalMemCtx.blkCnt--;
+        osalMemCtx.blkFree--;
+#endif
+      }
+
+      *OSALMEM_BLK_HDR( tail ) = 0;
+      tlsfInsert( tail, tailSz );
+      *hdr = (*hdr & OSALMEM_PREV_FREE) | OSALMEM_IN_USE | size;
+
+#if ( OSALMEM_METRICS )
+      osalMemCtx.blkCnt++;
+      osalMemCtx.blkFree++;
+      if ( osalMemCtx.blkMax < osalMemCtx.blkCnt )
+      {
+        osalMemCtx.blkMax = osalMemCtx.blkCnt;
+      }
+#endif
+
+      OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Re-enable interrupts.
+    }
+  }
+
+  if ( hdr != NULL )
+  {
+    tmp = *hdr & OSALMEM_SIZE_MASK;
+    hdr++;
+
+#if ( OSALMEM_PROFILER )
+    // The block is private, so it is filled with interrupts enabled.
+    osal_memset( (byte *)hdr, OSALMEM_ALOC, (tmp - HDRSZ) );
+#endif
+  }
+
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER ) || ( OSALMEM_TRACE )
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  if ( hdr != NULL )
+  {
+#if ( OSALMEM_METRICS )
+    osalMemCtx.memAlo += tmp;
+    if ( osalMemCtx.memMax < osalMemCtx.memAlo )
+    {
+      osalMemCtx.memMax = osalMemCtx.memAlo;
+    }
+#endif
+
+#if ( OSALMEM_PROFILER )
+    fl = osalMemProIdx( tmp );
+    osalMemCtx.proCur[fl]++;
+    if ( osalMemCtx.proMax[fl] < osalMemCtx.proCur[fl] )
+    {
+      osalMemCtx.proMax[fl] = osalMemCtx.proCur[fl];
+    }
+    osalMemCtx.proTot[fl]++;
+#endif
+  }
+
+#if ( OSALMEM_TRACE )
+  osalMemTraceRec( ((hdr != NULL) ? OSALMEM_TRACE_ALOC : OSALMEM_TRACE_FAIL), reqSize, hdr );
+#endif
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+#endif
+
+  return (void *)hdr;
+}
+
+/*********************************************************************
+ * @fn      osalMemFree
+ *
+ * @brief   Implementation of the de-allocator functionality.
+ *
+ *          The block is merged with its free neighbours, if any, and
+ *          inserted into the list for the resulting size.
+ *
+ * @param   ptr - pointer to the memory to free.
+ *
+ * @return  void
+ */
+void osalMemFree( void *ptr )
+{
+  osalMemHdr_t *currHdr;
+  halIntState_t intState;
+  uint16 blk;
+  uint16 size;
+  uint16 tmp;
+
+#if ( OSALMEM_GUARD )
+  // Try to protect against premature use by HAL / OSAL.
+  if ( osalMemCtx.ready != OSALMEM_READY )
+  {
+    osal_mem_init();
+  }
+#endif
+
+  OSALMEM_ASSERT( ptr );
+
+  currHdr = (osalMemHdr_t *)ptr - 1;
+
+  // Has this block already been freed?
+  OSALMEM_ASSERT( *currHdr & OSALMEM_IN_USE );
+
+  size = *currHdr & OSALMEM_SIZE_MASK;
+  blk = (uint16)((byte *)currHdr - theHeap);
+
+#if ( OSALMEM_PROFILER )
+  // The block is still private, so it is scrubbed with interrupts enabled.
+  osal_memset( (byte *)ptr, OSALMEM_REIN, (size - HDRSZ) );
+#endif
+
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER ) || ( OSALMEM_TRACE )
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+#if ( OSALMEM_TRACE )
+  osalMemTraceRec( OSALMEM_TRACE_FREE, size, ptr );
+#endif
+
+#if ( OSALMEM_PROFILER )
+  osalMemCtx.proCur[osalMemProIdx( size )]--;
+#endif
+
+#if ( OSALMEM_METRICS )
+  osalMemCtx.memAlo -= size;
+#endif
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+#endif
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  *currHdr &= ~OSALMEM_IN_USE;
+
+#if ( OSALMEM_METRICS )
+  osalMemCtx.blkFree++;
+#endif
+
+  // Merge with the next block.
+  tmp = *OSALMEM_BLK_HDR( blk + size );
+  if ( !(tmp & OSALMEM_IN_USE) )
+  {
+    tmp &= OSALMEM_SIZE_MASK;
+    tlsfRemove( blk + size, tmp );
+    size += tmp;
+
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkCnt--;
+    osalMemCtx.blkFree--;
+#endif
+  }
+
+  // Merge with the previous block.
+  if ( *currHdr & OSALMEM_PREV_FREE )
+  {
+    tmp = *(uint16 *)((byte *)currHdr - 2);
+    blk -= tmp;
+    tlsfRemove( blk, tmp );
+    size += tmp;
+
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkCnt--;
+    osalMemCtx.blkFree--;
+#endif
+  }
+
+  tlsfInsert( blk, size );
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_FREE );  // Re-enable interrupts.
+}
+/*********************************************************************
+ * @fn      osalMemGrow
+ *
+ * @brief   Grow an allocated block in place by taking in the following
+ *          block when it is free and big enough; a remainder that can
+ *          hold a free block goes back on its list.
+ *
+ * @param   hdr - header of the allocated block.
+ * @param   size - number of bytes the block must now hold.
+ *
+ * @return  New block size, including the header; 0 if it cannot grow.
+ */
+static uint16 osalMemGrow( osalMemHdr_t *hdr, uint16 size )
+{
+  halIntState_t intState;
+  uint16 blk;
+  uint16 oldSz;
+  uint16 blkSz;
+  uint16 tmp;
+
+  size += HDRSZ;
+
+  // Calculate required bytes to add to 'size' to align to halDataAlign_t.
+  if ( sizeof( halDataAlign_t ) == 2 )
+  {
+    size += (size & 0x01);
+  }
+  else if ( sizeof( halDataAlign_t ) != 1 )
+  {
+    const byte mod = size % sizeof( halDataAlign_t );
+
+    if ( mod != 0 )
+    {
+      size += (sizeof( halDataAlign_t ) - mod);
+    }
+  }
+
+  if ( size < OSALMEM_TLSF_MINBLK )
+  {
+    size = OSALMEM_TLSF_MINBLK;
+  }
+  else if ( size > OSALMEM_SIZE_MASK )
+  {
+    return 0;
+  }
+
+  blk = (uint16)((byte *)hdr - theHeap);
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  oldSz = blkSz = *hdr & OSALMEM_SIZE_MASK;
+
+  if ( oldSz < size )
+  {
+    tmp = *OSALMEM_BLK_HDR( blk + oldSz );
+
+    if ( (tmp & OSALMEM_IN_USE) || ((oldSz + (tmp & OSALMEM_SIZE_MASK)) < size) )
+    {
+      blkSz = 0;
+    }
+    else
+    {
+      tmp &= OSALMEM_SIZE_MASK;
+      tlsfRemove( blk + oldSz, tmp );
+      blkSz = oldSz + tmp;
+
+      // Split off the tail when it can hold a free block.
+      if ( (blkSz - size) >= OSALMEM_TLSF_MINBLK )
+      {
+        *OSALMEM_BLK_HDR( blk + size ) = 0;
+        tlsfInsert( blk + size, blkSz - size );
+        blkSz = size;
+      }
+      else
+      {
+#if ( OSALMEM_METRICS )
+        osalMemCtx.blkCnt--;
+        osalMemCtx.blkFree--;
+#endif
+      }
+
+      *hdr = (*hdr & ~OSALMEM_SIZE_MASK) | blkSz;
+
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER )
+      osalMemGrowAcct( oldSz, blkSz );
+#endif
+    }
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Re-enable interrupts.
+
+  return blkSz;
+}
+#else /* OSALMEM_ALLOC_SEGFIT */
+/*********************************************************************
+ * Segregated-fit allocator.
+ *
+ * Free blocks are kept in OSALMEM_SEG_CLASSES doubly linked lists, a
+ * block on the list of the largest size class it holds. Blocks are
+ * carved on demand from the wilderness, the untouched middle of the
+ * heap: from the bottom up and, for the smallest classes - timers,
+ * event messages - from the top down, to keep them from pinning the
+ * larger blocks apart. Boundary tags (the OSALMEM_PREV_FREE header bit
+ * and the free block footer) let osal_mem_free merge a block with both
+ * neighbours at once; a run that borders the wilderness goes back to it.
+ *
+ * Worst-case bounds, independent of heap size and fragmentation:
+ *   osal_mem_alloc - the head of its own class or a carve, else the head
+ *                    of each larger class until one is not empty, then
+ *                    at most 1 split insert.
+ *   osal_mem_free  - at most 2 merges (list unlinks) and 1 list insert.
+ * Only list heads are looked at, so nothing walks the heap or a list.
+ * Allocation holds interrupts off for its own class and the carve, once
+ * per larger class tried, and for the split; free holds them off once.
+ * Each window is a fixed number of instructions, so this is safe for
+ * allocation from the MAC receive ISR.
+ *
+ * Requests are rounded up to 8 bytes. Any block of a larger class fits
+ * a request; of its own class only the head is tried, so a request may
+ * be served from a larger class while its own holds a block that fits.
+ */
+
+/*********************************************************************
+ * @fn      segClass
+ *
+ * @brief   Map a block size to the largest class it holds.
+ *
+ * @param   size - block size, including the header, a multiple of 8.
+ *
+ * @return  Class index.
+ */
+static byte segClass( uint16 size )
+{
+  if ( size <= OSALMEM_SEG_MAXBLK )
+  {
+    return segIdx[size >> 3];
+  }
+
+  return segBig[size >> 7];
+}
+
+/*********************************************************************
+ * @fn      segInsert
+ *
+ * @brief   Insert a free block at the head of its class list.
+ *          The block before it must not be free. Ints must be disabled.
+ *
+ * @param   blk - heap offset of the block.
+ * @param   size - block size, including the header.
+ *
+ * @return  void
+ */
+static void segInsert( uint16 blk, uint16 size )
+{
+  byte idx = segClass( size );
+  uint16 head = osalMemCtx.segFree[idx];
+
+  OSALMEM_BLK_NEXT( blk ) = head;
+  OSALMEM_BLK_PREV( blk ) = OSALMEM_NIL;
+  if ( head != OSALMEM_NIL )
+  {
+    OSALMEM_BLK_PREV( head ) = blk;
+  }
+  osalMemCtx.segFree[idx] = blk;
+
+  *OSALMEM_BLK_HDR( blk ) = size;
+  OSALMEM_BLK_FOOT( blk, size ) = size;
+
+  // Tell the next block that this one is free.
+  *OSALMEM_BLK_HDR( blk + size ) |= OSALMEM_PREV_FREE;
+}
+
+/*********************************************************************
+ * @fn      segRemove
+ *
+ * @brief   Unlink a free block from its class list.
+ *          Ints must be disabled.
+ *
+ * @param   blk - heap offset of the block.
+ * @param   size - block size, including the header.
+ *
+ * @return  void
+ */
+static void segRemove( uint16 blk, uint16 size )
+{
+  uint16 next = OSALMEM_BLK_NEXT( blk );
+  uint16 prev = OSALMEM_BLK_PREV( blk );
+
+  if ( next != OSALMEM_NIL )
+  {
+    OSALMEM_BLK_PREV( next ) = prev;
+  }
+
+  if ( prev != OSALMEM_NIL )
+  {
+    OSALMEM_BLK_NEXT( prev ) = next;
+  }
+  else
+  {
+    osalMemCtx.segFree[segClass( size )] = next;
+  }
+
+  *OSALMEM_BLK_HDR( blk + size ) &= ~OSALMEM_PREV_FREE;
+}
+
+/*********************************************************************
+ * @fn      segRelease
+ *
+ * @brief   Give back a run of free bytes: merge it with the next block
+ *          if that is free, then return it to the wilderness if it
+ *          borders it, or insert it into its class list. The block
+ *          before the run must not be free. Ints must be disabled.
+ *
+ *          No free block ever borders the wilderness, so the block
+ *          at segTop is in use and need not be looked at.
+ *
+ * @param   blk - heap offset of the run.
+ * @param   size - bytes in the run, a multiple of 8.
+ *
+ * @return  void
+ */
+static void segRelease( uint16 blk, uint16 size )
+{
+  uint16 end = blk + size;
+  uint16 tmp;
+
+  // Merge with the next block; past the bottom region lies the wilderness.
+  if ( end != osalMemCtx.segBrk )
+  {
+    tmp = *OSALMEM_BLK_HDR( end );
+    if ( !(tmp & OSALMEM_IN_USE) )
+    {
+      segRemove( end, tmp );
+      end += tmp;
+
+#if ( OSALMEM_METRICS )
+      osalMemCtx.blkCnt--;
+      osalMemCtx.blkFree--;
+#endif
+    }
+  }
+
+  if ( (end == osalMemCtx.segBrk) || (blk == osalMemCtx.segTop) )
+  {
+    if ( end == osalMemCtx.segBrk )
+    {
+      osalMemCtx.segBrk = blk;
+    }
+    else
+    {
+      // The block after the run now follows the wilderness.
+      osalMemCtx.segTop = end;
+      *OSALMEM_BLK_HDR( end ) &= ~OSALMEM_PREV_FREE;
+    }
+
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkCnt--;
+    osalMemCtx.blkFree--;
+#endif
+  }
+  else
+  {
+    segInsert( blk, (end - blk) );
+  }
+}
+
+/*********************************************************************
+ * @fn      osal_mem_init
+ *
+ * @brief   Initialize the heap memory management system.
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void osal_mem_init( void )
+{
+  byte idx;
+
+#if ( OSALMEM_PROFILER )
+  osal_memset( theHeap, OSALMEM_INIT, MAXMEMHEAP );
+#endif
+
+  for ( idx = 0; idx < OSALMEM_SEG_CLASSES; idx++ )
+  {
+    osalMemCtx.segFree[idx] = OSALMEM_NIL;
+  }
+
+  // Setup an in-use NULL block at the end of the heap that is never merged.
+  *OSALMEM_BLK_HDR( OSALMEM_SEG_END ) = OSALMEM_IN_USE;
+
+  // The whole heap starts out as wilderness; blocks are carved on demand,
+  // from the bottom up and, for the smallest classes, from the top down.
+  osalMemCtx.segBrk = 0;
+  osalMemCtx.segTop = OSALMEM_SEG_END;
+
+#if ( OSALMEM_GUARD )
+  osalMemCtx.ready = OSALMEM_READY;
+#endif
+
+#if ( OSALMEM_METRICS )
+  // Only blocks that have been carved from the wilderness are counted.
+  osalMemCtx.blkCnt = osalMemCtx.blkFree = 0;
+#endif
+}
+
+/*********************************************************************
+ * @fn      osal_mem_kick
+ *
+ * @brief   The size-class free lists need no search hint, so there is
+ *          nothing to do here.
+ *
+ * @param   void
+ *
+ * @return  void
+ */
+void osal_mem_kick( void )
+{
+}
+
+/*********************************************************************
+ * @fn      segFind
+ *
+ * @brief   Take a free block of at least 'size' bytes off the free
+ *          lists, or carve it off the wilderness, and mark it in use.
+ *
+ *          The head of the request's own class is taken if it fits,
+ *          else a block is carved, else the head of the first larger
+ *          class that is not empty, which always fits. A block bigger
+ *          than the request is split and the tail given back. Interrupts
+ *          are let in between the classes and before the split.
+ *
+ * @param   size - block size wanted, including the header, a multiple
+ *                 of 8.
+ *
+ * @return  Heap offset of the block; OSALMEM_NIL if none is free.
+ */
+static uint16 segFind( uint16 size )
+{
+  halIntState_t intState;
+  uint16 blk;
+  uint16 blkSz = 0;
+  byte idx = segClass( size );
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  blk = osalMemCtx.segFree[idx];
+
+  if ( (blk != OSALMEM_NIL) && (*OSALMEM_BLK_HDR( blk ) >= size) )
+  {
+    blkSz = *OSALMEM_BLK_HDR( blk );
+    segRemove( blk, blkSz );
+    *OSALMEM_BLK_HDR( blk ) = OSALMEM_IN_USE | blkSz;
+  }
+  else if ( size <= (osalMemCtx.segTop - osalMemCtx.segBrk) )
+  {
+    // The smallest classes - timers, event messages - are carved from
+    // the top, to keep them from pinning the larger blocks apart.
+    if ( idx < OSALMEM_SEG_TOPCLS )
+    {
+      osalMemCtx.segTop -= size;
+      blk = osalMemCtx.segTop;
+    }
+    else
+    {
+      blk = osalMemCtx.segBrk;
+      osalMemCtx.segBrk += size;
+    }
+    blkSz = size;
+    *OSALMEM_BLK_HDR( blk ) = OSALMEM_IN_USE | size;
+
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkCnt++;
+    osalMemCtx.blkFree++;
+#endif
+  }
+  else
+  {
+    blk = OSALMEM_NIL;
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Re-enable interrupts.
+
+  // Any block of a larger class fits.
+  while ( (blk == OSALMEM_NIL) && (++idx < OSALMEM_SEG_CLASSES) )
+  {
+    OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+    blk = osalMemCtx.segFree[idx];
+    if ( blk != OSALMEM_NIL )
+    {
+      blkSz = *OSALMEM_BLK_HDR( blk );
+      segRemove( blk, blkSz );
+      *OSALMEM_BLK_HDR( blk ) = OSALMEM_IN_USE | blkSz;
+    }
+
+    OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC_LARGE );  // Re-enable interrupts.
+  }
+
+  // Split off the tail. The next block may have been freed since; it did
+  // not merge with the in-use block then, so the tail takes it in now.
+  if ( (blk != OSALMEM_NIL) && (blkSz > size) )
+  {
+    OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+    *OSALMEM_BLK_HDR( blk ) = (*OSALMEM_BLK_HDR( blk ) & OSALMEM_PREV_FREE) | OSALMEM_IN_USE | size;
+
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkCnt++;
+    osalMemCtx.blkFree++;
+#endif
+
+    segRelease( blk + size, blkSz - size );
+
+    OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Re-enable interrupts.
+  }
+
+  return blk;
+}
+
+/*********************************************************************
+ * @fn      osalMemAlloc
+ *
+ * @brief   Implementation of the allocator functionality.
+ *
+ *          The request is rounded up to a multiple of 8 and taken by
+ *          segFind(). The block is set up and accounted for with
+ *          interrupts enabled.
+ *
+ * @param   size - number of bytes to allocate from the heap.
+ *
+ * @return  void * - pointer to the heap allocation; NULL if error or failure.
+ */
+void *osalMemAlloc( uint16 size )
+{
+  osalMemHdr_t *hdr = NULL;
+  uint16 blk = OSALMEM_NIL;
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER ) || ( OSALMEM_TRACE )
+  halIntState_t intState;
+#endif
+#if ( OSALMEM_PROFILER )
+  byte idx;
+#endif
+#if ( OSALMEM_TRACE )
+  const uint16 reqSize = size;
+#endif
+
+#if ( OSALMEM_GUARD )
+  // Try to protect against premature use by HAL / OSAL.
+  if ( osalMemCtx.ready != OSALMEM_READY )
+  {
+    osal_mem_init();
+  }
+#endif
+
+  OSALMEM_ASSERT( size );
+
+  // Every block is a multiple of 8 bytes, so that splits and merges
+  // always leave whole blocks.
+  if ( size <= (OSALMEM_SEG_END - HDRSZ) )
+  {
+    size = (size + HDRSZ + 7) & ~7;
+    blk = segFind( size );
+  }
+
+  // Once off its list the block is private, so it is set up with
+  // interrupts enabled.
+  if ( blk != OSALMEM_NIL )
+  {
+    hdr = OSALMEM_BLK_HDR( blk );
+    size = *hdr & OSALMEM_SIZE_MASK;
+    hdr++;
+
+#if ( OSALMEM_PROFILER )
+    osal_memset( (byte *)hdr, OSALMEM_ALOC, (size - HDRSZ) );
+#endif
+  }
+
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER ) || ( OSALMEM_TRACE )
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  if ( hdr != NULL )
+  {
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkFree--;
+    if ( osalMemCtx.blkMax < osalMemCtx.blkCnt )
+    {
+      osalMemCtx.blkMax = osalMemCtx.blkCnt;
+    }
+    osalMemCtx.memAlo += size;
+    if ( osalMemCtx.memMax < osalMemCtx.memAlo )
+    {
+      osalMemCtx.memMax = osalMemCtx.memAlo;
+    }
+#endif
+
+#if ( OSALMEM_PROFILER )
+    idx = osalMemProIdx( size );
+    osalMemCtx.proCur[idx]++;
+    if ( osalMemCtx.proMax[idx] < osalMemCtx.proCur[idx] )
+    {
+      osalMemCtx.proMax[idx] = osalMemCtx.proCur[idx];
+    }
+    osalMemCtx.proTot[idx]++;
+#endif
+  }
+
+#if ( OSALMEM_TRACE )
+  osalMemTraceRec( ((hdr != NULL) ? OSALMEM_TRACE_ALOC : OSALMEM_TRACE_FAIL), reqSize, hdr );
+#endif
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+#endif
+
+  return (void *)hdr;
+}
+
+/*********************************************************************
+ * @fn      osalMemFree
+ *
+ * @brief   Implementation of the de-allocator functionality.
+ *
+ *          The block is merged with its free neighbours, if any, and
+ *          inserted into the list of the resulting size, or given back
+ *          to the wilderness.
+ *
+ * @param   ptr - pointer to the memory to free.
+ *
+ * @return  void
+ */
+void osalMemFree( void *ptr )
+{
+  osalMemHdr_t *currHdr;
+  halIntState_t intState;
+  uint16 blk;
+  uint16 size;
+  uint16 tmp;
+
+#if ( OSALMEM_GUARD )
+  // Try to protect against premature use by HAL / OSAL.
+  if ( osalMemCtx.ready != OSALMEM_READY )
+  {
+    osal_mem_init();
+  }
+#endif
+
+  OSALMEM_ASSERT( ptr );
+
+  currHdr = (osalMemHdr_t *)ptr - 1;
+
+  // Has this block already been freed?
+  OSALMEM_ASSERT( *currHdr & OSALMEM_IN_USE );
+
+  blk = (uint16)((byte *)currHdr - theHeap);
+  size = *currHdr & OSALMEM_SIZE_MASK;
+
+#if ( OSALMEM_PROFILER )
+  osal_memset( (byte *)currHdr+HDRSZ, OSALMEM_REIN, (size - HDRSZ) );
+#endif
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+#if ( OSALMEM_TRACE )
+  osalMemTraceRec( OSALMEM_TRACE_FREE, size, ptr );
+#endif
+
+#if ( OSALMEM_PROFILER )
+  osalMemCtx.proCur[osalMemProIdx( size )]--;
+#endif
+
+#if ( OSALMEM_METRICS )
+  osalMemCtx.memAlo -= size;
+  osalMemCtx.blkFree++;
+#endif
+
+  // Merge with the previous block, then segRelease() takes the next.
+  if ( *currHdr & OSALMEM_PREV_FREE )
+  {
+    tmp = *(uint16 *)((byte *)currHdr - 2);
+    blk -= tmp;
+    segRemove( blk, tmp );
+    size += tmp;
+
+#if ( OSALMEM_METRICS )
+    osalMemCtx.blkCnt--;
+    osalMemCtx.blkFree--;
+#endif
+  }
+
+  segRelease( blk, size );
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_FREE );  // Re-enable interrupts.
+}
+
+/*********************************************************************
+ * @fn      osalMemGrow
+ *
+ * @brief   Grow an allocated block in place, by taking in the next block
+ *          when it is free and big enough, or by carving more when the
+ *          block borders the wilderness. A remainder of the next block
+ *          is given back.
+ *
+ * @param   hdr - header of the allocated block.
+ * @param   size - number of bytes the block must now hold.
+ *
+ * @return  New block size, including the header; 0 if it cannot grow.
+ */
+static uint16 osalMemGrow( osalMemHdr_t *hdr, uint16 size )
+{
+  halIntState_t intState;
+  uint16 blk;
+  uint16 end;
+  uint16 oldSz;
+  uint16 blkSz;
+  uint16 tmp;
+
+  if ( size > (OSALMEM_SEG_END - HDRSZ) )
+  {
+    return 0;
+  }
+  size = (size + HDRSZ + 7) & ~7;
+
+  blk = (uint16)((byte *)hdr - theHeap);
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  oldSz = blkSz = *hdr & OSALMEM_SIZE_MASK;
+  end = blk + oldSz;
+
+  if ( oldSz < size )
+  {
+    blkSz = 0;
+
+    if ( end == osalMemCtx.segBrk )
+    {
+      if ( (size - oldSz) <= (osalMemCtx.segTop - osalMemCtx.segBrk) )
+      {
+        osalMemCtx.segBrk += (size - oldSz);
+        blkSz = size;
+      }
+    }
+    else
+    {
+      tmp = *OSALMEM_BLK_HDR( end );
+
+      if ( !(tmp & OSALMEM_IN_USE) && ((oldSz + tmp) >= size) )
+      {
+        segRemove( end, tmp );
+        blkSz = size;
+
+        // The remainder takes the place of the next block.
+        if ( (oldSz + tmp) > size )
+        {
+          segRelease( blk + size, (oldSz + tmp - size) );
+        }
+        else
+        {
+#if ( OSALMEM_METRICS )
+          osalMemCtx.blkCnt--;
+          osalMemCtx.blkFree--;
+#endif
+        }
+      }
+    }
+
+    if ( blkSz != 0 )
+    {
+      *hdr = (*hdr & ~OSALMEM_SIZE_MASK) | blkSz;
+
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER )
+      osalMemGrowAcct( oldSz, blkSz );
+#endif
+    }
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_ALLOC );  // Re-enable interrupts.
+
+  return blkSz;
+}
+#endif /* OSALMEM_ALLOCATOR */
+
+/*********************************************************************
+ * @fn      osal_mem_realloc
+ *
+ * @brief   Grow a block to hold 'size' bytes, keeping its contents. The
+ *          block grows in place when the allocator can extend it, so a
+ *          buffer appended to as bytes arrive is not copied each time;
+ *          otherwise it moves to a new block and the old one is freed.
+ *          A block is never shrunk. With OSALMEM_OWNERS the block keeps
+ *          its owner, and growing it in place counts against the
+ *          owner's quota.
+ *
+ * @param   ptr - block from osal_mem_alloc(); NULL to allocate a new one.
+ * @param   size - number of bytes the block must hold.
+ *
+ * @return  void * - the block, possibly moved; NULL on failure, in which
+ *          case the old block is left untouched.
+ */
+void *osal_mem_realloc( void *ptr, uint16 size )
+{
+  osalMemHdr_t *hdr;
+  void *newPtr;
+  uint16 oldSz;
+  uint16 newSz;
+#if ( OSALMEM_OWNERS ) || ( OSALMEM_TRACE )
+  halIntState_t intState;
+#endif
+#if ( OSALMEM_OWNERS )
+  uint16 charge = 0;
+  byte owner;
+  byte acct;
+  byte denied;
+#endif
+
+  if ( ptr == NULL )
+  {
+    return osal_mem_alloc( size );
+  }
+
+  hdr = (osalMemHdr_t *)ptr - 1;
+  oldSz = *hdr & OSALMEM_SIZE_MASK;
+
+#if ( OSALMEM_OWNERS )
+  owner = OSALMEM_HDR_OWNER( hdr );
+  acct = OSALMEM_OWNER_ACCT( owner );
+
+  // The owner byte moves to the end of the grown block.
+  size++;
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  denied = ( (osalMemCtx.ownQuota[acct] != 0) && ((size + HDRSZ) > oldSz) &&
+             ((osalMemCtx.ownUsed[acct] + (size + HDRSZ - oldSz)) > osalMemCtx.ownQuota[acct]) );
+  if ( denied )
+  {
+    osalMemCtx.ownDenied[acct]++;
+  }
+  else if ( (size + HDRSZ) > oldSz )
+  {
+    // Charged with the check, as osal_mem_alloc() does.
+    charge = size + HDRSZ - oldSz;
+    osalMemCtx.ownUsed[acct] += charge;
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+
+  if ( denied )
+  {
+    return NULL;
+  }
+#endif
+
+  newSz = osalMemGrow( hdr, size );
+
+#if ( OSALMEM_OWNERS )
+  if ( (newSz == 0) || (newSz == oldSz) )
+  {
+    // Moved, or already big enough: nothing was taken on this block.
+    OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+    osalMemCtx.ownUsed[acct] -= charge;
+    OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+  }
+#endif
+
+  if ( newSz != 0 )
+  {
+#if ( OSALMEM_OWNERS ) || ( OSALMEM_TRACE )
+    if ( newSz != oldSz )
+    {
+      OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+#if ( OSALMEM_OWNERS )
+      osalMemCtx.ownUsed[acct] += (newSz - oldSz) - charge;
+      OSALMEM_HDR_OWNER( hdr ) = owner;
+#endif
+
+#if ( OSALMEM_TRACE )
+      // Recorded as a free and an allocation at the same offset.
+      osalMemTraceRec( OSALMEM_TRACE_FREE, oldSz, ptr );
+      osalMemTraceRec( OSALMEM_TRACE_ALOC, size, ptr );
+#endif
+
+      OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+    }
+#endif
+
+    return ptr;
+  }
+
+#if ( OSALMEM_OWNERS )
+  size--;
+  oldSz--;
+#endif
+
+  newPtr = osal_mem_alloc( size );
+
+  if ( newPtr != NULL )
+  {
+#if ( OSALMEM_OWNERS )
+    osal_mem_set_owner( newPtr, owner );
+#endif
+    osal_memcpy( newPtr, ptr, (oldSz - HDRSZ) );
+    osal_mem_free( ptr );
+  }
+
+  return newPtr;
+}
+
+#if ( OSALMEM_METRICS ) || ( OSALMEM_PROFILER )
+/*********************************************************************
+ * @fn      osalMemGrowAcct
+ *
+ * @brief   Account for a block grown in place. Ints must be disabled.
+ *
+ * @param   oldSz - block size before, including the header.
+ * @param   newSz - block size now, including the header.
+ *
+ * @return  void
+ */
+static void osalMemGrowAcct( uint16 oldSz, uint16 newSz )
+{
+#if ( OSALMEM_METRICS )
+  osalMemCtx.memAlo += (newSz - oldSz);
+  if ( osalMemCtx.memMax < osalMemCtx.memAlo )
+  {
+    osalMemCtx.memMax = osalMemCtx.memAlo;
+  }
+#endif
+
+#if ( OSALMEM_PROFILER )
+  {
+    byte idx = osalMemProIdx( newSz );
+
+    osalMemCtx.proCur[osalMemProIdx( oldSz )]--;
+    osalMemCtx.proCur[idx]++;
+    if ( osalMemCtx.proMax[idx] < osalMemCtx.proCur[idx] )
+    {
+      osalMemCtx.proMax[idx] = osalMemCtx.proCur[idx];
+    }
+  }
+#endif
+}
+#endif
+
+#if ( OSALMEM_OWNERS )
+/*********************************************************************
+ * @fn      osal_mem_alloc
+ *
+ * @brief   Allocate a block on behalf of the calling task. The request
+ *          fails (returns NULL) when it would take the task over its
+ *          quota; the block is charged to the task otherwise. Inside an
+ *          osal_mem_system() bracket the block is charged to
+ *          OSALMEM_OWNER_SYSTEM, which has no quota: an ISR would
+ *          otherwise be charged to whichever task it interrupted.
+ *
+ * @param   size - number of bytes to allocate from the heap.
+ *
+ * @return  void * - pointer to the heap allocation; NULL if error or failure.
+ */
+void *osal_mem_alloc( uint16 size )
+{
+  osalMemHdr_t *hdr;
+  halIntState_t intState;
+  byte task = (osalMemCtx.ownSys != 0) ? OSALMEM_OWNER_SYSTEM : osal_self();
+  byte acct = OSALMEM_OWNER_ACCT( task );
+  uint16 charge;
+  byte denied;
+
+  /* The header and owner byte count against the quota; padding may not.
+   * They are charged in the same critical section as the check, so an
+   * allocation from an ISR in between sees them; the charge is trued up
+   * to the block size once the block is found.
+   */
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  denied = ( (osalMemCtx.ownQuota[acct] != 0) &&
+             ((osalMemCtx.ownUsed[acct] + HDRSZ >= osalMemCtx.ownQuota[acct]) ||
+              (size >= (osalMemCtx.ownQuota[acct] - osalMemCtx.ownUsed[acct] - HDRSZ))) );
+  if ( denied )
+  {
+    osalMemCtx.ownDenied[acct]++;
+  }
+  else
+  {
+    charge = size + 1 + HDRSZ;
+    osalMemCtx.ownUsed[acct] += charge;
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+
+  if ( denied )
+  {
+    return NULL;
+  }
+
+  hdr = osalMemAlloc( size + 1 );
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  if ( hdr != NULL )
+  {
+    hdr--;
+    OSALMEM_HDR_OWNER( hdr ) = task;
+    osalMemCtx.ownUsed[acct] += (*hdr & OSALMEM_SIZE_MASK) - charge;
+    hdr++;
+  }
+  else
+  {
+    osalMemCtx.ownUsed[acct] -= charge;
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+
+  return (void *)hdr;
+}
+
+/*********************************************************************
+ * @fn      osal_mem_free
+ *
+ * @brief   Free a block and credit it back to its owning task.
+ *
+ * @param   ptr - pointer to the memory to free.
+ *
+ * @return  void
+ */
+void osal_mem_free( void *ptr )
+{
+  osalMemHdr_t *hdr = (osalMemHdr_t *)ptr - 1;
+  halIntState_t intState;
+
+  OSALMEM_ASSERT( ptr );
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+  osalMemCtx.ownUsed[OSALMEM_OWNER_ACCT( OSALMEM_HDR_OWNER( hdr ) )] -= (*hdr & OSALMEM_SIZE_MASK);
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+
+  osalMemFree( ptr );
+}
+
+/*********************************************************************
+ * @fn      osal_mem_set_owner
+ *
+ * @brief   Hand a heap block to another task, e.g. a message queued for
+ *          it. Memory outside the heap (message pools) is ignored.
+ *
+ * @param   ptr - pointer returned by osal_mem_alloc().
+ * @param   task - new owning task ID.
+ *
+ * @return  void
+ */
+void osal_mem_set_owner( void *ptr, byte task )
+{
+  osalMemHdr_t *hdr = (osalMemHdr_t *)ptr - 1;
+  halIntState_t intState;
+  uint16 size;
+
+  if ( ((byte *)hdr < theHeap) || ((byte *)hdr >= (theHeap + MAXMEMHEAP)) )
+  {
+    return;
+  }
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  size = *hdr & OSALMEM_SIZE_MASK;
+  osalMemCtx.ownUsed[OSALMEM_OWNER_ACCT( OSALMEM_HDR_OWNER( hdr ) )] -= size;
+  osalMemCtx.ownUsed[OSALMEM_OWNER_ACCT( task )] += size;
+  OSALMEM_HDR_OWNER( hdr ) = task;
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+}
+
+/*********************************************************************
+ * @fn      osal_mem_owner
+ *
+ * @brief   Find which task holds a heap block.
+ *
+ * @param   ptr - pointer returned by osal_mem_alloc().
+ *
+ * @return  Owning task ID; TASK_NO_TASK if allocated before any task ran.
+ */
+byte osal_mem_owner( void *ptr )
+{
+  osalMemHdr_t *hdr = (osalMemHdr_t *)ptr - 1;
+
+  return OSALMEM_HDR_OWNER( hdr );
+}
+
+/*********************************************************************
+ * @fn      osal_mem_set_quota
+ *
+ * @brief   Limit the heap a task may hold. Allocations past the quota
+ *          fail instead of starving the other tasks.
+ *
+ * @param   task - task ID; OSALMEM_OWNER_SYSTEM is ignored.
+ * @param   quota - max bytes, including block headers; 0 for no limit.
+ *
+ * @return  void
+ */
+void osal_mem_set_quota( byte task, uint16 quota )
+{
+  if ( task != OSALMEM_OWNER_SYSTEM )
+  {
+    osalMemCtx.ownQuota[OSALMEM_OWNER_ACCT( task )] = quota;
+  }
+}
+
+/*********************************************************************
+ * @fn      osal_mem_system
+ *
+ * @brief   Open or close a system allocation bracket. Blocks allocated
+ *          while one is open - by an ISR, or for the stack itself - are
+ *          charged to OSALMEM_OWNER_SYSTEM and never refused by a quota.
+ *          Brackets nest.
+ *
+ * @param   on - TRUE to open a bracket, FALSE to close one.
+ *
+ * @return  void
+ */
+void osal_mem_system( byte on )
+{
+  halIntState_t intState;
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  if ( on )
+  {
+    osalMemCtx.ownSys++;
+  }
+  else if ( osalMemCtx.ownSys != 0 )
+  {
+    osalMemCtx.ownSys--;
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+}
+
+/*********************************************************************
+ * @fn      osal_mem_task_used
+ *
+ * @brief   Return the heap bytes a task holds, including block headers.
+ *
+ * @param   task - task ID.
+ *
+ * @return  Bytes held by the task.
+ */
+uint16 osal_mem_task_used( byte task )
+{
+  return osalMemCtx.ownUsed[OSALMEM_OWNER_ACCT( task )];
+}
+
+/*********************************************************************
+ * @fn      osal_mem_task_denied
+ *
+ * @brief   Return the number of allocations refused by a task's quota.
+ *
+ * @param   task - task ID.
+ *
+ * @return  Refused allocation count.
+ */
+uint16 osal_mem_task_denied( byte task )
+{
+  return osalMemCtx.ownDenied[OSALMEM_OWNER_ACCT( task )];
+}
+#endif
+
+#if ( OSALMEM_PROFILER )
+/*********************************************************************
+ * @fn      osal_mem_pro_bin
+ *
+ * @brief   Return the counters of a profiler bin. They are kept from
+ *          power-up on, across osal_mem_init().
+ *
+ * @param   bin - bin index, from 0 to OSALMEM_PRO_CNT-1.
+ * @param   maxLive - returns the most blocks of the bin live at once.
+ * @param   total - returns the blocks of the bin ever allocated.
+ *
+ * @return  Largest block size, header included, of the bin; 0 if no such bin.
+ */
+uint16 osal_mem_pro_bin( byte bin, uint16 *maxLive, uint16 *total )
+{
+  if ( bin >= OSALMEM_PROMAX )
+  {
+    return 0;
+  }
+
+  *maxLive = osalMemCtx.proMax[bin];
+  *total = osalMemCtx.proTot[bin];
+
+  return proCnt[bin];
+}
+
+/*********************************************************************
+ * @fn      osal_mem_pro_miss
+ *
+ * @brief   Return the allocations a first-fit small-block bucket could
+ *          not serve, which went on to the rest of the heap.
+ *
+ * @param   bkt - bucket index, from 0 to OSALMEM_BUCKET_CNT-1.
+ *
+ * @return  Missed allocations; 0 if no such bucket.
+ */
+uint16 osal_mem_pro_miss( byte bkt )
+{
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_FIRSTFIT )
+  if ( bkt < OSALMEM_BUCKET_CNT )
+  {
+    return osalMemCtx.proSmallBlkMiss[bkt];
+  }
+#endif
+
+  return 0;
+}
+
+/*********************************************************************
+ * @fn      osalMemProIdx
+ *
+ * @brief   Find the profiling bucket of a block size.
+ *
+ * @param   size - block size, including the header.
+ *
+ * @return  Index into the profiling arrays.
+ */
+static byte osalMemProIdx( uint16 size )
+{
+  byte idx;
+
+  for ( idx = 0; idx < OSALMEM_PROMAX; idx++ )
+  {
+    if ( size <= proCnt[idx] )
+    {
+      break;
+    }
+  }
+
+  return idx;
+}
+#endif
+
+#if ( OSALMEM_IRQOFF_STATS )
+#if defined ( OSALMEM_IRQOFF_SLEEP_TIMER )
+/*********************************************************************
+ * @fn      osalMemSleepTimer
+ *
+ * @brief   Read the low 16 bits of the sleep timer.
+ *
+ * @param   void
+ *
+ * @return  Sleep timer ticks.
+ */
+static uint16 osalMemSleepTimer( void )
+{
+  uint16 ticks = ST0;  // ST0 must be read first to latch ST1.
+
+  return ( ticks | ((uint16)ST1 << 8) );
+}
+#endif
+
+/*********************************************************************
+ * @fn      osalMemIrqOffEnd
+ *
+ * @brief   Close the timing of an interrupt-disabled window.
+ *
+ * @param   site - OSALMEM_IRQ_ALLOC .. OSALMEM_IRQ_OTHER.
+ *
+ * @return  void
+ */
+static void osalMemIrqOffEnd( byte site )
+{
+  uint16 ticks = (uint16)(OSALMEM_IRQOFF_NOW() - osalMemCtx.irqOffStart);
+
+  if ( osalMemCtx.irqOffMax[site] < ticks )
+  {
+    osalMemCtx.irqOffMax[site] = ticks;
+  }
+}
+
+/*********************************************************************
+ * @fn      osal_mem_irqoff_max
+ *
+ * @brief   Return the longest time the heap has held off interrupts at
+ *          a call site.
+ *
+ * @param   site - OSALMEM_IRQ_ALLOC .. OSALMEM_IRQ_OTHER.
+ *
+ * @return  Ticks of OSALMEM_IRQOFF_NOW(); 32.768 kHz by default.
+ */
+uint16 osal_mem_irqoff_max( byte site )
+{
+  return osalMemCtx.irqOffMax[site];
+}
+#endif
+
+#if ( OSALMEM_TRACE )
+/*********************************************************************
+ * @fn      osalMemTracePut
+ *
+ * @brief   Write one record at the tail of the trace ring, which the
+ *          caller has checked has room.
+ *
+ * @param   kind - OSALMEM_TRACE_ALOC .. OSALMEM_TRACE_LOST.
+ * @param   size - size field of the record.
+ * @param   off - heap offset field of the record.
+ *
+ * @return  void
+ */
+static void osalMemTracePut( byte kind, uint16 size, uint16 off )
+{
+  byte *rec = osalMemCtx.traceBuf + (osalMemCtx.traceHead + osalMemCtx.traceCnt) % OSALMEM_TRACE_BUFSZ;
+  uint16 tick = (uint16)osal_GetSystemClock();
+
+  osalMemCtx.traceCnt += OSALMEM_TRACE_RECSZ;
+
+  rec[0] = OSALMEM_TRACE_SYNC | kind;
+  rec[1] = osal_self();
+  rec[2] = LO_UINT16( size );
+  rec[3] = HI_UINT16( size );
+  rec[4] = LO_UINT16( off );
+  rec[5] = HI_UINT16( off );
+  rec[6] = LO_UINT16( tick );
+  rec[7] = HI_UINT16( tick );
+}
+
+/*********************************************************************
+ * @fn      osalMemTraceRec
+ *
+ * @brief   Append a heap event to the trace ring. Must be called with
+ *          interrupts held off so that records stay in heap order.
+ *
+ * @param   kind - OSALMEM_TRACE_ALOC, _FREE or _FAIL.
+ * @param   size - bytes requested, or block size for a free.
+ * @param   ptr - payload of the block; NULL for a failed allocation.
+ *
+ * @return  void
+ */
+static void osalMemTraceRec( byte kind, uint16 size, void *ptr )
+{
+  if ( osalMemCtx.traceLost != 0 )
+  {
+    // Report the dropped records first, once there is room for both.
+    if ( osalMemCtx.traceCnt > (OSALMEM_TRACE_BUFSZ - (2 * OSALMEM_TRACE_RECSZ)) )
+    {
+      osalMemCtx.traceLost++;
+      return;
+    }
+
+    osalMemTracePut( OSALMEM_TRACE_LOST, osalMemCtx.traceLost, 0xFFFF );
+    osalMemCtx.traceLost = 0;
+  }
+  else if ( osalMemCtx.traceCnt == OSALMEM_TRACE_BUFSZ )
+  {
+    osalMemCtx.traceLost++;
+    return;
+  }
+
+  osalMemTracePut( kind, size,
+                   ((ptr != NULL) ? (uint16)((byte *)ptr - theHeap) : 0xFFFF) );
+}
+
+/*********************************************************************
+ * @fn      osal_mem_trace_peek
+ *
+ * @brief   Get the oldest unsent trace records. Only the records up to
+ *          the end of the ring are returned; the rest follow once these
+ *          have been consumed.
+ *
+ * @param   len - returns the number of bytes available at the pointer.
+ *
+ * @return  Pointer to the oldest unsent record.
+ */
+byte *osal_mem_trace_peek( uint16 *len )
+{
+  halIntState_t intState;
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  *len = OSALMEM_TRACE_BUFSZ - osalMemCtx.traceHead;
+  if ( *len > osalMemCtx.traceCnt )
+  {
+    *len = osalMemCtx.traceCnt;
+  }
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+
+  return osalMemCtx.traceBuf + osalMemCtx.traceHead;
+}
+
+/*********************************************************************
+ * @fn      osal_mem_trace_consume
+ *
+ * @brief   Release trace bytes returned by osal_mem_trace_peek().
+ *
+ * @param   len - number of bytes sent, a multiple of OSALMEM_TRACE_RECSZ.
+ *
+ * @return  void
+ */
+void osal_mem_trace_consume( uint16 len )
+{
+  halIntState_t intState;
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  osalMemCtx.traceHead = (byte)((osalMemCtx.traceHead + len) % OSALMEM_TRACE_BUFSZ);
+  osalMemCtx.traceCnt -= (byte)len;
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+}
+#endif
+
+#if ( OSALMEM_SCRATCH )
+/*********************************************************************
+ * @fn      osal_mem_scratch
+ *
+ * @brief   Take a buffer from the scratch arena. It stays valid until
+ *          osal_mem_scratch_release() with an earlier mark, or until the
+ *          current task event handler returns, whichever comes first.
+ *          There is no free. Task context only.
+ *
+ * @param   size - number of bytes wanted.
+ *
+ * @return  void * - pointer to the buffer; NULL if the arena is full.
+ */
+void *osal_mem_scratch( uint16 size )
+{
+  byte *ptr;
+
+  if ( size > (OSALMEM_SCRATCH_LEN - osalMemCtx.scratchTop) )
+  {
+    return NULL;
+  }
+
+  ptr = (byte *)osalMemCtx.scratch + osalMemCtx.scratchTop;
+
+  // Keep the next buffer aligned to halDataAlign_t.
+  if ( sizeof( halDataAlign_t ) != 1 )
+  {
+    const byte mod = size % sizeof( halDataAlign_t );
+
+    if ( mod != 0 )
+    {
+      size += (sizeof( halDataAlign_t ) - mod);
+    }
+  }
+  osalMemCtx.scratchTop += size;
+
+#if ( OSALMEM_METRICS )
+  if ( osalMemCtx.scratchMax < osalMemCtx.scratchTop )
+  {
+    osalMemCtx.scratchMax = osalMemCtx.scratchTop;
+  }
+#endif
+
+  return (void *)ptr;
+}
+
+/*********************************************************************
+ * @fn      osal_mem_scratch_mark
+ *
+ * @brief   Return the current scratch arena position, to be handed to
+ *          osal_mem_scratch_release() at the end of the scope.
+ *
+ * @param   none
+ *
+ * @return  Scratch arena mark.
+ */
+uint16 osal_mem_scratch_mark( void )
+{
+  return osalMemCtx.scratchTop;
+}
+
+/*********************************************************************
+ * @fn      osal_mem_scratch_release
+ *
+ * @brief   Release every scratch buffer taken since a mark, in O(1).
+ *          Marks nest: releasing an outer mark also releases the
+ *          buffers of any inner scope.
+ *
+ * @param   mark - value from osal_mem_scratch_mark(); 0 empties the arena.
+ *
+ * @return  void
+ */
+void osal_mem_scratch_release( uint16 mark )
+{
+  if ( mark < osalMemCtx.scratchTop )
+  {
+    osalMemCtx.scratchTop = mark;
+  }
+}
+#endif
+
+#if ( OSALMEM_METRICS )
+/*********************************************************************
+ * @fn      osal_heap_block_max
+ *
+ * @brief   Return the maximum number of blocks ever allocated at once.
+ *
+ * @param   none
+ *
+ * @return  Maximum number of blocks ever allocated at once.
+ */
+uint16 osal_heap_block_max( void )
+{
+  return osalMemCtx.blkMax;
+}
+
+/*********************************************************************
+ * @fn      osal_heap_block_cnt
+ *
+ * @brief   Return the current number of blocks now allocated.
+ *
+ * @param   none
+ *
+ * @return  Current number of blocks now allocated.
+ */
+uint16 osal_heap_block_cnt( void )
+{
+  return osalMemCtx.blkCnt;
+}
+
+/*********************************************************************
+ * @fn      osal_heap_block_free
+ *
+ * @brief   Return the current number of free blocks.
+ *
+ * @param   none
+ *
+ * @return  Current number of free blocks.
+ */
+uint16 osal_heap_block_free( void )
+{
+  return osalMemCtx.blkFree;
+}
+
+/*********************************************************************
+ * @fn      osal_heap_mem_used
+ *
+ * @brief   Return the current number of bytes allocated.
+ *
+ * @param   none
+ *
+ * @return  Current number of bytes allocated.
+ */
+uint16 osal_heap_mem_used( void )
+{
+  return osalMemCtx.memAlo;
+}
+
+/*********************************************************************
+ * @fn      osal_heap_largest_free
+ *
+ * @brief   Return the payload bytes of the largest free block as the
+ *          heap holds it now, without the merging that an allocation
+ *          walk may still do. Tracks fragmentation in the field. Walks
+ *          the whole heap with interrupts off - not for periodic use.
+ *
+ * @param   none
+ *
+ * @return  Payload bytes of the largest free block, 0 if none.
+ */
+uint16 osal_heap_largest_free( void )
+{
+  halIntState_t intState;
+  uint16 best = 0;
+  uint16 size;
+#if ( OSALMEM_ALLOCATOR == OSALMEM_ALLOC_SEGFIT )
+  uint16 blk = 0;
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  best = osalMemCtx.segTop - osalMemCtx.segBrk;
+
+  // The region carved up from the bottom, then the one carved down from the top.
+  while ( blk < OSALMEM_SEG_END )
+  {
+    if ( blk == osalMemCtx.segBrk )
+    {
+      blk = osalMemCtx.segTop;
+      if ( blk >= OSALMEM_SEG_END )
+      {
+        break;
+      }
+    }
+
+    size = *OSALMEM_BLK_HDR( blk );
+    if ( !(size & OSALMEM_IN_USE) && (best < size) )
+    {
+      best = size;
+    }
+    blk += size & OSALMEM_SIZE_MASK;
+  }
+#else
+  osalMemHdr_t *hdr = (osalMemHdr_t *)theHeap;
+
+  OSALMEM_ENTER_CRITICAL( intState );  // Hold off interrupts.
+
+  // The end-of-heap NULL block is the only one of size zero.
+  while ( (size = (*hdr & OSALMEM_SIZE_MASK)) != 0 )
+  {
+    if ( !(*hdr & OSALMEM_IN_USE) && (best < size) )
+    {
+      best = size;
+    }
+    hdr = (osalMemHdr_t *)((byte *)hdr + size);
+  }
+#endif
+
+  OSALMEM_EXIT_CRITICAL( intState, OSALMEM_IRQ_OTHER );  // Re-enable interrupts.
+
+  return ( (best > HDRSZ) ? (best - HDRSZ) : 0 );
+}
+
+#if ( OSALMEM_SCRATCH )
+/*********************************************************************
+ * @fn      osal_heap_scratch_max
+ *
+ * @brief   Return the most scratch arena bytes ever in use at once, to
+ *          size OSALMEM_SCRATCH_LEN.
+ *
+ * @param   none
+ *
+ * @return  Scratch arena high-water mark in bytes.
+ */
+uint16 osal_heap_scratch_max( void )
+{
+  return osalMemCtx.scratchMax;
+}
+#endif
+#endif
+
+#if defined (ZTOOL_P1) || defined (ZTOOL_P2)
+/*********************************************************************
+ * @fn      osal_heap_high_water
+ *
+ * @brief   Return the highest byte ever allocated in the heap.
+ *
+ * @param   none
+ *
+ * @return  Highest number of bytes ever used by the stack.
+ */
+uint16 osal_heap_high_water( void )
+{
+#if ( OSALMEM_METRICS )
+  return osalMemCtx.memMax;
+#else
+  return MAXMEMHEAP;
+#endif
+}
+#endif
+
+#if ( OSAL_MULTI_INSTANCE )
+/*********************************************************************
+ * @fn      osalMemCtxNew
+ *
+ * @brief   Allocate the zeroed heap state of a new OSAL instance. The
+ *          heap is set up by osal_init_system() once it is current.
+ *
+ * @param   none
+ *
+ * @return  The new state, NULL if out of host memory.
+ */
+void *osalMemCtxNew( void )
+{
+  return calloc( 1, sizeof( osalMemCtx_t ) );
+}
+
+/*********************************************************************
+ * @fn      osalMemCtxUse
+ *
+ * @brief   Make the heap state of an OSAL instance the current one.
+ *
+ * @param   ctx - State from osalMemCtxNew().
+ *
+ * @return  none
+ */
+void osalMemCtxUse( void *ctx )
+{
+  osalMemCur = (osalMemCtx_t *)ctx;
+}
+#endif
+
+/*********************************************************************
+*********************************************************************/
@@ -1,234 +1,317 @@
-/*********************************************************************
-    Filename:       OSAL_Tasks.c
-    Revised:        $Date: 2006-04-06 08:19:08 -0700 (Thu, 06 Apr 2006) $
-    Revision:       $Revision: 10396 $
-
-    Description:
-
-       This file contains the OSAL Task definition and manipulation
-       functions.
-
-    Notes:
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-
-/*********************************************************************
- * INCLUDES
- */
-#include "ZComDef.h"
-#include "OSAL.h"
-#include "OSAL_Tasks.h"
-#include "OSAL_Custom.h"
-
-
- /*********************************************************************
- * MACROS
- */
-
-/*********************************************************************
- * CONSTANTS
- */
-
-
-/*********************************************************************
- * TYPEDEFS
- */
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
-
-// Task Control
-osalTaskRec_t *tasksHead;
-
-osalTaskRec_t *activeTask;
-
-byte taskIDs;
-
-/*********************************************************************
- * EXTERNAL VARIABLES
- */
-
-/*********************************************************************
- * EXTERNAL FUNCTIONS
- */
-
- /*********************************************************************
- * LOCAL VARIABLES
- */
-
-/*********************************************************************
- * LOCAL FUNCTION PROTOTYPES
- */
-
-/*********************************************************************
- * FUNCTIONS
- *********************************************************************/
-
-/*********************************************************************
- * @fn      osalTaskInit
- *
- * @brief   Initialization for the Tasking System.
- *
- * @param   none
- *
- * @return
- */
-void osalTaskInit( void )
-{
-  tasksHead = (osalTaskRec_t *)NULL;
-  activeTask = (osalTaskRec_t *)NULL;
-  taskIDs = 0;
-}
-
-/***************************************************************************
- * @fn      osalTaskAdd
- *
- * @brief   Add a task to the task list. Keep task queue in priority order.
- *
- * @param   none
- *
- * @return
- */
-void osalTaskAdd( pTaskInitFn pfnInit,
-                  pTaskEventHandlerFn pfnEventProcessor,
-                  byte taskPriority)
-{
-  osalTaskRec_t *newTask;
-  osalTaskRec_t *srchTask;
-  osalTaskRec_t **ptr;
-
-  newTask = osal_mem_alloc( sizeof( osalTaskRec_t ) );
-  if ( newTask )
-  {
-      // Fill in new task
-      newTask->pfnInit           = pfnInit;
-      newTask->pfnEventProcessor = pfnEventProcessor;
-      newTask->taskID            = taskIDs++;
-      newTask->taskPriority      = taskPriority;
-      newTask->events            = 0;
-      newTask->next              = (osalTaskRec_t *)NULL;
-
-      // 'ptr' is the address of the pointer to the new task when the new task is
-      // inserted. Initially it is set to address of 'tasksHead' in case the new
-      // task is higher priority than the existing head or the queue is empty.
-      ptr      = &tasksHead;
-      srchTask = tasksHead;
-      while (srchTask)  {
-          if (newTask->taskPriority > srchTask->taskPriority)  {
-              // insert here. New task has a higher priority than the task
-              // with which is being compared and a lower or equal priority
-              // to any task that precedes it.
-              newTask->next = srchTask;
-              *ptr          = newTask;
-              return;
-          }
-          // set 'ptr' to address of the pointer to 'next' in the current
-          // (soon to be previous) task control block
-          ptr      = &srchTask->next;
-          srchTask = srchTask->next;
-      }
-
-	  // We're at the end of the current queue. New task is not higher
-	  // priority than any other already in the list. Make it the tail.
-      // (It is also the head if the queue was initially empty.)
-      *ptr = newTask;
-  }
-  return;
-}
-
-/*********************************************************************
- * @fn      osalInitTasks
- *
- * @brief   Call each of the tasks initailization functions.
- *
- * @param   none
- *
- * @return  none
- */
-void osalInitTasks( void )
-{
-  // Start at the beginning
-  activeTask = tasksHead;
-
-  // Stop at the end
-  while ( activeTask )
-  {
-    if (  activeTask->pfnInit  )
-      activeTask->pfnInit( activeTask->taskID );
-
-    activeTask = activeTask->next;
-  }
-
-  activeTask = (osalTaskRec_t *)NULL;
-}
-
-/*********************************************************************
- * @fn      osalNextActiveTask
- *
- * @brief   This function will return the next active task.
- *
- * NOTE:    Task queue is in priority order. We can stop at the
- *          first task that is "ready" (events element non-zero)
- *
- * @param   none
- *
- * @return  pointer to the found task, NULL if not found
- */
-osalTaskRec_t *osalNextActiveTask( void )
-{
-  osalTaskRec_t *srchTask;
-
-  // Start at the beginning
-  srchTask = tasksHead;
-
-  // When found or not
-  while ( srchTask )  {
-      if (srchTask->events)  {
-		  // task is highest priority that is ready
-          return srchTask;
-      }
-      srchTask = srchTask->next;
-  }
-  return NULL;
-}
-
-
-/*********************************************************************
- * @fn      osalFindTask
- *
- * @brief   This function will return a task pointer to the task
- *          found with the passed in task ID.
- *
- * @param   taskID - task ID to look for
- *
- * @return  pointer to the found task, NULL if not found
- */
-osalTaskRec_t *osalFindTask( byte taskID )
-{
-  osalTaskRec_t *srchTask;
-
-  // Start at the beginning
-  srchTask = tasksHead;
-
-  // When found or not
-  while ( srchTask )
-  {
-    // Look for any activity
-    if (  srchTask->taskID == taskID  )
-      return ( srchTask );
-
-    srchTask = srchTask->next;
-  }
-
-  return ( (osalTaskRec_t *)NULL );
-}
-
-/*********************************************************************
-*********************************************************************/
+/*********************************************************************
+    Filename:       OSAL_Tasks.c
+    Revised:        $Date: 2006-04-06 08:19:08 -0700 (Thu, 06 Apr 2006) $
+    Revision:       $Revision: 10396 $
+
+    Description:
+
+       This file contains the OSAL Task definition and manipulation
+       functions.
+
+    Notes:
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include "ZComDef.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Custom.h"
+#include "hal_assert.h"
+
+#if ( OSAL_MULTI_INSTANCE )
+  #include <stdlib.h>
+#endif
+
+
+ /*********************************************************************
+ * MACROS
+ */
+
+/*********************************************************************
+ * CONSTANTS
+ */
+
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+
+// Task Control
+#if ( OSAL_MULTI_INSTANCE )
+  osalTaskCtx_t *osalTaskCur;
+#else
+  osalTaskCtx_t osalTaskCtx;
+#endif
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+
+ /*********************************************************************
+ * LOCAL VARIABLES
+ */
+
+// Index of the least significant set bit of a nibble.
+static const CODE byte osalLowBit[16] = {
+  0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+
+/*********************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ */
+static void osalTaskRank( void );
+
+/*********************************************************************
+ * FUNCTIONS
+ *********************************************************************/
+
+/*********************************************************************
+ * @fn      osalTaskInit
+ *
+ * @brief   Initialization for the Tasking System.
+ *
+ * @param   none
+ *
+ * @return
+ */
+void osalTaskInit( void )
+{
+  osalTaskCtx.tasksHead = (osalTaskRec_t *)NULL;
+  activeTask = (osalTaskRec_t *)NULL;
+  osalTaskCtx.taskIDs = 0;
+  osalTaskCtx.ready = 0;
+}
+
+/***************************************************************************
+ * @fn      osalTaskAdd
+ *
+ * @brief   Add a task to the task table, at the index of its task ID.
+ *          Keep task queue in priority order. A task past OSAL_MAX_TASKS
+ *          is a fatal error; with HALNODEBUG it is not added.
+ *
+ * @param   none
+ *
+ * @return
+ */
+void osalTaskAdd( pTaskInitFn pfnInit,
+                  pTaskEventHandlerFn pfnEventProcessor,
+                  byte taskPriority)
+{
+  osalTaskRec_t *newTask;
+  osalTaskRec_t *srchTask;
+  osalTaskRec_t **ptr;
+
+  // The task table holds OSAL_MAX_TASKS tasks
+  HAL_ASSERT( osalTaskCtx.taskIDs < OSAL_MAX_TASKS );
+
+  if ( osalTaskCtx.taskIDs < OSAL_MAX_TASKS )
+  {
+      newTask = &osalTaskCtx.tasks[osalTaskCtx.taskIDs];
+
+      // Fill in new task
+      newTask->pfnInit           = pfnInit;
+      newTask->pfnEventProcessor = pfnEventProcessor;
+      newTask->taskID            = osalTaskCtx.taskIDs++;
+      newTask->taskPriority      = taskPriority;
+      newTask->events            = 0;
+#if ( OSAL_DISPATCH_STATS )
+      newTask->dispatch.dispatches = 0;
+      newTask->dispatch.worstDelay = 0;
+#endif
+      newTask->next              = (osalTaskRec_t *)NULL;
+
+      // 'ptr' is the address of the pointer to the new task when the new task is
+      // inserted. Initially it is set to address of 'tasksHead' in case the new
+      // task is higher priority than the existing head or the queue is empty.
+      ptr      = &osalTaskCtx.tasksHead;
+      srchTask = osalTaskCtx.tasksHead;
+      while (srchTask)  {
+          if (newTask->taskPriority > srchTask->taskPriority)  {
+              // insert here. New task has a higher priority than the task
+              // with which is being compared and a lower or equal priority
+              // to any task that precedes it.
+              newTask->next = srchTask;
+              break;
+          }
+          // set 'ptr' to address of the pointer to 'next' in the current
+          // (soon to be previous) task control block
+          ptr      = &srchTask->next;
+          srchTask = srchTask->next;
+      }
+
+      // Link it in. If we're at the end of the current queue, the new task
+      // is not higher priority than any other already in the list and is
+      // the tail. (It is also the head if the queue was initially empty.)
+      *ptr = newTask;
+
+      // The ready bits follow the priority order
+      osalTaskRank();
+  }
+  return;
+}
+
+/*********************************************************************
+ * @fn      osalTaskRank
+ *
+ * @brief   Give the tasks their ready bits in priority order, the
+ *          highest priority task bit 0, and rebuild the ready bitmap.
+ *
+ * @param   none
+ *
+ * @return  none
+ */
+static void osalTaskRank( void )
+{
+  osalTaskRec_t *srchTask;
+  osalTaskReady_t readyBit;
+  byte rank;
+
+  osalTaskCtx.ready = 0;
+  readyBit = 1;
+  rank = 0;
+
+  for ( srchTask = osalTaskCtx.tasksHead; srchTask; srchTask = srchTask->next )
+  {
+    osalTaskCtx.ranked[rank++] = srchTask;
+    srchTask->readyBit = readyBit;
+    OSAL_TASK_READY( srchTask );
+    readyBit <<= 1;
+  }
+}
+
+/*********************************************************************
+ * @fn      osalInitTasks
+ *
+ * @brief   Call each of the tasks initailization functions.
+ *
+ * @param   none
+ *
+ * @return  none
+ */
+void osalInitTasks( void )
+{
+  // Start at the beginning
+  activeTask = osalTaskCtx.tasksHead;
+
+  // Stop at the end
+  while ( activeTask )
+  {
+    if (  activeTask->pfnInit  )
+      activeTask->pfnInit( activeTask->taskID );
+
+    activeTask = activeTask->next;
+  }
+
+  activeTask = (osalTaskRec_t *)NULL;
+}
+
+/*********************************************************************
+ * @fn      osalNextActiveTask
+ *
+ * @brief   This function will return the next active task.
+ *
+ * NOTE:    Ready bits are in priority order. The lowest bit set in
+ *          the ready bitmap is the highest priority task that is
+ *          "ready" (events element non-zero)
+ *
+ * @param   none
+ *
+ * @return  pointer to the found task, NULL if not found
+ */
+osalTaskRec_t *osalNextActiveTask( void )
+{
+  osalTaskReady_t ready;
+  byte rank;
+
+  ready = osalTaskCtx.ready;
+  if ( ready == 0 )
+    return NULL;
+
+  rank = 0;
+#if ( OSAL_MAX_TASKS > 8 )
+  if ( (ready & 0x00FF) == 0 )
+  {
+    ready >>= 8;
+    rank = 8;
+  }
+#endif
+#if ( OSAL_MAX_TASKS > 4 )
+  if ( (ready & 0x0F) == 0 )
+  {
+    ready >>= 4;
+    rank += 4;
+  }
+#endif
+  rank += osalLowBit[ready & 0x0F];
+
+  return osalTaskCtx.ranked[rank];
+}
+
+
+/*********************************************************************
+ * @fn      osalFindTask
+ *
+ * @brief   This function will return a task pointer to the task
+ *          found with the passed in task ID.
+ *
+ * @param   taskID - task ID to look for
+ *
+ * @return  pointer to the found task, NULL if not found
+ */
+osalTaskRec_t *osalFindTask( byte taskID )
+{
+  // Task IDs are the indexes of the added tasks
+  if ( taskID < osalTaskCtx.taskIDs )
+    return ( &osalTaskCtx.tasks[taskID] );
+
+  return ( (osalTaskRec_t *)NULL );
+}
+
+#if ( OSAL_MULTI_INSTANCE )
+/*********************************************************************
+ * @fn      osalTaskCtxNew
+ *
+ * @brief   Allocate the zeroed task state of a new OSAL instance.
+ *
+ * @param   none
+ *
+ * @return  The new state, NULL if out of host memory.
+ */
+void *osalTaskCtxNew( void )
+{
+  return calloc( 1, sizeof( osalTaskCtx_t ) );
+}
+
+/*********************************************************************
+ * @fn      osalTaskCtxUse
+ *
+ * @brief   Make the task state of an OSAL instance the current one.
+ *
+ * @param   ctx - State from osalTaskCtxNew().
+ *
+ * @return  none
+ */
+void osalTaskCtxUse( void *ctx )
+{
+  osalTaskCur = (osalTaskCtx_t *)ctx;
+}
+#endif
+
+/*********************************************************************
+*********************************************************************/
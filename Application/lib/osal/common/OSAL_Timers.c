@@ -1,739 +1,1781 @@
-/*********************************************************************
-    Filename:       OSAL_Timers.c
-    Revised:        $Date: 2006-10-27 16:25:55 -0700 (Fri, 27 Oct 2006) $
-    Revision:       $Revision: 12442 $
-
-    Description:    OSAL Timer definition and manipulation functions.
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-/*********************************************************************
- * INCLUDES
- */
-
-#include "ZComDef.h"
-#include "OnBoard.h"
-#include "OSAL.h"
-#include "OSAL_Timers.h"
-
-#include "hal_timer.h"
-#include "hal_led.h"
-
-/*********************************************************************
- * MACROS
- */
-
-/*********************************************************************
- * CONSTANTS
- */
-
-/*********************************************************************
- * TYPEDEFS
- */
-
-typedef struct
-{
-  void *next;
-  UINT16 timeout;
-  UINT16 event_flag;
-  byte task_id;
-} osalTimerRec_t;
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
-
-osalTimerRec_t *timerHead;
-uint32 tmr_count;          // Amount of time per tick - in micro-sec
-uint16 tmr_decr_time;      // Decr_Time for system timer
-byte timerActive;          // Flag if hw timer active
-
-/*********************************************************************
- * EXTERNAL VARIABLES
- */
-
-/*********************************************************************
- * EXTERNAL FUNCTIONS
- */
-
-/*********************************************************************
- * LOCAL VARIABLES
- */
-// Milliseconds since last reboot
-static uint32 osal_systemClock;
-
-/*********************************************************************
- * LOCAL FUNCTION PROTOTYPES
- */
-osalTimerRec_t  *osalAddTimer( byte task_id, UINT16 event_flag, UINT16 timeout );
-osalTimerRec_t *osalFindTimer( byte task_id, uint16 event_flag );
-void osalDeleteTimer( osalTimerRec_t *rmTimer );
-static void osalTimerUpdate( uint16 time );
-
-void osal_timer_activate( byte turn_on );
-void osal_timer_hw_setup( byte turn_on );
-void osal_set_timer_interrupt( byte turn_on );
-void osal_retune_timers( void );
-
-/*********************************************************************
- * FUNCTIONS
- *********************************************************************/
-
-/*********************************************************************
- * @fn      osalTimerInit
- *
- * @brief   Initialization for the OSAL Timer System.
- *
- * @param   none
- *
- * @return
- */
-void osalTimerInit( void )
-{
-  // Initialize the rollover modulo
-  tmr_count = TICK_TIME;
-  tmr_decr_time = TIMER_DECR_TIME;
-
-  // Initialize the system timer
-  osal_timer_activate( false );
-  timerActive = false;
-
-  osal_systemClock = 0;
-}
-
-/*********************************************************************
- * @fn      osalAddTimer
- *
- * @brief   Add a timer to the timer list.
- *          Ints must be disabled.
- *
- * @param   task_id
- * @param   event_flag
- * @param   timeout
- *
- * @return  osalTimerRec_t * - pointer to newly created timer
- */
-osalTimerRec_t * osalAddTimer( byte task_id, UINT16 event_flag, UINT16 timeout )
-{
-  osalTimerRec_t *newTimer;
-  osalTimerRec_t *srchTimer;
-
-  // Look for an existing timer first
-  newTimer = osalFindTimer( task_id, event_flag );
-  if ( newTimer )
-  {
-    // Timer is found - update it.
-    newTimer->timeout = timeout;
-
-    return ( newTimer );
-  }
-  else
-  {
-    // New Timer
-    newTimer = osal_mem_alloc( sizeof( osalTimerRec_t ) );
-
-    if ( newTimer )
-    {
-      // Fill in new timer
-      newTimer->task_id = task_id;
-      newTimer->event_flag = event_flag;
-      newTimer->timeout = timeout;
-      newTimer->next = (void *)NULL;
-
-      // Does the timer list already exist
-      if ( timerHead == NULL )
-      {
-        // Start task list
-        timerHead = newTimer;
-      }
-      else
-      {
-        // Add it to the end of the timer list
-        srchTimer = timerHead;
-
-        // Stop at the last record
-        while ( srchTimer->next )
-          srchTimer = srchTimer->next;
-
-        // Add to the list
-        srchTimer->next = newTimer;
-      }
-
-      return ( newTimer );
-    }
-    else
-      return ( (osalTimerRec_t *)NULL );
-  }
-}
-
-/*********************************************************************
- * @fn      osalFindTimer
- *
- * @brief   Find a timer in a timer list.
- *          Ints must be disabled.
- *
- * @param   task_id
- * @param   event_flag
- *
- * @return  osalTimerRec_t *
- */
-osalTimerRec_t *osalFindTimer( byte task_id, uint16 event_flag )
-{
-  osalTimerRec_t *srchTimer;
-
-  // Head of the timer list
-  srchTimer = timerHead;
-
-  // Stop when found or at the end
-  while ( srchTimer )
-  {
-    if ( srchTimer->event_flag == event_flag &&
-         srchTimer->task_id == task_id )
-      break;
-
-    // Not this one, check another
-    srchTimer = srchTimer->next;
-  }
-
-  return ( srchTimer );
-}
-
-/*********************************************************************
- * @fn      osalDeleteTimer
- *
- * @brief   Delete a timer from a timer list.
- *          Ints must be disabled.
- *
- * @param   table
- * @param   rmTimer
- *
- * @return  none
- */
-void osalDeleteTimer( osalTimerRec_t *rmTimer )
-{
-  osalTimerRec_t *srchTimer;
-
-  // Does the timer list really exist
-  if ( (timerHead != NULL) && rmTimer )
-  {
-    // Add it to the end of the timer list
-    srchTimer = timerHead;
-
-    // First element?
-    if ( srchTimer == rmTimer )
-    {
-      timerHead = rmTimer->next;
-      osal_mem_free( rmTimer );
-    }
-    else
-    {
-      // Stop when found or at the end
-      while ( srchTimer->next && srchTimer->next != rmTimer )
-        srchTimer = srchTimer->next;
-
-      // Found?
-      if ( srchTimer->next == rmTimer )
-      {
-        // Fix pointers
-        srchTimer->next = rmTimer->next;
-
-        // Deallocate the timer struct memory
-        osal_mem_free( rmTimer );
-      }
-    }
-  }
-}
-
-/*********************************************************************
- * @fn      osal_start_timer
- *
- * @brief
- *
- *   This function is called to start a timer to expire in n mSecs.
- *   When the timer expires, the calling task will get the specified event.
- *
- * @param   UINT16 event_id - event to be notified with
- * @param   UNINT16 timeout_value - in milliseconds.
- *
- * @return  ZSUCCESS, NO_TIMER_AVAIL, INVALID_EVENT_ID or INVALID_TIMEOUT_VALUE
- */
-byte osal_start_timer( UINT16 event_id, UINT16 timeout_value )
-{
-  return osal_start_timerEx( osal_self(), event_id, timeout_value );
-}
-
-/*********************************************************************
- * @fn      osal_start_timerEx
- *
- * @brief
- *
- *   This function is called to start a timer to expire in n mSecs.
- *   When the timer expires, the calling task will get the specified event.
- *
- * @param   byte taskID - task id to set timer for
- * @param   UINT16 event_id - event to be notified with
- * @param   UNINT16 timeout_value - in milliseconds.
- *
- * @return  ZSUCCESS, or NO_TIMER_AVAIL.
- */
-byte osal_start_timerEx( byte taskID, UINT16 event_id, UINT16 timeout_value )
-{
-  halIntState_t intState;
-  osalTimerRec_t *newTimer;
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  // Add timer
-  newTimer = osalAddTimer( taskID, event_id, timeout_value );
-  if ( newTimer )
-  {
-#ifdef POWER_SAVING
-    // Update timer registers
-    osal_retune_timers();
-    (void)timerActive;
-#endif
-    // Does the timer need to be started?
-    if ( timerActive == FALSE )
-    {
-      osal_timer_activate( TRUE );
-    }
-  }
-
-  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
-
-  return ( (newTimer != NULL) ? ZSUCCESS : NO_TIMER_AVAIL );
-}
-
-/*********************************************************************
- * @fn      osal_stop_timer
- *
- * @brief
- *
- *   This function is called to stop a timer that has already been started.
- *   If ZSUCCESS, the function will cancel the timer and prevent the event
- *   associated with the timer from being set for the calling task.
- *
- * @param   UINT16 event_id - identifier of the timer that is to be stopped
- *
- * @return  ZSUCCESS or INVALID_EVENT_ID
- */
-byte osal_stop_timer( UINT16 event_id )
-{
-  return osal_stop_timerEx( osal_self(), event_id );
-}
-
-/*********************************************************************
- * @fn      osal_stop_timerEx
- *
- * @brief
- *
- *   This function is called to stop a timer that has already been started.
- *   If ZSUCCESS, the function will cancel the timer and prevent the event
- *   associated with the timer from being set for the calling task.
- *
- * @param   byte task_id - task id of timer to stop
- * @param   UINT16 event_id - identifier of the timer that is to be stopped
- *
- * @return  ZSUCCESS or INVALID_EVENT_ID
- */
-byte osal_stop_timerEx( byte task_id, UINT16 event_id )
-{
-  halIntState_t intState;
-  osalTimerRec_t *foundTimer;
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  // Find the timer to stop
-  foundTimer = osalFindTimer( task_id, event_id );
-  if ( foundTimer )
-  {
-    osalDeleteTimer( foundTimer );
-
-#ifdef POWER_SAVING
-    osal_retune_timers();
-#endif
-  }
-
-  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
-
-  return ( (foundTimer != NULL) ? ZSUCCESS : INVALID_EVENT_ID );
-}
-
-/*********************************************************************
- * @fn      osal_get_timeoutEx
- *
- * @brief
- *
- * @param   byte task_id - task id of timer to check
- * @param   UINT16 event_id - identifier of timer to be checked
- *
- * @return  Return the timer's tick count if found, zero otherwise.
- */
-UINT16 osal_get_timeoutEx( byte task_id, UINT16 event_id )
-{
-  halIntState_t intState;
-  uint16 rtrn = 0;
-  osalTimerRec_t *tmr;
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  tmr = osalFindTimer( task_id, event_id );
-
-  if ( tmr )
-  {
-    rtrn = tmr->timeout;
-  }
-
-  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
-
-  return rtrn;
-}
-
-/*********************************************************************
- * @fn      osal_timer_activate
- *
- * @brief
- *
- *   Turns the hardware timer on or off
- *
- * @param  byte turn_on - false - turn off, true - turn on
- *
- * @return  none
- */
-void osal_timer_activate( byte turn_on )
-{
-  osal_timer_hw_setup( turn_on );
-  timerActive = turn_on;
-}
-
-/*********************************************************************
- * @fn      osal_timer_num_active
- *
- * @brief
- *
- *   This function counts the number of active timers.
- *
- * @return  byte - number of timers
- */
-byte osal_timer_num_active( void )
-{
-  halIntState_t intState;
-  byte num_timers = 0;
-  osalTimerRec_t *srchTimer;
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  // Head of the timer list
-  srchTimer = timerHead;
-
-  // Count timers in the list
-  while ( srchTimer != NULL )
-  {
-    num_timers++;
-    srchTimer = srchTimer->next;
-  }
-
-  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
-
-  return num_timers;
-}
-
-/*********************************************************************
- * @fn      osal_timer_hw_setup
- *
- * @brief
- *
- *   Setup the timer hardware.
- *
- * @param  byte turn_on
- *
- * @return  void
- */
-void osal_timer_hw_setup( byte turn_on )
-{
-  if (turn_on)
-  {
-    HalTimerStart (OSAL_TIMER, tmr_count );
-  }
-  else
-  {
-    HalTimerStop (OSAL_TIMER);
-  }
-}
-
-#if defined( POWER_SAVING )
-/*********************************************************************
- * @fn      osal_sleep_timers
- *
- * @brief
- *
- *   This function will enable interrupts if timers are running.
- *
- * @param  none
- *
- * @return  none
- */
-void osal_sleep_timers( void )
-{
-#ifndef TIMER_INT
-  if ( osal_timer_num_active() )
-    osal_set_timer_interrupt( TRUE );
-#endif
-}
-
-/*********************************************************************
- * @fn      osal_unsleep_timers
- *
- * @brief
- *
- *   This function will disable interrupts if timers are running.
- *
- * @param  none
- *
- * @return  none
- */
-void osal_unsleep_timers( void )
-{
-#ifndef TIMER_INT
-  osal_set_timer_interrupt( FALSE );
-#endif
-}
-#endif
-
-/*********************************************************************
- * @fn      osal_set_timer_interrupt
- *
- * @brief
- *
- *   Setup the timer hardware interrupt.
- *
- * @param  byte turn_on
- *
- * @return  void
- *********************************************************************/
-void osal_set_timer_interrupt( byte turn_on )
-{
-  // Enable or disable timer interrupts
-  HalTimerInterruptEnable ( OSAL_TIMER, HAL_TIMER_CH_MODE_OUTPUT_COMPARE, turn_on);
-}
-
-/*********************************************************************
- * @fn      osalTimerUpdate
- *
- * @brief   Update the timer structures for a timer tick.
- *
- * @param   none
- *
- * @return  none
- *********************************************************************/
-static void osalTimerUpdate( uint16 updateTime )
-{
-  halIntState_t intState;
-  osalTimerRec_t *srchTimer;
-  osalTimerRec_t *prevTimer;
-  osalTimerRec_t *saveTimer;
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  // Update the system time
-  osal_systemClock += updateTime;
-
-  // Look for open timer slot
-  if ( timerHead != NULL )
-  {
-    // Add it to the end of the timer list
-    srchTimer = timerHead;
-    prevTimer = (void *)NULL;
-
-    // Look for open timer slot
-    while ( srchTimer )
-    {
-      // Decrease the correct amount of time
-      if (srchTimer->timeout <= updateTime)
-        srchTimer->timeout = 0;
-      else
-        srchTimer->timeout = srchTimer->timeout - updateTime;
-
-      // When timeout, execute the task
-      if ( srchTimer->timeout == 0 )
-      {
-        osal_set_event( srchTimer->task_id, srchTimer->event_flag );
-
-        // Take out of list
-        if ( prevTimer == NULL )
-          timerHead = srchTimer->next;
-        else
-          prevTimer->next = srchTimer->next;
-
-        // Next
-        saveTimer = srchTimer->next;
-
-        // Free memory
-        osal_mem_free( srchTimer );
-
-        srchTimer = saveTimer;
-      }
-      else
-      {
-        // Get next
-        prevTimer = srchTimer;
-        srchTimer = srchTimer->next;
-      }
-    }
-
-#ifdef POWER_SAVING
-    osal_retune_timers();
-#endif
-  }
-
-  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
-}
-
-/*********************************************************************
- * @fn      osal_update_timers
- *
- * @brief   Update the timer structures for timer ticks.
- *
- * @param   none
- *
- * @return  none
- */
-void osal_update_timers( void )
-{
-  osalTimerUpdate( tmr_decr_time );
-}
-
-#ifdef POWER_SAVING
-/*********************************************************************
- * @fn      osal_adjust_timers
- *
- * @brief   Update the timer structures for elapsed ticks.
- *
- * @param   none
- *
- * @return  none
- *********************************************************************/
-void osal_adjust_timers( void )
-{
-  uint16 eTime;
-
-  if ( timerHead != NULL )
-  {
-    // Compute elapsed time (msec)
-    eTime = TimerElapsed() /  TICK_COUNT;
-
-    if ( eTime )
-      osalTimerUpdate( eTime );
-  }
-}
-#endif
-
-#ifdef POWER_SAVING
-/*********************************************************************
- * @fn      osal_retune_timers
- *
- * @brief
- *
- *   Adjust CPU sleep time to the lowest timeout value. If the timeout
- *   value is more then RETUNE_THRESHOLD, then the sleep time will be
- *   RETUNE_THRESHOLD.
- *
- * @param   none
- *
- * @return  none
- *********************************************************************/
-void osal_retune_timers( void )
-{
-  halIntState_t intState;
-  uint16 nextTimeout;
-
-  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
-
-  // Next occuring timeout
-  nextTimeout = osal_next_timeout();
-
-  // Make sure timer counter can handle it
-  if ( !nextTimeout || (nextTimeout > RETUNE_THRESHOLD) )
-    nextTimeout = RETUNE_THRESHOLD;
-
-  if (nextTimeout != tmr_decr_time)
-  {
-    // Stop the clock
-    osal_timer_activate( FALSE );
-
-    // Alter the rolling time
-    tmr_decr_time = nextTimeout;
-    tmr_count = (uint32)nextTimeout * TICK_TIME;
-
-    // Restart the clock
-    osal_timer_activate( TRUE );
-  }
-
-  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
-}
-
-/*********************************************************************
- * @fn      osal_next_timeout
- *
- * @brief
- *
- *   Search timer table to return the lowest timeout value. If the
- *   timer list is empty, then the returned timeout will be zero.
- *
- * @param   none
- *
- * @return  none
- *********************************************************************/
-uint16 osal_next_timeout( void )
-{
-  uint16 nextTimeout;
-  osalTimerRec_t *srchTimer;
-
-  if ( timerHead != NULL )
-  {
-    // Head of the timer list
-    srchTimer = timerHead;
-    nextTimeout = OSAL_TIMERS_MAX_TIMEOUT;
-
-    // Look for the next timeout timer
-    while ( srchTimer != NULL )
-    {
-      if (srchTimer->timeout < nextTimeout)
-      {
-        nextTimeout = srchTimer->timeout;
-      }
-      // Check next timer
-      srchTimer = srchTimer->next;
-    }
-  }
-  else
-  {
-    // No timers
-    nextTimeout = 0;
-  }
-
-  return ( nextTimeout );
-}
-#endif // POWER_SAVING
-
-/*********************************************************************
- * @fn      osal_GetSystemClock()
- *
- * @brief   Read the local system clock.
- *
- * @param   none
- *
- * @return  local clock in milliseconds
- */
-uint32 osal_GetSystemClock( void )
-{
-  return ( osal_systemClock );
-}
-
-/*********************************************************************
-*********************************************************************/
+/*********************************************************************
+    Filename:       OSAL_Timers.c
+    Revised:        $Date: 2006-10-27 16:25:55 -0700 (Fri, 27 Oct 2006) $
+    Revision:       $Revision: 12442 $
+
+    Description:    OSAL Timer definition and manipulation functions.
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+/*********************************************************************
+ * INCLUDES
+ */
+
+#include "ZComDef.h"
+#include "OnBoard.h"
+#include "OSAL.h"
+#include "OSAL_Timers.h"
+
+#include "hal_timer.h"
+#include "hal_led.h"
+
+#if ( OSAL_MULTI_INSTANCE )
+  #include <stdlib.h>
+#endif
+
+/*********************************************************************
+ * MACROS
+ */
+
+#define OSAL_TIMERS_ARMED()  ( osalTimerCtx.timerCnt != 0 )
+
+// Lookup bucket of a timer. The multiply gives each single-bit event
+// flag of a task its own bucket.
+#define OSAL_TIMER_HASH( task_id, event_flag ) \
+  ( (byte)(((uint16)((event_flag) * 0x0F2D) >> 12) + (task_id)) & (OSAL_TIMER_HASH_CNT - 1) )
+
+// Is the timer of a task event tracked in the armed events bitmap?
+// Only single-bit event flags are, so that a bit has one timer.
+#define OSAL_TIMER_IN_BITMAP( task_id, event_flag ) \
+  ( ((task_id) < OSAL_TIMER_TASK_CNT) && (((event_flag) & ((event_flag) - 1)) == 0) )
+
+/*********************************************************************
+ * CONSTANTS
+ */
+
+#if ( OSAL_TIMER_WHEEL )
+  // 4 levels of 16 slots; a slot of level n spans 16^n ticks.
+  #define OSAL_WHEEL_BITS    4
+  #define OSAL_WHEEL_SLOTS   (1 << OSAL_WHEEL_BITS)
+  #define OSAL_WHEEL_MASK    (OSAL_WHEEL_SLOTS - 1)
+  #define OSAL_WHEEL_LEVELS  (16 / OSAL_WHEEL_BITS)
+#endif
+
+// Timeouts past OSAL_TIMERS_MAX_TIMEOUT run in laps of OSAL_TIMER_LAP ms
+#define OSAL_TIMER_LAP_BITS    15
+#define OSAL_TIMER_LAP         ((uint16)1 << OSAL_TIMER_LAP_BITS)
+
+// osalTimerRec_t flags
+#define OSAL_TIMER_REC_ARMED   0x01  // In the timer list
+#define OSAL_TIMER_REC_STATIC  0x02  // Storage owned by the caller
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+
+/* osalTimerRec_t is in OSAL_Timers.h.
+ *
+ * Each active timer is in a lookup bucket, found by task and event, and
+ * its event bit is set in the armed events of its task. Both backends
+ * link the timers both ways, so that a timer found is taken out at once.
+ *
+ * Timer wheel: each active timer is in the wheel slot of the level whose
+ * span holds its timeout. When the slots of a level wrap, the next slot
+ * of the level above is cascaded into the levels below; a tick expires
+ * all the timers of the current level 0 slot.
+ *
+ * Timer list: the active timers are kept sorted by expiry, each record
+ * holding the time left after its predecessor expires (the head: after
+ * now). A tick only decrements the head and the next timeout is the head's.
+ */
+typedef struct
+{
+#if ( OSAL_TIMER_WHEEL )
+  void *wheel[OSAL_WHEEL_LEVELS][OSAL_WHEEL_SLOTS];
+  uint16 wheelTime;          // Ticks processed by the wheel
+#else
+  osalTimerRec_t *timerHead;
+#endif
+  void *hash[OSAL_TIMER_HASH_CNT];
+  uint16 timerEvents[OSAL_TIMER_TASK_CNT];  // Armed events of each task
+  uint16 timerCnt;           // Number of active timers
+  uint32 tmr_count;          // Amount of time per tick - in micro-sec
+  uint16 tmr_decr_time;      // Decr_Time for system timer
+  byte timerActive;          // Flag if hw timer active
+#if ( OSAL_TICKLESS )
+  uint16 tmrHwCount;         // OSAL_TIMER count at the last whole tick
+#endif
+#if defined( POWER_SAVING )
+  uint16 wakeupsAvoided;     // Expiries that shared an earlier one's update
+#endif
+  uint32 systemClock;        // Milliseconds since last reboot
+} osalTimerCtx_t;
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL VARIABLES
+ */
+
+/*********************************************************************
+ * EXTERNAL FUNCTIONS
+ */
+
+/*********************************************************************
+ * LOCAL VARIABLES
+ */
+
+#if ( OSAL_MULTI_INSTANCE )
+  static osalTimerCtx_t *osalTimerCur;
+  #define osalTimerCtx  (*osalTimerCur)
+#else
+  static osalTimerCtx_t osalTimerCtx;
+#endif
+
+/*********************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ */
+osalTimerRec_t  *osalAddTimer( byte task_id, UINT16 event_flag, UINT16 timeout );
+osalTimerRec_t *osalFindTimer( byte task_id, uint16 event_flag );
+void osalDeleteTimer( osalTimerRec_t *rmTimer );
+static void osalTimerArm( osalTimerRec_t *timer, byte task_id, uint16 event_flag, uint16 timeout );
+static void osalTimerRelease( osalTimerRec_t *rmTimer );
+static byte osalTimerExpire( osalTimerRec_t *srchTimer );
+static void osalTimerStarted( void );
+static byte osalStartTimer( byte taskID, UINT16 event_id, uint32 timeout_value,
+                            UINT16 reload, byte absolute );
+static byte osalStartTimerRec( osalTimerRec_t *timer, byte taskID, UINT16 event_id,
+                               UINT16 timeout_value, UINT16 reload );
+static void osalTimerLink( osalTimerRec_t *newTimer, uint16 timeout );
+static void osalTimerUnlink( osalTimerRec_t *rmTimer );
+#if ( OSAL_TIMER_WHEEL )
+static void osalWheelPlace( osalTimerRec_t *newTimer, uint16 delta );
+static byte osalWheelTick( void );
+static uint16 osalWheelNext( void );
+#if ( OSAL_TICKLESS ) && !defined( POWER_SAVING )
+static uint16 osalWheelDue( uint16 limit );
+#endif
+#endif
+static void osalTimerHashAdd( osalTimerRec_t *newTimer );
+static void osalTimerHashRemove( osalTimerRec_t *rmTimer );
+static void osalTimerUpdate( uint16 time );
+#if ( OSAL_TICKLESS )
+static void osalTimerElapse( void );
+static void osalTimerSetCompare( void );
+#endif
+#if defined( POWER_SAVING ) || ( OSAL_TICKLESS )
+static uint16 osalTimerNext( void );
+#endif
+
+void osal_timer_activate( byte turn_on );
+void osal_timer_hw_setup( byte turn_on );
+void osal_set_timer_interrupt( byte turn_on );
+void osal_retune_timers( void );
+
+/*********************************************************************
+ * FUNCTIONS
+ *********************************************************************/
+
+/*********************************************************************
+ * @fn      osalTimerInit
+ *
+ * @brief   Initialization for the OSAL Timer System.
+ *
+ * @param   none
+ *
+ * @return
+ */
+void osalTimerInit( void )
+{
+  // Initialize the rollover modulo
+  osalTimerCtx.tmr_count = TICK_TIME;
+  osalTimerCtx.tmr_decr_time = TIMER_DECR_TIME;
+
+  // Initialize the system timer
+  osal_timer_activate( false );
+  osalTimerCtx.timerActive = false;
+
+  osalTimerCtx.systemClock = 0;
+}
+
+/*********************************************************************
+ * @fn      osalAddTimer
+ *
+ * @brief   Add a timer to the timer list.
+ *          Ints must be disabled.
+ *
+ * @param   task_id
+ * @param   event_flag
+ * @param   timeout
+ *
+ * @return  osalTimerRec_t * - pointer to newly created timer
+ */
+osalTimerRec_t * osalAddTimer( byte task_id, UINT16 event_flag, UINT16 timeout )
+{
+  osalTimerRec_t *newTimer;
+
+  // Look for an existing timer first
+  newTimer = osalFindTimer( task_id, event_flag );
+  if ( newTimer == NULL )
+  {
+    // New Timer
+    newTimer = osal_mem_alloc( sizeof( osalTimerRec_t ) );
+
+    if ( newTimer == NULL )
+      return ( (osalTimerRec_t *)NULL );
+
+    newTimer->flags = 0;
+  }
+
+  osalTimerArm( newTimer, task_id, event_flag, timeout );
+
+  return ( newTimer );
+}
+
+/*********************************************************************
+ * @fn      osalTimerArm
+ *
+ * @brief   Start a timer record, or move it to its new place if it is
+ *          already running. Ints must be disabled.
+ *
+ * @param   timer
+ * @param   task_id
+ * @param   event_flag
+ * @param   timeout
+ *
+ * @return  none
+ */
+static void osalTimerArm( osalTimerRec_t *timer, byte task_id, uint16 event_flag, uint16 timeout )
+{
+  if ( timer->flags & OSAL_TIMER_REC_ARMED )
+  {
+    // Timer is running - take it out of its old place.
+    osalTimerUnlink( timer );
+  }
+  else
+  {
+    // Fill in new timer
+    timer->task_id = task_id;
+    timer->event_flag = event_flag;
+    timer->flags |= OSAL_TIMER_REC_ARMED;
+    osalTimerHashAdd( timer );
+  }
+
+  // Add it to the timer list
+  osalTimerLink( timer, timeout );
+}
+
+/*********************************************************************
+ * @fn      osalTimerRelease
+ *
+ * @brief   Let go of a timer taken out of the timer list: free it, or
+ *          only mark it stopped if its storage is the caller's.
+ *          Ints must be disabled.
+ *
+ * @param   rmTimer
+ *
+ * @return  none
+ */
+static void osalTimerRelease( osalTimerRec_t *rmTimer )
+{
+  osalTimerHashRemove( rmTimer );
+
+  rmTimer->flags &= ~OSAL_TIMER_REC_ARMED;
+
+  // Deallocate the timer struct memory
+  if ( !(rmTimer->flags & OSAL_TIMER_REC_STATIC) )
+    osal_mem_free( rmTimer );
+}
+
+/*********************************************************************
+ * @fn      osalTimerExpire
+ *
+ * @brief   Handle a timer taken out at its deadline: start the next lap
+ *          of a long timer, or set the event and then restart a reload
+ *          timer or let it go. New timeouts are timed from the deadline.
+ *          Ints must be disabled.
+ *
+ * @param   srchTimer
+ *
+ * @return  TRUE if the event was set
+ */
+static byte osalTimerExpire( osalTimerRec_t *srchTimer )
+{
+  if ( srchTimer->laps )
+  {
+    // Not there yet
+    srchTimer->laps--;
+    osalTimerLink( srchTimer, OSAL_TIMER_LAP );
+    return ( FALSE );
+  }
+
+  osal_set_event( srchTimer->task_id, srchTimer->event_flag );
+
+  if ( srchTimer->reloadTimeout )
+  {
+    // Next period
+    osalTimerLink( srchTimer, srchTimer->reloadTimeout );
+  }
+  else
+  {
+    // Free memory
+    osalTimerRelease( srchTimer );
+  }
+
+  return ( TRUE );
+}
+
+#if ( OSAL_TIMER_WHEEL )
+/*********************************************************************
+ * @fn      osalTimerLink
+ *
+ * @brief   Insert a timer into the timer wheel. Ints must be disabled.
+ *
+ * @param   newTimer - timer not in the wheel
+ * @param   timeout - in milliseconds from now
+ *
+ * @return  none
+ */
+static void osalTimerLink( osalTimerRec_t *newTimer, uint16 timeout )
+{
+  newTimer->timeout = osalTimerCtx.wheelTime + timeout;
+
+  // A timer due now expires at the next tick, as in the timer list
+  osalWheelPlace( newTimer, (timeout != 0) ? timeout : 1 );
+}
+
+/*********************************************************************
+ * @fn      osalWheelPlace
+ *
+ * @brief   Put a timer in the wheel slot that is reached in 'delta'
+ *          ticks, at the lowest level that spans it.
+ *          Ints must be disabled.
+ *
+ * @param   newTimer - timer not in the wheel
+ * @param   delta - ticks from now, 0 for the current slot
+ *
+ * @return  none
+ */
+static void osalWheelPlace( osalTimerRec_t *newTimer, uint16 delta )
+{
+  void **slot;
+  uint16 when;
+  byte level;
+  byte shift;
+
+  when = osalTimerCtx.wheelTime + delta;
+
+  // Lowest level whose span holds the delta
+  level = 0;
+  shift = 0;
+  while ( (level < OSAL_WHEEL_LEVELS - 1) && (delta >> (shift + OSAL_WHEEL_BITS)) )
+  {
+    level++;
+    shift += OSAL_WHEEL_BITS;
+  }
+
+  slot = &osalTimerCtx.wheel[level][(when >> shift) & OSAL_WHEEL_MASK];
+
+  // Push it on the slot
+  newTimer->next = *slot;
+  if ( *slot )
+    ((osalTimerRec_t *)*slot)->pprev = &newTimer->next;
+  newTimer->pprev = slot;
+  *slot = newTimer;
+}
+
+/*********************************************************************
+ * @fn      osalTimerUnlink
+ *
+ * @brief   Take a timer out of the timer wheel, without freeing it.
+ *          Ints must be disabled.
+ *
+ * @param   rmTimer - timer in the wheel
+ *
+ * @return  none
+ */
+static void osalTimerUnlink( osalTimerRec_t *rmTimer )
+{
+  *rmTimer->pprev = rmTimer->next;
+  if ( rmTimer->next )
+    ((osalTimerRec_t *)rmTimer->next)->pprev = rmTimer->pprev;
+}
+
+/*********************************************************************
+ * @fn      osalWheelTick
+ *
+ * @brief   Advance the timer wheel by one tick: cascade the slots that
+ *          start now and expire the timers of the level 0 slot.
+ *          Ints must be disabled.
+ *
+ * @param   none
+ *
+ * @return  TRUE if the event of a timer was set
+ */
+static byte osalWheelTick( void )
+{
+  osalTimerRec_t *srchTimer;
+  osalTimerRec_t *saveTimer;
+  void **slot;
+  byte level;
+  byte shift;
+  byte expired;
+
+  osalTimerCtx.wheelTime++;
+
+  // Spread the timers of the higher slots that start now
+  shift = OSAL_WHEEL_BITS;
+  for ( level = 1; level < OSAL_WHEEL_LEVELS; level++ )
+  {
+    if ( osalTimerCtx.wheelTime & ((1 << shift) - 1) )
+      break;
+
+    slot = &osalTimerCtx.wheel[level][(osalTimerCtx.wheelTime >> shift) & OSAL_WHEEL_MASK];
+    srchTimer = *slot;
+    *slot = NULL;
+
+    while ( srchTimer )
+    {
+      saveTimer = srchTimer->next;
+      osalWheelPlace( srchTimer, srchTimer->timeout - osalTimerCtx.wheelTime );
+      srchTimer = saveTimer;
+    }
+
+    shift += OSAL_WHEEL_BITS;
+  }
+
+  // Expire the timers of the current slot
+  slot = &osalTimerCtx.wheel[0][osalTimerCtx.wheelTime & OSAL_WHEEL_MASK];
+  srchTimer = *slot;
+  *slot = NULL;
+
+  expired = FALSE;
+  while ( srchTimer )
+  {
+    saveTimer = srchTimer->next;
+
+    if ( osalTimerExpire( srchTimer ) )
+      expired = TRUE;
+
+    srchTimer = saveTimer;
+  }
+
+  return ( expired );
+}
+
+/*********************************************************************
+ * @fn      osalWheelNext
+ *
+ * @brief   Ticks to the first used slot of any level, the next tick at
+ *          which osalWheelTick() expires or cascades timers. The ticks
+ *          before it only turn the wheel. Ints must be disabled.
+ *
+ * @param   none
+ *
+ * @return  Ticks from now, 1 to OSAL_TIMERS_MAX_TIMEOUT; that maximum
+ *          if the wheel is empty.
+ */
+static uint16 osalWheelNext( void )
+{
+  uint32 nextTimeout;
+  uint32 slotTime;
+  uint16 idx;
+  byte level;
+  byte shift;
+  byte k;
+
+  nextTimeout = OSAL_TIMERS_MAX_TIMEOUT;
+
+  shift = 0;
+  for ( level = 0; level < OSAL_WHEEL_LEVELS; level++ )
+  {
+    idx = osalTimerCtx.wheelTime >> shift;
+
+    // First used slot after the current one
+    for ( k = 1; k <= OSAL_WHEEL_SLOTS; k++ )
+    {
+      if ( osalTimerCtx.wheel[level][(idx + k) & OSAL_WHEEL_MASK] )
+        break;
+    }
+
+    if ( k <= OSAL_WHEEL_SLOTS )
+    {
+      slotTime = (((uint32)idx + k) << shift) - osalTimerCtx.wheelTime;
+      if ( slotTime < nextTimeout )
+        nextTimeout = slotTime;
+    }
+
+    shift += OSAL_WHEEL_BITS;
+  }
+
+  return ( (uint16)nextTimeout );
+}
+
+#if ( OSAL_TICKLESS ) && !defined( POWER_SAVING )
+/*********************************************************************
+ * @fn      osalWheelDue
+ *
+ * @brief   Ticks to the next expiry, if it is before 'limit'. Unlike
+ *          osalWheelNext(), a slot that only cascades is not a reason
+ *          to wake up: the first used slot of each level that starts
+ *          before the limit is searched for its earliest timer.
+ *          Ints must be disabled.
+ *
+ * @param   limit - ticks from now
+ *
+ * @return  Ticks from now, 1 to 'limit'.
+ */
+static uint16 osalWheelDue( uint16 limit )
+{
+  osalTimerRec_t *srchTimer;
+  uint32 slotTime;
+  uint16 idx;
+  uint16 due;
+  byte level;
+  byte shift;
+  byte k;
+
+  shift = 0;
+  for ( level = 0; level < OSAL_WHEEL_LEVELS; level++ )
+  {
+    idx = osalTimerCtx.wheelTime >> shift;
+
+    for ( k = 1; k <= OSAL_WHEEL_SLOTS; k++ )
+    {
+      slotTime = (((uint32)idx + k) << shift) - osalTimerCtx.wheelTime;
+      if ( slotTime >= limit )
+        break;
+
+      srchTimer = osalTimerCtx.wheel[level][(idx + k) & OSAL_WHEEL_MASK];
+      if ( srchTimer == NULL )
+        continue;
+
+      // A level 0 slot expires all of its timers when it is reached
+      if ( level == 0 )
+      {
+        limit = (uint16)slotTime;
+        break;
+      }
+
+      // The timers of later slots of this level expire after these
+      for ( ; srchTimer; srchTimer = srchTimer->next )
+      {
+        due = srchTimer->timeout - osalTimerCtx.wheelTime;
+        if ( due < limit )
+          limit = due;
+      }
+      break;
+    }
+
+    shift += OSAL_WHEEL_BITS;
+  }
+
+  return ( limit );
+}
+#endif
+
+#else
+/*********************************************************************
+ * @fn      osalTimerLink
+ *
+ * @brief   Insert a timer into the timer list, after the timers that
+ *          expire at or before it. Ints must be disabled.
+ *
+ * @param   newTimer - timer not in the list
+ * @param   timeout - in milliseconds from now
+ *
+ * @return  none
+ */
+static void osalTimerLink( osalTimerRec_t *newTimer, uint16 timeout )
+{
+  osalTimerRec_t *prevTimer;
+  osalTimerRec_t *srchTimer;
+
+  prevTimer = (void *)NULL;
+  srchTimer = osalTimerCtx.timerHead;
+
+  // Skip the timers that expire first, making the timeout relative
+  while ( srchTimer && srchTimer->timeout <= timeout )
+  {
+    timeout -= srchTimer->timeout;
+    prevTimer = srchTimer;
+    srchTimer = srchTimer->next;
+  }
+
+  newTimer->timeout = timeout;
+  newTimer->next = srchTimer;
+
+  // The next timer now expires relative to this one
+  if ( srchTimer )
+  {
+    srchTimer->timeout -= timeout;
+    srchTimer->pprev = &newTimer->next;
+  }
+
+  if ( prevTimer == NULL )
+    newTimer->pprev = (void **)&osalTimerCtx.timerHead;
+  else
+    newTimer->pprev = &prevTimer->next;
+  *newTimer->pprev = newTimer;
+}
+
+/*********************************************************************
+ * @fn      osalTimerUnlink
+ *
+ * @brief   Take a timer out of the timer list, without freeing it.
+ *          Ints must be disabled.
+ *
+ * @param   rmTimer - timer in the list
+ *
+ * @return  none
+ */
+static void osalTimerUnlink( osalTimerRec_t *rmTimer )
+{
+  *rmTimer->pprev = rmTimer->next;
+
+  if ( rmTimer->next )
+  {
+    ((osalTimerRec_t *)rmTimer->next)->pprev = rmTimer->pprev;
+
+    // Give its time to the next timer
+    ((osalTimerRec_t *)rmTimer->next)->timeout += rmTimer->timeout;
+  }
+}
+
+#endif
+
+/*********************************************************************
+ * @fn      osalTimerHashAdd
+ *
+ * @brief   Add a new timer to its lookup bucket. Ints must be disabled.
+ *
+ * @param   newTimer
+ *
+ * @return  none
+ */
+static void osalTimerHashAdd( osalTimerRec_t *newTimer )
+{
+  void **bucket;
+
+  bucket = &osalTimerCtx.hash[OSAL_TIMER_HASH( newTimer->task_id, newTimer->event_flag )];
+  newTimer->hashNext = *bucket;
+  *bucket = newTimer;
+
+  if ( OSAL_TIMER_IN_BITMAP( newTimer->task_id, newTimer->event_flag ) )
+    osalTimerCtx.timerEvents[newTimer->task_id] |= newTimer->event_flag;
+
+  osalTimerCtx.timerCnt++;
+}
+
+/*********************************************************************
+ * @fn      osalTimerHashRemove
+ *
+ * @brief   Take a timer out of its lookup bucket. Ints must be disabled.
+ *
+ * @param   rmTimer
+ *
+ * @return  none
+ */
+static void osalTimerHashRemove( osalTimerRec_t *rmTimer )
+{
+  osalTimerRec_t *srchTimer;
+  void **bucket;
+
+  bucket = &osalTimerCtx.hash[OSAL_TIMER_HASH( rmTimer->task_id, rmTimer->event_flag )];
+  srchTimer = *bucket;
+
+  if ( srchTimer == rmTimer )
+  {
+    *bucket = rmTimer->hashNext;
+  }
+  else
+  {
+    // Stop when found or at the end
+    while ( srchTimer && srchTimer->hashNext != rmTimer )
+      srchTimer = srchTimer->hashNext;
+
+    // Not in the bucket
+    if ( srchTimer == NULL )
+      return;
+
+    srchTimer->hashNext = rmTimer->hashNext;
+  }
+
+  if ( OSAL_TIMER_IN_BITMAP( rmTimer->task_id, rmTimer->event_flag ) )
+    osalTimerCtx.timerEvents[rmTimer->task_id] &= ~rmTimer->event_flag;
+
+  osalTimerCtx.timerCnt--;
+}
+
+/*********************************************************************
+ * @fn      osalFindTimer
+ *
+ * @brief   Find a timer in the lookup buckets.
+ *          Ints must be disabled.
+ *
+ * @param   task_id
+ * @param   event_flag
+ *
+ * @return  osalTimerRec_t *
+ */
+osalTimerRec_t *osalFindTimer( byte task_id, uint16 event_flag )
+{
+  osalTimerRec_t *srchTimer;
+
+  // Not running: no need to search
+  if ( OSAL_TIMER_IN_BITMAP( task_id, event_flag ) &&
+       !(osalTimerCtx.timerEvents[task_id] & event_flag) )
+    return ( (osalTimerRec_t *)NULL );
+
+  // Head of the lookup bucket
+  srchTimer = osalTimerCtx.hash[OSAL_TIMER_HASH( task_id, event_flag )];
+
+  // Stop when found or at the end
+  while ( srchTimer )
+  {
+    if ( srchTimer->event_flag == event_flag &&
+         srchTimer->task_id == task_id )
+      break;
+
+    // Not this one, check another
+    srchTimer = srchTimer->hashNext;
+  }
+
+  return ( srchTimer );
+}
+
+/*********************************************************************
+ * @fn      osalDeleteTimer
+ *
+ * @brief   Delete a timer from a timer list. A timer in caller
+ *          storage is only stopped. Ints must be disabled.
+ *
+ * @param   table
+ * @param   rmTimer
+ *
+ * @return  none
+ */
+void osalDeleteTimer( osalTimerRec_t *rmTimer )
+{
+  // Is the timer really running
+  if ( rmTimer && (rmTimer->flags & OSAL_TIMER_REC_ARMED) )
+  {
+    osalTimerUnlink( rmTimer );
+    osalTimerRelease( rmTimer );
+  }
+}
+
+/*********************************************************************
+ * @fn      osal_start_timer
+ *
+ * @brief
+ *
+ *   This function is called to start a timer to expire in n mSecs.
+ *   When the timer expires, the calling task will get the specified event.
+ *
+ * @param   UINT16 event_id - event to be notified with
+ * @param   UNINT16 timeout_value - in milliseconds.
+ *
+ * @return  ZSUCCESS, NO_TIMER_AVAIL, INVALID_EVENT_ID or INVALID_TIMEOUT_VALUE
+ */
+byte osal_start_timer( UINT16 event_id, UINT16 timeout_value )
+{
+  return osal_start_timerEx( osal_self(), event_id, timeout_value );
+}
+
+/*********************************************************************
+ * @fn      osal_start_timerEx
+ *
+ * @brief
+ *
+ *   This function is called to start a timer to expire in n mSecs.
+ *   When the timer expires, the calling task will get the specified event.
+ *
+ * @param   byte taskID - task id to set timer for
+ * @param   UINT16 event_id - event to be notified with
+ * @param   UNINT16 timeout_value - in milliseconds.
+ *
+ * @return  ZSUCCESS, or NO_TIMER_AVAIL.
+ */
+byte osal_start_timerEx( byte taskID, UINT16 event_id, UINT16 timeout_value )
+{
+  return osalStartTimer( taskID, event_id, timeout_value, 0, FALSE );
+}
+
+/*********************************************************************
+ * @fn      osal_start_reload_timerEx
+ *
+ * @brief
+ *
+ *   This function is called to start a timer that expires every n mSecs
+ *   until it is stopped. Each expiry is timed from the previous deadline,
+ *   not from when the event is processed, so the period does not drift.
+ *   The timer record is allocated once and kept while the timer runs.
+ *
+ * @param   byte taskID - task id to set timer for
+ * @param   UINT16 event_id - event to be notified with
+ * @param   UNINT16 timeout_value - period in milliseconds.
+ *
+ * @return  ZSUCCESS, or NO_TIMER_AVAIL.
+ */
+byte osal_start_reload_timerEx( byte taskID, UINT16 event_id, UINT16 timeout_value )
+{
+  return osalStartTimer( taskID, event_id, timeout_value, timeout_value, FALSE );
+}
+
+/*********************************************************************
+ * @fn      osal_start_timer_at
+ *
+ * @brief
+ *
+ *   This function is called to start a timer that expires when the
+ *   osal_GetSystemClock() time reaches the deadline. The deadline can
+ *   be more than OSAL_TIMERS_MAX_TIMEOUT mSecs away, and the clock can
+ *   wrap before it: a deadline up to 2^31 mSecs after the clock is in
+ *   the future, one up to 2^31 mSecs before it expires at once. Times
+ *   derived from one another, such as "period after the last deadline",
+ *   do not drift.
+ *
+ * @param   byte taskID - task id to set timer for
+ * @param   UINT16 event_id - event to be notified with
+ * @param   uint32 deadline - system clock time, in milliseconds
+ *
+ * @return  ZSUCCESS, or NO_TIMER_AVAIL.
+ */
+byte osal_start_timer_at( byte taskID, UINT16 event_id, uint32 deadline )
+{
+  return osalStartTimer( taskID, event_id, deadline, 0, TRUE );
+}
+
+/*********************************************************************
+ * @fn      osalStartTimer
+ *
+ * @brief   Start a timer allocated from the heap.
+ *
+ * @param   taskID
+ * @param   event_id
+ * @param   timeout_value - in milliseconds, or the system clock
+ *                          deadline if absolute
+ * @param   reload - period in milliseconds, 0 for a one-shot timer
+ * @param   absolute - TRUE if timeout_value is a deadline
+ *
+ * @return  ZSUCCESS, or NO_TIMER_AVAIL.
+ */
+static byte osalStartTimer( byte taskID, UINT16 event_id, uint32 timeout_value,
+                            UINT16 reload, byte absolute )
+{
+  halIntState_t intState;
+  osalTimerRec_t *newTimer;
+  uint16 laps;
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+#if ( OSAL_TICKLESS )
+  // Time the new timer from now
+  osalTimerElapse();
+#endif
+
+  if ( absolute )
+  {
+    // Time to the deadline; one behind the clock is due now
+    timeout_value -= osalTimerCtx.systemClock;
+    if ( (int32)timeout_value < 0 )
+      timeout_value = 0;
+  }
+
+  // Run a long timeout in laps, the first one at most OSAL_TIMER_LAP
+  laps = 0;
+  if ( timeout_value > OSAL_TIMERS_MAX_TIMEOUT )
+  {
+    laps = (uint16)((timeout_value - 1) >> OSAL_TIMER_LAP_BITS);
+    timeout_value -= (uint32)laps << OSAL_TIMER_LAP_BITS;
+  }
+
+  // Add timer
+  newTimer = osalAddTimer( taskID, event_id, (uint16)timeout_value );
+  if ( newTimer )
+  {
+    newTimer->laps = laps;
+    newTimer->reloadTimeout = reload;
+#if defined( POWER_SAVING )
+    newTimer->slack = 0;
+#endif
+    osalTimerStarted();
+  }
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+
+  return ( (newTimer != NULL) ? ZSUCCESS : NO_TIMER_AVAIL );
+}
+
+/*********************************************************************
+ * @fn      osal_start_timerRec
+ *
+ * @brief
+ *
+ *   This function is called to start a timer kept in storage owned by
+ *   the caller. It works like osal_start_timerEx, but the timer record
+ *   is never allocated nor freed. The storage must be zeroed before its
+ *   first use and stay valid while the timer runs.
+ *
+ * @param   osalTimerRec_t *timer - timer storage
+ * @param   byte taskID - task id to set timer for
+ * @param   UINT16 event_id - event to be notified with
+ * @param   UNINT16 timeout_value - in milliseconds.
+ *
+ * @return  ZSUCCESS
+ */
+byte osal_start_timerRec( osalTimerRec_t *timer, byte taskID, UINT16 event_id, UINT16 timeout_value )
+{
+  return osalStartTimerRec( timer, taskID, event_id, timeout_value, 0 );
+}
+
+/*********************************************************************
+ * @fn      osal_start_reload_timerRec
+ *
+ * @brief
+ *
+ *   This function is called to start a reload timer, as with
+ *   osal_start_reload_timerEx, kept in storage owned by the caller as
+ *   with osal_start_timerRec.
+ *
+ * @param   osalTimerRec_t *timer - timer storage
+ * @param   byte taskID - task id to set timer for
+ * @param   UINT16 event_id - event to be notified with
+ * @param   UNINT16 timeout_value - period in milliseconds.
+ *
+ * @return  ZSUCCESS
+ */
+byte osal_start_reload_timerRec( osalTimerRec_t *timer, byte taskID, UINT16 event_id, UINT16 timeout_value )
+{
+  return osalStartTimerRec( timer, taskID, event_id, timeout_value, timeout_value );
+}
+
+/*********************************************************************
+ * @fn      osalStartTimerRec
+ *
+ * @brief   Start a timer kept in caller storage.
+ *
+ * @param   timer
+ * @param   taskID
+ * @param   event_id
+ * @param   timeout_value - in milliseconds
+ * @param   reload - period in milliseconds, 0 for a one-shot timer
+ *
+ * @return  ZSUCCESS
+ */
+static byte osalStartTimerRec( osalTimerRec_t *timer, byte taskID, UINT16 event_id,
+                               UINT16 timeout_value, UINT16 reload )
+{
+  halIntState_t intState;
+  osalTimerRec_t *oldTimer;
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+#if ( OSAL_TICKLESS )
+  // Time the timer from now
+  osalTimerElapse();
+#endif
+
+  // Running for another event?
+  if ( timer->task_id != taskID || timer->event_flag != event_id )
+    osalDeleteTimer( timer );
+
+  // Only one timer per event: replace a timer started by osal_start_timerEx
+  oldTimer = osalFindTimer( taskID, event_id );
+  if ( oldTimer != timer )
+    osalDeleteTimer( oldTimer );
+
+  timer->flags |= OSAL_TIMER_REC_STATIC;
+  timer->laps = 0;
+  timer->reloadTimeout = reload;
+#if defined( POWER_SAVING )
+  timer->slack = 0;
+#endif
+  osalTimerArm( timer, taskID, event_id, timeout_value );
+  osalTimerStarted();
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+
+  return ( ZSUCCESS );
+}
+
+/*********************************************************************
+ * @fn      osalTimerStarted
+ *
+ * @brief   Update the timer hardware after a timer has been started.
+ *          Ints must be disabled.
+ *
+ * @param   none
+ *
+ * @return  none
+ */
+static void osalTimerStarted( void )
+{
+#if defined( POWER_SAVING ) || ( OSAL_TICKLESS )
+  // Update timer registers
+  osal_retune_timers();
+#endif
+
+  // Does the timer need to be started?
+  if ( osalTimerCtx.timerActive == FALSE )
+  {
+    osal_timer_activate( TRUE );
+  }
+}
+
+/*********************************************************************
+ * @fn      osal_stop_timer
+ *
+ * @brief
+ *
+ *   This function is called to stop a timer that has already been started.
+ *   If ZSUCCESS, the function will cancel the timer and prevent the event
+ *   associated with the timer from being set for the calling task.
+ *
+ * @param   UINT16 event_id - identifier of the timer that is to be stopped
+ *
+ * @return  ZSUCCESS or INVALID_EVENT_ID
+ */
+byte osal_stop_timer( UINT16 event_id )
+{
+  return osal_stop_timerEx( osal_self(), event_id );
+}
+
+/*********************************************************************
+ * @fn      osal_stop_timerEx
+ *
+ * @brief
+ *
+ *   This function is called to stop a timer that has already been started.
+ *   If ZSUCCESS, the function will cancel the timer and prevent the event
+ *   associated with the timer from being set for the calling task.
+ *
+ * @param   byte task_id - task id of timer to stop
+ * @param   UINT16 event_id - identifier of the timer that is to be stopped
+ *
+ * @return  ZSUCCESS or INVALID_EVENT_ID
+ */
+byte osal_stop_timerEx( byte task_id, UINT16 event_id )
+{
+  halIntState_t intState;
+  osalTimerRec_t *foundTimer;
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+#if ( OSAL_TICKLESS )
+  osalTimerElapse();
+#endif
+
+  // Find the timer to stop
+  foundTimer = osalFindTimer( task_id, event_id );
+  if ( foundTimer )
+  {
+    osalDeleteTimer( foundTimer );
+
+#if defined( POWER_SAVING ) || ( OSAL_TICKLESS )
+    osal_retune_timers();
+#endif
+  }
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+
+  return ( (foundTimer != NULL) ? ZSUCCESS : INVALID_EVENT_ID );
+}
+
+/*********************************************************************
+ * @fn      osal_stop_timerRec
+ *
+ * @brief
+ *
+ *   This function is called to stop a timer started with
+ *   osal_start_timerRec. The storage can be reused or released when it
+ *   returns.
+ *
+ * @param   osalTimerRec_t *timer - timer storage
+ *
+ * @return  ZSUCCESS or INVALID_EVENT_ID if it was not running
+ */
+byte osal_stop_timerRec( osalTimerRec_t *timer )
+{
+  halIntState_t intState;
+  byte armed;
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+#if ( OSAL_TICKLESS )
+  osalTimerElapse();
+#endif
+
+  armed = timer->flags & OSAL_TIMER_REC_ARMED;
+  if ( armed )
+  {
+    osalDeleteTimer( timer );
+
+#if defined( POWER_SAVING ) || ( OSAL_TICKLESS )
+    osal_retune_timers();
+#endif
+  }
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+
+  return ( armed ? ZSUCCESS : INVALID_EVENT_ID );
+}
+
+/*********************************************************************
+ * @fn      osal_timer_slack
+ *
+ * @brief
+ *
+ *   This function is called to let a running timer expire up to slack
+ *   mSecs late, so that with POWER_SAVING its expiry can share a wakeup
+ *   with another timer. The slack holds for every period of a reload
+ *   timer and is cleared when the timer is started again. Without
+ *   POWER_SAVING the timer still expires on time.
+ *
+ * @param   byte task_id - task id of the timer
+ * @param   UINT16 event_id - identifier of the timer
+ * @param   UINT16 slack - in milliseconds
+ *
+ * @return  ZSUCCESS or INVALID_EVENT_ID
+ */
+byte osal_timer_slack( byte task_id, UINT16 event_id, UINT16 slack )
+{
+  halIntState_t intState;
+  osalTimerRec_t *foundTimer;
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+  foundTimer = osalFindTimer( task_id, event_id );
+#if defined( POWER_SAVING )
+  if ( foundTimer )
+  {
+    foundTimer->slack = slack;
+    osal_retune_timers();
+  }
+#endif
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+
+  return ( (foundTimer != NULL) ? ZSUCCESS : INVALID_EVENT_ID );
+}
+
+/*********************************************************************
+ * @fn      osal_get_timeoutEx
+ *
+ * @brief
+ *
+ * @param   byte task_id - task id of timer to check
+ * @param   UINT16 event_id - identifier of timer to be checked
+ *
+ * @return  Return the timer's tick count if found, zero otherwise.
+ */
+UINT16 osal_get_timeoutEx( byte task_id, UINT16 event_id )
+{
+  halIntState_t intState;
+  uint16 rtrn = 0;
+  uint32 left;
+  osalTimerRec_t *tmr;
+#if !( OSAL_TIMER_WHEEL )
+  osalTimerRec_t *srchTimer;
+#endif
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+#if ( OSAL_TICKLESS )
+  osalTimerElapse();
+#endif
+
+  tmr = osalFindTimer( task_id, event_id );
+  if ( tmr )
+  {
+#if ( OSAL_TIMER_WHEEL )
+    left = (uint16)(tmr->timeout - osalTimerCtx.wheelTime);
+#else
+    // Add up the deltas of the timers up to it
+    srchTimer = tmr;
+    left = srchTimer->timeout;
+    while ( srchTimer->pprev != (void **)&osalTimerCtx.timerHead )
+    {
+      srchTimer = (osalTimerRec_t *)srchTimer->pprev;   // 'next' is the first field
+      left += srchTimer->timeout;
+    }
+#endif
+
+    // Then the laps of a long timer, up to the largest timeout
+    left += (uint32)tmr->laps << OSAL_TIMER_LAP_BITS;
+    rtrn = ( left > OSAL_TIMERS_MAX_TIMEOUT ) ? OSAL_TIMERS_MAX_TIMEOUT : (uint16)left;
+  }
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+
+  return ( (tmr != NULL) ? rtrn : 0 );
+}
+
+/*********************************************************************
+ * @fn      osal_timer_activate
+ *
+ * @brief
+ *
+ *   Turns the hardware timer on or off
+ *
+ * @param  byte turn_on - false - turn off, true - turn on
+ *
+ * @return  none
+ */
+void osal_timer_activate( byte turn_on )
+{
+  osal_timer_hw_setup( turn_on );
+  osalTimerCtx.timerActive = turn_on;
+
+#if ( OSAL_TICKLESS )
+  if ( turn_on )
+  {
+    // Count the ticks from here
+    osalTimerCtx.tmrHwCount = HalTimerCount( OSAL_TIMER );
+    osalTimerSetCompare();
+  }
+#endif
+}
+
+/*********************************************************************
+ * @fn      osal_timer_num_active
+ *
+ * @brief
+ *
+ *   This function counts the number of active timers. It returns a
+ *   uint16, not a byte: timers kept in caller storage are not bounded
+ *   by the heap, and a count of 256 must not read as none.
+ *
+ * @return  uint16 - number of timers
+ */
+uint16 osal_timer_num_active( void )
+{
+  return osalTimerCtx.timerCnt;
+}
+
+/*********************************************************************
+ * @fn      osal_timer_hw_setup
+ *
+ * @brief
+ *
+ *   Setup the timer hardware.
+ *
+ * @param  byte turn_on
+ *
+ * @return  void
+ */
+void osal_timer_hw_setup( byte turn_on )
+{
+  if (turn_on)
+  {
+    HalTimerStart (OSAL_TIMER, osalTimerCtx.tmr_count );
+  }
+  else
+  {
+    HalTimerStop (OSAL_TIMER);
+  }
+}
+
+#if defined( POWER_SAVING )
+/*********************************************************************
+ * @fn      osal_sleep_timers
+ *
+ * @brief
+ *
+ *   This function will enable interrupts if timers are running.
+ *
+ * @param  none
+ *
+ * @return  none
+ */
+void osal_sleep_timers( void )
+{
+#ifndef TIMER_INT
+  if ( osal_timer_num_active() )
+    osal_set_timer_interrupt( TRUE );
+#endif
+}
+
+/*********************************************************************
+ * @fn      osal_unsleep_timers
+ *
+ * @brief
+ *
+ *   This function will disable interrupts if timers are running.
+ *
+ * @param  none
+ *
+ * @return  none
+ */
+void osal_unsleep_timers( void )
+{
+#ifndef TIMER_INT
+  osal_set_timer_interrupt( FALSE );
+#endif
+}
+#endif
+
+/*********************************************************************
+ * @fn      osal_set_timer_interrupt
+ *
+ * @brief
+ *
+ *   Setup the timer hardware interrupt.
+ *
+ * @param  byte turn_on
+ *
+ * @return  void
+ *********************************************************************/
+void osal_set_timer_interrupt( byte turn_on )
+{
+  // Enable or disable timer interrupts
+  HalTimerInterruptEnable ( OSAL_TIMER, HAL_TIMER_CH_MODE_OUTPUT_COMPARE, turn_on);
+}
+
+/*********************************************************************
+ * @fn      osalTimerUpdate
+ *
+ * @brief   Update the timer structures for a timer tick.
+ *
+ * @param   none
+ *
+ * @return  none
+ *********************************************************************/
+static void osalTimerUpdate( uint16 updateTime )
+{
+  halIntState_t intState;
+#if ( OSAL_TIMER_WHEEL )
+  uint16 skip;
+#else
+  osalTimerRec_t *srchTimer;
+#endif
+#if defined( POWER_SAVING )
+  byte expired = FALSE;
+#if !( OSAL_TIMER_WHEEL )
+  uint16 expiredAt = 0;
+#endif
+#endif
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+  // Update the system time
+  osalTimerCtx.systemClock += updateTime;
+
+#if ( OSAL_TIMER_WHEEL )
+  // Turn the wheel while it holds timers. An update of more than one
+  // tick jumps to the next slot that expires or cascades, so a long
+  // update takes a step per used slot, not per tick.
+  while ( updateTime && OSAL_TIMERS_ARMED() )
+  {
+    skip = ( updateTime > 1 ) ? osalWheelNext() : 1;
+    if ( skip > updateTime )
+      break;
+
+    osalTimerCtx.wheelTime += skip - 1;
+    updateTime -= skip;
+
+#if defined( POWER_SAVING )
+    if ( osalWheelTick() )
+    {
+      // A later tick that expires timers shares this update
+      if ( expired )
+        osalTimerCtx.wakeupsAvoided++;
+      expired = TRUE;
+    }
+#else
+    osalWheelTick();
+#endif
+  }
+  osalTimerCtx.wheelTime += updateTime;
+#else
+  // Look for open timer slot
+  if ( osalTimerCtx.timerHead != NULL )
+  {
+    // Expire the timers at the head of the list
+    while ( osalTimerCtx.timerHead != NULL &&
+            osalTimerCtx.timerHead->timeout <= updateTime )
+    {
+      srchTimer = osalTimerCtx.timerHead;
+      updateTime -= srchTimer->timeout;
+
+      // Take out of list
+      osalTimerCtx.timerHead = srchTimer->next;
+      if ( osalTimerCtx.timerHead != NULL )
+        osalTimerCtx.timerHead->pprev = (void **)&osalTimerCtx.timerHead;
+
+      // The rest of the list is now relative to this deadline
+#if defined( POWER_SAVING )
+      if ( osalTimerExpire( srchTimer ) )
+      {
+        // A later expiry than the previous one shares this update
+        if ( expired && (updateTime != expiredAt) )
+          osalTimerCtx.wakeupsAvoided++;
+        expired = TRUE;
+        expiredAt = updateTime;
+      }
+#else
+      osalTimerExpire( srchTimer );
+#endif
+    }
+
+    // The rest of the list is relative to the head
+    if ( osalTimerCtx.timerHead != NULL )
+      osalTimerCtx.timerHead->timeout -= updateTime;
+  }
+#endif
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+}
+
+/*********************************************************************
+ * @fn      osal_update_timers
+ *
+ * @brief   Update the timer structures for timer ticks.
+ *
+ * @param   none
+ *
+ * @return  none
+ */
+void osal_update_timers( void )
+{
+#if ( OSAL_TICKLESS )
+  halIntState_t intState;
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+  osalTimerElapse();
+  osalTimerSetCompare();
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+#else
+  osalTimerUpdate( osalTimerCtx.tmr_decr_time );
+#endif
+}
+
+#if ( OSAL_TICKLESS )
+/*********************************************************************
+ * @fn      osalTimerElapse
+ *
+ * @brief   Update the timer structures for the whole ticks counted by
+ *          OSAL_TIMER since the last update. Ints must be disabled.
+ *
+ * @param   none
+ *
+ * @return  none
+ */
+static void osalTimerElapse( void )
+{
+  uint16 ticks;
+
+  if ( osalTimerCtx.timerActive )
+  {
+    ticks = (uint16)(HalTimerCount( OSAL_TIMER ) - osalTimerCtx.tmrHwCount) / TICK_HW_COUNT;
+
+    if ( ticks )
+    {
+      osalTimerCtx.tmrHwCount += ticks * TICK_HW_COUNT;
+      osalTimerUpdate( ticks );
+    }
+  }
+}
+
+/*********************************************************************
+ * @fn      osalTimerSetCompare
+ *
+ * @brief   Set the OSAL_TIMER compare to the next timeout, or to
+ *          TICK_HW_MAX ticks so that the count does not wrap unseen.
+ *          Ints must be disabled.
+ *
+ * @param   none
+ *
+ * @return  none
+ */
+static void osalTimerSetCompare( void )
+{
+  uint16 due;
+
+  while ( osalTimerCtx.timerActive )
+  {
+#if ( OSAL_TIMER_WHEEL ) && !defined( POWER_SAVING )
+    due = osalWheelDue( TICK_HW_MAX );
+#else
+    due = osal_next_timeout();
+#endif
+
+    if ( !OSAL_TIMERS_ARMED() || (due > TICK_HW_MAX) )
+      due = TICK_HW_MAX;
+    else if ( due == 0 )
+      due = 1;
+
+    due *= TICK_HW_COUNT;
+    HalTimerCompare( OSAL_TIMER, osalTimerCtx.tmrHwCount + due );
+
+    // Done, unless the count went past the compare before it was set
+    if ( (uint16)(HalTimerCount( OSAL_TIMER ) - osalTimerCtx.tmrHwCount) < due )
+      break;
+
+    osalTimerElapse();
+  }
+}
+#endif
+
+#ifdef POWER_SAVING
+/*********************************************************************
+ * @fn      osal_adjust_timers
+ *
+ * @brief   Update the timer structures for elapsed ticks.
+ *
+ * @param   none
+ *
+ * @return  none
+ *********************************************************************/
+void osal_adjust_timers( void )
+{
+  uint16 eTime;
+
+  if ( OSAL_TIMERS_ARMED() )
+  {
+    // Compute elapsed time (msec)
+    eTime = TimerElapsed() /  TICK_COUNT;
+
+    if ( eTime )
+      osalTimerUpdate( eTime );
+
+#if ( OSAL_TICKLESS )
+    osal_retune_timers();
+#endif
+  }
+}
+#endif
+
+#if defined( POWER_SAVING ) || ( OSAL_TICKLESS )
+#if defined( POWER_SAVING ) && !( OSAL_TICKLESS ) && ( RETUNE_THRESHOLD != 1 )
+  // The tick does not retune after it expires timers, so it must stay 1 ms
+  #error "RETUNE_THRESHOLD must be 1"
+#endif
+
+/*********************************************************************
+ * @fn      osalTimerNext
+ *
+ * @brief   Return the time to the lowest timeout, the one of the head
+ *          of the timer list, or with the timer wheel the time to the
+ *          first slot to expire or cascade. Zero if no timers.
+ *
+ * @param   none
+ *
+ * @return  mSecs
+ */
+static uint16 osalTimerNext( void )
+{
+#if ( OSAL_TIMER_WHEEL )
+  if ( !OSAL_TIMERS_ARMED() )
+    return ( 0 );
+
+  return ( osalWheelNext() );
+#else
+  if ( osalTimerCtx.timerHead != NULL )
+    return ( osalTimerCtx.timerHead->timeout );
+
+  // No timers
+  return ( 0 );
+#endif
+}
+
+/*********************************************************************
+ * @fn      osal_retune_timers
+ *
+ * @brief
+ *
+ *   Adjust CPU sleep time to the lowest timeout value. If the timeout
+ *   value is more then RETUNE_THRESHOLD, then the sleep time will be
+ *   RETUNE_THRESHOLD. With OSAL_TICKLESS, set the OSAL_TIMER compare
+ *   to the lowest timeout value instead.
+ *
+ * @param   none
+ *
+ * @return  none
+ *********************************************************************/
+void osal_retune_timers( void )
+{
+  halIntState_t intState;
+#if !( OSAL_TICKLESS )
+  uint16 nextTimeout;
+#endif
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+#if ( OSAL_TICKLESS )
+  // Wake up at the next timeout
+  osalTimerSetCompare();
+#else
+  // Next occuring timeout; the slack only matters to the sleep
+  nextTimeout = osalTimerNext();
+
+  // Make sure timer counter can handle it
+  if ( !nextTimeout || (nextTimeout > RETUNE_THRESHOLD) )
+    nextTimeout = RETUNE_THRESHOLD;
+
+  if (nextTimeout != osalTimerCtx.tmr_decr_time)
+  {
+    // Stop the clock
+    osal_timer_activate( FALSE );
+
+    // Alter the rolling time
+    osalTimerCtx.tmr_decr_time = nextTimeout;
+    osalTimerCtx.tmr_count = (uint32)nextTimeout * TICK_TIME;
+
+    // Restart the clock
+    osal_timer_activate( TRUE );
+  }
+#endif
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+}
+
+/*********************************************************************
+ * @fn      osal_next_timeout
+ *
+ * @brief
+ *
+ *   Return the lowest timeout value, the one of the head of the
+ *   timer list. If the timer list is empty, then the returned timeout
+ *   will be zero. With the timer wheel, it is the time to the first
+ *   slot to expire or cascade, which is never after the lowest timeout.
+ *
+ *   With POWER_SAVING, return the lowest timeout plus slack of all the
+ *   timers instead: waking up then expires every timer due by then,
+ *   and none of them later than its slack allows. This walks the
+ *   timers, so it is left to the sleep and is not used by the tick.
+ *
+ * @param   none
+ *
+ * @return  none
+ *********************************************************************/
+uint16 osal_next_timeout( void )
+{
+#if defined( POWER_SAVING )
+  osalTimerRec_t *srchTimer;
+  uint32 wakeup;
+  uint32 due;
+#if ( OSAL_TIMER_WHEEL )
+  byte idx;
+#endif
+
+  if ( !OSAL_TIMERS_ARMED() )
+    return ( 0 );
+
+  wakeup = OSAL_TIMERS_MAX_TIMEOUT;
+
+#if ( OSAL_TIMER_WHEEL )
+  // Every timer is in a lookup bucket
+  for ( idx = 0; idx < OSAL_TIMER_HASH_CNT; idx++ )
+  {
+    for ( srchTimer = osalTimerCtx.hash[idx]; srchTimer; srchTimer = srchTimer->hashNext )
+    {
+      due = (uint16)(srchTimer->timeout - osalTimerCtx.wheelTime);
+      if ( due + srchTimer->slack < wakeup )
+        wakeup = due + srchTimer->slack;
+    }
+  }
+#else
+  // The list is sorted: no timer past the wakeup can bring it forward
+  due = 0;
+  for ( srchTimer = osalTimerCtx.timerHead; srchTimer; srchTimer = srchTimer->next )
+  {
+    due += srchTimer->timeout;
+    if ( due >= wakeup )
+      break;
+
+    if ( due + srchTimer->slack < wakeup )
+      wakeup = due + srchTimer->slack;
+  }
+#endif
+
+  // Zero is for no timers
+  return ( (wakeup != 0) ? (uint16)wakeup : 1 );
+#else
+  return ( osalTimerNext() );
+#endif
+}
+#endif // POWER_SAVING || OSAL_TICKLESS
+
+#if defined( POWER_SAVING )
+/*********************************************************************
+ * @fn      osal_timer_wakeups_avoided
+ *
+ * @brief
+ *
+ *   Return the number of timer expiries that were done in the update
+ *   of an earlier expiry, such as after a sleep that was stretched by
+ *   osal_timer_slack(), instead of waking up for them on their own.
+ *
+ * @param   none
+ *
+ * @return  count, wrapping at 65535
+ *********************************************************************/
+uint16 osal_timer_wakeups_avoided( void )
+{
+  return ( osalTimerCtx.wakeupsAvoided );
+}
+#endif
+
+/*********************************************************************
+ * @fn      osal_GetSystemClock()
+ *
+ * @brief   Read the local system clock.
+ *
+ * @param   none
+ *
+ * @return  local clock in milliseconds
+ */
+uint32 osal_GetSystemClock( void )
+{
+#if ( OSAL_TICKLESS )
+  halIntState_t intState;
+  uint32 clock;
+
+  HAL_ENTER_CRITICAL_SECTION( intState );  // Hold off interrupts.
+
+  // Add the whole ticks counted since the last update
+  clock = osalTimerCtx.systemClock;
+  if ( osalTimerCtx.timerActive )
+    clock += (uint16)(HalTimerCount( OSAL_TIMER ) - osalTimerCtx.tmrHwCount) / TICK_HW_COUNT;
+
+  HAL_EXIT_CRITICAL_SECTION( intState );   // Re-enable interrupts.
+
+  return ( clock );
+#else
+  return ( osalTimerCtx.systemClock );
+#endif
+}
+
+#if ( OSAL_MULTI_INSTANCE )
+/*********************************************************************
+ * @fn      osalTimerCtxNew
+ *
+ * @brief   Allocate the zeroed timer state of a new OSAL instance.
+ *
+ * @param   none
+ *
+ * @return  The new state, NULL if out of host memory.
+ */
+void *osalTimerCtxNew( void )
+{
+  return calloc( 1, sizeof( osalTimerCtx_t ) );
+}
+
+/*********************************************************************
+ * @fn      osalTimerCtxUse
+ *
+ * @brief   Make the timer state of an OSAL instance the current one.
+ *
+ * @param   ctx - State from osalTimerCtxNew().
+ *
+ * @return  none
+ */
+void osalTimerCtxUse( void *ctx )
+{
+  osalTimerCur = (osalTimerCtx_t *)ctx;
+}
+#endif
+
+/*********************************************************************
+*********************************************************************/
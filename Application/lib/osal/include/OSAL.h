@@ -1,248 +1,412 @@
-#ifndef OSAL_H
-#define OSAL_H
-
-/*********************************************************************
-    Filename:       OSAL.h
-    Revised:        $Date: 2006-09-29 18:09:20 -0700 (Fri, 29 Sep 2006) $
-    Revision:       $Revision: 12162 $
-
-    Description:
-
-       This API allows the software components in the Z-stack to be
-       written independently of the specifics of the operating system,
-       kernel or tasking environment (including control loops or
-       connect-to-interrupt systems).
-
-    Notes:
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-/*********************************************************************
- * INCLUDES
- */
-#include "ZComDef.h"
-#include "OSAL_Memory.h"
-#include "OSAL_Timers.h"
-
-/*********************************************************************
- * MACROS
- */
-
-#define osal_offsetof(type, member) ((uint16) &(((type *) 0)->member))
-
-#define OSAL_MSG_NEXT(msg_ptr)      ((osal_msg_hdr_t *) (msg_ptr) - 1)->next
-
-#define OSAL_MSG_Q_INIT(q_ptr)      *(q_ptr) = NULL
-
-#define OSAL_MSG_Q_EMPTY(q_ptr)     (*(q_ptr) == NULL)
-
-#define OSAL_MSG_Q_HEAD(q_ptr)      (*(q_ptr))
-
-/*********************************************************************
- * CONSTANTS
- */
-
-/*** Interrupts ***/
-#define INTS_ALL    0xFF
-
-
-/*********************************************************************
- * TYPEDEFS
- */
-typedef struct
-{
-  void   *next;
-  uint16 len;
-  byte   dest_id;
-} osal_msg_hdr_t;
-
-typedef struct
-{
-  uint8  event;
-  uint8  status;
-} osal_event_hdr_t;
-
-typedef void * osal_msg_q_t;
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
-
-/*********************************************************************
- * FUNCTIONS
- */
-
-/*** Message Management ***/
-
-  /*
-   * Task Message Allocation
-   */
-  extern byte * osal_msg_allocate(uint16 len );
-
-  /*
-   * Task Message Deallocation
-   */
-  extern byte osal_msg_deallocate( byte *msg_ptr );
-
-  /*
-   * Task Messages Count
-   */
-  extern UINT16 osal_num_msgs( void );
-
-  /*
-   * Send a Task Message
-   */
-  extern byte osal_msg_send( byte destination_task, byte *msg_ptr );
-
-  /*
-   * Receive a Task Message
-   */
-  extern byte *osal_msg_receive( byte task_id );
-
-
-  /*
-   * Enqueue a Task Message
-   */
-  extern void osal_msg_enqueue( osal_msg_q_t *q_ptr, void *msg_ptr );
-
-  /*
-   * Enqueue a Task Message Up to Max
-   */
-  extern byte osal_msg_enqueue_max( osal_msg_q_t *q_ptr, void *msg_ptr, byte max );
-
-  /*
-   * Dequeue a Task Message
-   */
-  extern void *osal_msg_dequeue( osal_msg_q_t *q_ptr );
-
-  /*
-   * Push a Task Message to head of queue
-   */
-  extern void osal_msg_push( osal_msg_q_t *q_ptr, void *msg_ptr );
-
-  /*
-   * Extract and remove a Task Message from queue
-   */
-  extern void osal_msg_extract( osal_msg_q_t *q_ptr, void *msg_ptr, void *prev_ptr );
-
-
-/*** Task Synchronization  ***/
-
-  /*
-   * Set a Task Event
-   */
-  extern byte osal_set_event( byte task_id, UINT16 event_flag );
-
-
-/*** Interrupt Management  ***/
-
-  /*
-   * Register Interrupt Service Routine (ISR)
-   */
-  extern byte osal_isr_register( byte interrupt_id, void (*isr_ptr)( byte* ) );
-
-  /*
-   * Enable Interrupt
-   */
-  extern byte osal_int_enable( byte interrupt_id );
-
-  /*
-   * Disable Interrupt
-   */
-  extern byte osal_int_disable( byte interrupt_id );
-
-
-/*** Task Management  ***/
-
-  /*
-   * Initialize the Task System
-   */
-  extern byte osal_init_system( void );
-
-  /*
-   * System Processing Loop
-   */
-#if defined (ZBIT)
-  extern __declspec(dllexport)  void osal_start_system( void );
-#else
-  extern void osal_start_system( void );
-#endif
-  /*
-   * Get the active task ID
-   */
-  extern byte osal_self( void );
-
-
-/*** Helper Functions ***/
-
-  /*
-   * String Length
-   */
-  extern int osal_strlen( char *pString );
-
-  /*
-   * Memory copy
-   */
-  extern void* osal_memcpy( void*, const void GENERIC *, unsigned int );
-
-  /*
-   * Copy Extended Addresses
-   */
-  extern void* osal_cpyExtAddr( void *dest, void *src );
-
-  /*
-   * Memory set
-   */
-  extern void *osal_memset( void *dest, byte value, int len );
-
-  /*
-   * Build a uint16 out of 2 bytes (0 then 1).
-   */
-  extern uint16 osal_build_uint16( byte *swapped );
-
-  /*
-   * Build a uint32 out of sequential bytes.
-   */
-  extern uint32 osal_build_uint32( byte *swapped, byte len );
-
-  /*
-   * Convert long to ascii string
-   */
-  #if !defined ( ZBIT ) && !defined ( ZBIT2 )
-  extern byte *_ltoa( uint32 l, byte * buf, byte radix );
-  #endif
-
-  /*
-   * Compares two address_t structures. true if equal
-   */
-  extern byte osal_AddrEqual( zAddrType_t *a1, zAddrType_t *a2 );
-
-  /*
-   * Verify that the extended addresses are equal. true if equal
-   */
-  extern byte osal_ExtAddrEqual( byte *extAddr1, byte *extAddr2 );
-
-  /*
-   * Random number generator
-   */
-  extern uint16 osal_rand( void );
-
-
-/*********************************************************************
-*********************************************************************/
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* OSAL_H */
+#ifndef OSAL_H
+#define OSAL_H
+
+/*********************************************************************
+    Filename:       OSAL.h
+    Revised:        $Date: 2006-09-29 18:09:20 -0700 (Fri, 29 Sep 2006) $
+    Revision:       $Revision: 12162 $
+
+    Description:
+
+       This API allows the software components in the Z-stack to be
+       written independently of the specifics of the operating system,
+       kernel or tasking environment (including control loops or
+       connect-to-interrupt systems).
+
+    Notes:
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include "ZComDef.h"
+#include "OSAL_Memory.h"
+#include "OSAL_Timers.h"
+
+/*********************************************************************
+ * MACROS
+ */
+
+#define osal_offsetof(type, member) ((uint16) &(((type *) 0)->member))
+
+#define OSAL_MSG_NEXT(msg_ptr)      ((osal_msg_hdr_t *) (msg_ptr) - 1)->next
+
+#define OSAL_MSG_Q_INIT(q_ptr)      *(q_ptr) = NULL
+
+#define OSAL_MSG_Q_EMPTY(q_ptr)     (*(q_ptr) == NULL)
+
+#define OSAL_MSG_Q_HEAD(q_ptr)      (*(q_ptr))
+
+// Bytes of storage needed by a message pool of 'cnt' messages of 'len' bytes.
+#define OSAL_MSG_POOL_BUF_SIZE(len, cnt)  ((uint16)(cnt) * (sizeof( osal_msg_hdr_t ) + (len)))
+
+/*********************************************************************
+ * CONSTANTS
+ */
+
+/*** Interrupts ***/
+#define INTS_ALL    0xFF
+
+/*** Message Pools ***/
+#if !defined ( OSAL_MSG_POOLS )
+  #define OSAL_MSG_POOLS  TRUE
+#endif
+
+// Maximum number of fixed-block message pools.
+#if !defined ( OSAL_MSG_POOL_MAX )
+  #define OSAL_MSG_POOL_MAX  4
+#endif
+
+/*** Message Reserve ***/
+// Heap blocks held back for allocations made while the reserve is armed
+// (MAC receive in interrupt context), used only when the heap is full.
+#if !defined ( OSAL_MSG_RESERVE )
+  #define OSAL_MSG_RESERVE  TRUE
+#endif
+
+/*** Message Budgets ***/
+// A task given a budget with osal_msg_budget() receives at most that many
+// messages per call of its event handler, then yields to the other tasks.
+#if !defined ( OSAL_MSG_BUDGET )
+  #define OSAL_MSG_BUDGET  FALSE
+#endif
+
+/*** Dispatch Statistics ***/
+// Track for each task the longest wait from its events being set to its
+// event handler being called, in OSAL_DISPATCH_CLOCK() ticks.
+#if !defined ( OSAL_DISPATCH_STATS )
+  #define OSAL_DISPATCH_STATS  FALSE
+#endif
+
+#if !defined ( OSAL_DISPATCH_CLOCK )
+  #define OSAL_DISPATCH_CLOCK()  ((uint16)osal_GetSystemClock())
+#endif
+
+/*** Multiple Instances ***/
+// Host builds only: run several OSAL instances in one process, each with its
+// own heap, messages, tasks and timers. The target keeps a single static
+// instance of every module, so state is accessed directly as before.
+#if !defined ( OSAL_MULTI_INSTANCE )
+  #define OSAL_MULTI_INSTANCE  FALSE
+#endif
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+typedef struct
+{
+  void   *next;
+  uint16 len;
+  byte   dest_id;
+} osal_msg_hdr_t;
+
+typedef struct
+{
+  uint8  event;
+  uint8  status;
+} osal_event_hdr_t;
+
+typedef void * osal_msg_q_t;
+
+typedef struct
+{
+  uint16 len;        // Message length served by each block.
+  byte   cnt;        // Number of blocks in the pool.
+  byte   used;       // Blocks currently allocated.
+  byte   highWater;  // Most blocks ever allocated at once.
+  uint16 hit;        // Allocations served by this pool.
+  uint16 miss;       // Best-fit allocations that found the pool empty.
+} osal_msg_pool_stats_t;
+
+typedef struct
+{
+  uint16 len;       // Message length served by each reserve block.
+  byte   cnt;       // Blocks the reserve is refilled to.
+  byte   avail;     // Blocks now held in reserve.
+  byte   lowWater;  // Fewest blocks ever held in reserve.
+  uint16 hit;       // Armed allocations served by the reserve.
+  uint16 miss;      // Armed allocations that the reserve could not serve.
+} osal_msg_reserve_stats_t;
+
+typedef struct
+{
+  uint16 depth;      // Messages now queued for the task.
+  uint16 highWater;  // Most messages ever queued for the task at once.
+} osal_msg_q_stats_t;
+
+typedef struct
+{
+  uint16 dispatches;  // Calls of the task's event handler.
+  uint16 worstDelay;  // Longest wait from ready to dispatch.
+} osal_dispatch_stats_t;
+
+#if ( OSAL_MULTI_INSTANCE )
+typedef struct
+{
+  void *mem;     // Heap state.
+  void *msg;     // Message queue, pool and reserve state.
+  void *tasks;   // Task list.
+  void *timers;  // Timer list and system clock.
+} osal_ctx_t;
+#endif
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+
+/*********************************************************************
+ * FUNCTIONS
+ */
+
+/*** Message Management ***/
+
+  /*
+   * Task Message Allocation
+   */
+  extern byte * osal_msg_allocate(uint16 len );
+
+  /*
+   * Task Message Deallocation
+   */
+  extern byte osal_msg_deallocate( byte *msg_ptr );
+
+#if ( OSAL_MSG_POOLS )
+  /*
+   * Add a Fixed-Block Message Pool
+   */
+  extern byte osal_msg_pool_add( byte *buf, uint16 len, byte cnt );
+
+  /*
+   * Message Pool Counters
+   */
+  extern const osal_msg_pool_stats_t *osal_msg_pool_stats( byte pool );
+#endif
+
+#if ( OSAL_MSG_RESERVE )
+  /*
+   * Size and Fill the Message Reserve
+   */
+  extern void osal_msg_reserve_set( uint16 len, byte cnt );
+
+  /*
+   * Arm the Message Reserve for the following allocations
+   */
+  extern void osal_msg_reserve_arm( byte armed );
+
+  /*
+   * Message Reserve Counters
+   */
+  extern const osal_msg_reserve_stats_t *osal_msg_reserve_stats( void );
+#endif
+
+#if ( OSAL_MULTI_INSTANCE )
+/*** Multiple Instances ***/
+
+  /*
+   * Create an OSAL Instance with zeroed state
+   */
+  extern osal_ctx_t *osal_ctx_create( void );
+
+  /*
+   * Make an OSAL Instance the current one
+   */
+  extern void osal_ctx_switch( osal_ctx_t *ctx );
+
+  /*
+   * Free an OSAL Instance that is not current
+   */
+  extern void osal_ctx_destroy( osal_ctx_t *ctx );
+
+  /*
+   * Per-module state of an instance, used by the functions above
+   */
+  extern void *osalMemCtxNew( void );
+  extern void osalMemCtxUse( void *ctx );
+  extern void *osalTaskCtxNew( void );
+  extern void osalTaskCtxUse( void *ctx );
+  extern void *osalTimerCtxNew( void );
+  extern void osalTimerCtxUse( void *ctx );
+#endif
+
+  /*
+   * Task Messages Count
+   */
+  extern UINT16 osal_num_msgs( void );
+
+  /*
+   * Send a Task Message
+   */
+  extern byte osal_msg_send( byte destination_task, byte *msg_ptr );
+
+  /*
+   * Receive a Task Message
+   */
+  extern byte *osal_msg_receive( byte task_id );
+
+  /*
+   * Task Message Queue Counters
+   */
+  extern const osal_msg_q_stats_t *osal_msg_q_stats( byte task_id );
+
+#if ( OSAL_MSG_BUDGET )
+  /*
+   * Set the Messages a Task receives per Event Handler call
+   */
+  extern byte osal_msg_budget( byte task_id, byte budget );
+#endif
+
+
+  /*
+   * Enqueue a Task Message
+   */
+  extern void osal_msg_enqueue( osal_msg_q_t *q_ptr, void *msg_ptr );
+
+  /*
+   * Enqueue a Task Message Up to Max
+   */
+  extern byte osal_msg_enqueue_max( osal_msg_q_t *q_ptr, void *msg_ptr, byte max );
+
+  /*
+   * Dequeue a Task Message
+   */
+  extern void *osal_msg_dequeue( osal_msg_q_t *q_ptr );
+
+  /*
+   * Push a Task Message to head of queue
+   */
+  extern void osal_msg_push( osal_msg_q_t *q_ptr, void *msg_ptr );
+
+  /*
+   * Extract and remove a Task Message from queue
+   */
+  extern void osal_msg_extract( osal_msg_q_t *q_ptr, void *msg_ptr, void *prev_ptr );
+
+
+/*** Task Synchronization  ***/
+
+  /*
+   * Set a Task Event
+   */
+  extern byte osal_set_event( byte task_id, UINT16 event_flag );
+
+
+/*** Interrupt Management  ***/
+
+  /*
+   * Register Interrupt Service Routine (ISR)
+   */
+  extern byte osal_isr_register( byte interrupt_id, void (*isr_ptr)( byte* ) );
+
+  /*
+   * Enable Interrupt
+   */
+  extern byte osal_int_enable( byte interrupt_id );
+
+  /*
+   * Disable Interrupt
+   */
+  extern byte osal_int_disable( byte interrupt_id );
+
+
+/*** Task Management  ***/
+
+  /*
+   * Initialize the Task System
+   */
+  extern byte osal_init_system( void );
+
+  /*
+   * System Processing Loop
+   */
+#if defined (ZBIT)
+  extern __declspec(dllexport)  void osal_start_system( void );
+#else
+  extern void osal_start_system( void );
+#endif
+  /*
+   * Get the active task ID
+   */
+  extern byte osal_self( void );
+
+#if ( OSAL_DISPATCH_STATS )
+  /*
+   * Task Dispatch Counters
+   */
+  extern const osal_dispatch_stats_t *osal_dispatch_stats( byte task_id );
+#endif
+
+
+/*** Helper Functions ***/
+
+  /*
+   * String Length
+   */
+  extern int osal_strlen( char *pString );
+
+  /*
+   * Memory copy
+   */
+  extern void* osal_memcpy( void*, const void GENERIC *, unsigned int );
+
+  /*
+   * Copy Extended Addresses
+   */
+  extern void* osal_cpyExtAddr( void *dest, void *src );
+
+  /*
+   * Memory set
+   */
+  extern void *osal_memset( void *dest, byte value, int len );
+
+  /*
+   * Build a uint16 out of 2 bytes (0 then 1).
+   */
+  extern uint16 osal_build_uint16( byte *swapped );
+
+  /*
+   * Build a uint32 out of sequential bytes.
+   */
+  extern uint32 osal_build_uint32( byte *swapped, byte len );
+
+  /*
+   * Convert long to ascii string
+   */
+  #if !defined ( ZBIT ) && !defined ( ZBIT2 )
+  extern byte *_ltoa( uint32 l, byte * buf, byte radix );
+  #endif
+
+  /*
+   * Compares two address_t structures. true if equal
+   */
+  extern byte osal_AddrEqual( zAddrType_t *a1, zAddrType_t *a2 );
+
+  /*
+   * Verify that the extended addresses are equal. true if equal
+   */
+  extern byte osal_ExtAddrEqual( byte *extAddr1, byte *extAddr2 );
+
+  /*
+   * Random number generator
+   */
+  extern uint16 osal_rand( void );
+
+
+/*********************************************************************
+*********************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OSAL_H */
@@ -1,91 +1,98 @@
-#ifndef OSAL_CUSTOM_H
-#define OSAL_CUSTOM_H
-
-/*********************************************************************
-    Filename:       $RCSfile$
-    Author:         $Author: rlord $
-    Revised:        $Date: 2006-04-06 08:19:08 -0700 (Thu, 06 Apr 2006) $
-    Revision:       $Revision: 10396 $
-    
-    Description:    
-    
-    This file contains all the settings and other functions that
-    the user should set and change.
-
-    Notes:  
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-/*********************************************************************
- * INCLUDES
- */
-
- 
-/*********************************************************************
- * MACROS
- */
-
-/*********************************************************************
- * CONSTANTS
- */
-
-/*********************************************************************
- * TYPEDEFS
- */
-
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
- 
-/*********************************************************************
- * FUNCTIONS
- */
-
-/*
- * This function adds all the tasks to the task list.
- *  This is where to add new tasks.
- */
-extern void osalAddTasks( void );
-
-/*********************************************************************
-$Log$
-Revision 1.7  2003/12/17 19:49:44  rjessup
-Added power manager and memory manager as a seperate module
-
-Revision 1.6  2003/10/10 18:27:18  rjessup
-bumped up the heap for windows
-
-Revision 1.5  2003/10/09 00:47:19  rjessup
-Fixed CW compiler warnings
-
-Revision 1.4  2003/10/07 18:19:17  rjessup
-Up'd the mem heap size
-
-Revision 1.3  2003/10/06 22:57:19  rjessup
-Changed the Heap size
-
-Revision 1.2  2003/09/19 23:16:04  rjessup
-Moved timer functions to OSAL_Timers and made them dynamic
-
-Revision 1.1  2003/09/19 16:57:14  rjessup
-Made the task definitions dynamic
-Also, moved user changable items into OSAL_Custom
-
-*********************************************************************/
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* OSAL_CUSTOM_H */
+#ifndef OSAL_CUSTOM_H
+#define OSAL_CUSTOM_H
+
+/*********************************************************************
+    Filename:       $RCSfile$
+    Author:         $Author: rlord $
+    Revised:        $Date: 2006-04-06 08:19:08 -0700 (Thu, 06 Apr 2006) $
+    Revision:       $Revision: 10396 $
+    
+    Description:    
+    
+    This file contains all the settings and other functions that
+    the user should set and change.
+
+    Notes:  
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+
+ 
+/*********************************************************************
+ * MACROS
+ */
+
+/*********************************************************************
+ * CONSTANTS
+ */
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+ 
+/*********************************************************************
+ * FUNCTIONS
+ */
+
+/*
+ * This function adds all the tasks to the task list.
+ *  This is where to add new tasks.
+ */
+extern void osalAddTasks( void );
+
+/*
+ * This function adds the fixed-block message pools and sizes the
+ *  message reserve. It is called even when OSAL_MSG_POOLS is FALSE.
+ *  This is where to size the message pools.
+ */
+extern void osalAddMsgPools( void );
+
+/*********************************************************************
+$Log$
+Revision 1.7  2003/12/17 19:49:44  rjessup
+Added power manager and memory manager as a seperate module
+
+Revision 1.6  2003/10/10 18:27:18  rjessup
+bumped up the heap for windows
+
+Revision 1.5  2003/10/09 00:47:19  rjessup
+Fixed CW compiler warnings
+
+Revision 1.4  2003/10/07 18:19:17  rjessup
+Up'd the mem heap size
+
+Revision 1.3  2003/10/06 22:57:19  rjessup
+Changed the Heap size
+
+Revision 1.2  2003/09/19 23:16:04  rjessup
+Moved timer functions to OSAL_Timers and made them dynamic
+
+Revision 1.1  2003/09/19 16:57:14  rjessup
+Made the task definitions dynamic
+Also, moved user changable items into OSAL_Custom
+
+*********************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OSAL_CUSTOM_H */
@@ -0,0 +1,72 @@
+#ifndef OSAL_MEMBUCKETS_H
+#define OSAL_MEMBUCKETS_H
+
+/*********************************************************************
+    Filename:       OSAL_MemBuckets.h
+    Revised:        $Date$
+    Revision:       $Revision$
+
+    Description:    Small-block bucket layout of the first-fit heap,
+                    used by osal_mem_init().
+
+    Notes:
+
+    The values below are meant to be regenerated from an
+    OSALMEM_PROFILER run of the application under its steady-state
+    load, reading proCnt[], proMax[], proTot[] and proSmallBlkMiss[]
+    from OSAL_Memory.c:
+
+    - Every bucket serves the blocks (header included) larger than the
+      previous bucket's OSALMEM_BUCKET_BLKSZ and up to its own. Put the
+      boundaries where proTot[] shows the allocation sizes cluster, and
+      make every boundary a profiler bin of OSALMEM_PRO_BINS so that
+      the counters of a bucket can be read directly.
+    - Size a bucket's OSALMEM_BUCKET_LEN to the sum of proMax[] x bin
+      size over its bins. It must be a multiple of the header size.
+    - Miss rate of bucket n = proSmallBlkMiss[n] / proTot[] of its bins.
+      Grow the bucket while the steady-state miss rate is above ~15%.
+      Buckets that are rarely full only waste heap that the large
+      blocks could use.
+
+    host/tools/mem_buckets applies these rules to a profile and writes
+    this file; "make buckets TRACE=<capture>" in host/ profiles a heap
+    trace of the badge, generates the layout and replays the capture
+    before and after, with the miss rate of every bucket.
+
+    The defaults are the single 16-byte/232-byte bucket that this heap
+    has always used.
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+/*********************************************************************
+ * CONSTANTS
+ */
+
+#if !defined ( OSALMEM_BUCKET_CNT )
+// Number of small-block buckets, laid out from the bottom of the heap.
+#define OSALMEM_BUCKET_CNT    1
+
+// Largest block, including its header, first tried in each bucket.
+#define OSALMEM_BUCKET_BLKSZ  16
+
+// Bytes of heap given to each bucket.
+#define OSALMEM_BUCKET_LEN    232
+#endif
+
+#if !defined ( OSALMEM_PRO_BINS )
+/* Upper block size of each of the 8 OSALMEM_PROFILER bins. The bins must
+ * differ by at least OSALMEM_MIN_BLKSZ; the last bin must equal the max
+ * alloc size.
+ */
+#define OSALMEM_PRO_BINS      16, 48, 112, 176, 192, 224, 256, 65535
+#endif
+
+/*********************************************************************
+*********************************************************************/
+
+#endif /* OSAL_MEMBUCKETS_H */
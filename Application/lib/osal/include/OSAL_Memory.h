@@ -1,111 +1,318 @@
-#ifndef OSAL_MEMORY_H
-#define OSAL_MEMORY_H
-/*********************************************************************
-    Filename:       OSAL_Memory.h
-    Revised:        $Date: 2006-10-26 11:15:57 -0700 (Thu, 26 Oct 2006) $
-    Revision:       $Revision: 12421 $
-    
-    Description:    
-    
-       This module defines the OSAL memory control functions. 
-            
-    Notes:  
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-/*********************************************************************
- * INCLUDES
- */
-#include "ZComDef.h"
- 
-/*********************************************************************
- * CONSTANTS
- */
-
-#if !defined ( OSALMEM_METRICS )
-  #define OSALMEM_METRICS  FALSE
-#endif
-
-/*********************************************************************
- * MACROS
- */
-
-/*********************************************************************
- * TYPEDEFS
- */
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
- 
-/*********************************************************************
- * FUNCTIONS
- */
-
- /*
-  * Initialize memory manager.
-  */
-  void osal_mem_init( void );
-
- /*
-  * Setup efficient search for the first free block of heap.
-  */
-  void osal_mem_kick( void );
-
- /*
-  * Allocate a block of memory.
-  */
-  void *osal_mem_alloc( uint16 size );
-
- /*
-  * Free a block of memory.
-  */
-  void osal_mem_free( void *ptr );
-
-#if ( OSALMEM_METRICS )
- /*
-  * Return the maximum number of blocks ever allocated at once.
-  */
-  uint16 osal_heap_block_max( void );
-
- /*
-  * Return the current number of blocks now allocated.
-  */
-  uint16 osal_heap_block_cnt( void );
-
- /*
-  * Return the current number of free blocks.
-  */
-  uint16 osal_heap_block_free( void );
-
- /*
-  * Return the current number of bytes allocated.
-  */
-  uint16 osal_heap_mem_used( void );
-#endif
-
-#if defined (ZTOOL_P1) || defined (ZTOOL_P2)
- /*
-  * Return the highest number of bytes ever used in the heap.
-  */
-  uint16 osal_heap_high_water( void );
-#endif
-
-/*********************************************************************
-*********************************************************************/
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* #ifndef OSAL_MEMORY_H */
+#ifndef OSAL_MEMORY_H
+#define OSAL_MEMORY_H
+/*********************************************************************
+    Filename:       OSAL_Memory.h
+    Revised:        $Date: 2006-10-26 11:15:57 -0700 (Thu, 26 Oct 2006) $
+    Revision:       $Revision: 12421 $
+    
+    Description:    
+    
+       This module defines the OSAL memory control functions. 
+            
+    Notes:  
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+#include "ZComDef.h"
+ 
+/*********************************************************************
+ * CONSTANTS
+ */
+
+#if !defined ( OSALMEM_METRICS )
+  #define OSALMEM_METRICS  FALSE
+#endif
+
+/* Heap allocator implementations selectable with OSALMEM_ALLOCATOR.
+ *   OSALMEM_ALLOC_FIRSTFIT - first-fit walk with a small-block bucket.
+ *   OSALMEM_ALLOC_SEGFIT   - segregated size-class free lists, O(1) alloc/free
+ *                            with boundary tags, coalescing on free.
+ *   OSALMEM_ALLOC_TLSF     - two-level segregated fit, O(1) alloc/free with
+ *                            splitting and immediate coalescing.
+ */
+#define OSALMEM_ALLOC_FIRSTFIT  0
+#define OSALMEM_ALLOC_SEGFIT    1
+#define OSALMEM_ALLOC_TLSF      2
+
+#if !defined ( OSALMEM_ALLOCATOR )
+  #define OSALMEM_ALLOCATOR  OSALMEM_ALLOC_FIRSTFIT
+#endif
+
+/* Optional per-task heap accounting. Every block is tagged with its owning
+ * task - osal_self() at allocation, the destination task once it is sent
+ * as a message - and per-task byte counters are kept. A task given a quota
+ * with osal_mem_set_quota() gets NULL back rather than starving the others.
+ * In an ISR osal_self() is the interrupted task, so ISRs and the stack
+ * allocate inside osal_mem_system() brackets, which charge the block to
+ * OSALMEM_OWNER_SYSTEM outside any quota.
+ */
+#if !defined ( OSALMEM_OWNERS )
+  #define OSALMEM_OWNERS  FALSE
+#endif
+
+#if ( OSALMEM_OWNERS ) && !defined ( OSALMEM_OWNER_MAX )
+  #define OSALMEM_OWNER_MAX  8  // Task IDs at or above this share one account.
+#endif
+
+#define OSALMEM_OWNER_SYSTEM  0xFE  // Owner of blocks from osal_mem_system() brackets.
+
+/* Optional record of the longest interrupt-disabled window of the heap at
+ * each call site, read with osal_mem_irqoff_max(). Windows are timed with
+ * OSALMEM_IRQOFF_NOW(), the sleep timer unless the build supplies a clock.
+ */
+#if !defined ( OSALMEM_IRQOFF_STATS )
+  #define OSALMEM_IRQOFF_STATS  FALSE
+#endif
+
+#define OSALMEM_IRQ_ALLOC        0  // Allocation: list pop, or first-fit walk and split.
+#define OSALMEM_IRQ_ALLOC_LARGE  1  // Allocation: segregated-fit take from a larger class.
+#define OSALMEM_IRQ_FREE         2  // Free: list push or merge.
+#define OSALMEM_IRQ_OTHER        3  // Bookkeeping: metrics, trace, owners, kick.
+#define OSALMEM_IRQ_SITES        4
+
+/* Optional binary trace of every heap event, buffered in a ring of
+ * OSALMEM_TRACE_BUFSZ bytes and streamed out of UART OSALMEM_TRACE_PORT
+ * by the OSAL main loop, one whole record per HalUARTWrite(). The port
+ * defaults to port 1, away from the MSA data on HAL_UART_PORT, and is
+ * opened by the application. When it must share a port with application
+ * output, each record starts with a sync nibble to find it again. Records
+ * are OSALMEM_TRACE_RECSZ bytes, multi-byte fields little-endian:
+ *
+ *   [0]    0xA0 | kind (OSALMEM_TRACE_ALOC .. OSALMEM_TRACE_LOST)
+ *   [1]    task ID from osal_self() - the interrupted task in an ISR,
+ *          0xFF before the first task runs.
+ *   [2..3] ALOC/FAIL: bytes requested; FREE: block size incl. header;
+ *          LOST: number of records dropped because the ring was full.
+ *   [4..5] heap offset of the block's payload - pairs each FREE with its
+ *          ALOC for replay; 0xFFFF for FAIL and LOST.
+ *   [6..7] low 16 bits of osal_GetSystemClock() in ms.
+ */
+#if !defined ( OSALMEM_TRACE )
+  #define OSALMEM_TRACE  FALSE
+#endif
+
+#if ( OSALMEM_TRACE )
+  #if !defined ( OSALMEM_TRACE_PORT )
+    #define OSALMEM_TRACE_PORT   1  // HAL_UART_PORT_1
+  #endif
+  #if !defined ( OSALMEM_TRACE_BUFSZ )
+    #define OSALMEM_TRACE_BUFSZ  128  // Multiple of OSALMEM_TRACE_RECSZ, <= 248.
+  #endif
+#endif
+
+#define OSALMEM_TRACE_RECSZ  8
+#define OSALMEM_TRACE_SYNC   0xA0
+#define OSALMEM_TRACE_ALOC   0x01
+#define OSALMEM_TRACE_FREE   0x02
+#define OSALMEM_TRACE_FAIL   0x03
+#define OSALMEM_TRACE_LOST   0x04
+
+/* Optional allocation profile (OSALMEM_PROFILER, see OSAL_MemBuckets.h):
+ * per bin of OSALMEM_PRO_BINS block sizes, the most blocks live at once
+ * and the blocks ever allocated, read with osal_mem_pro_bin(); per
+ * first-fit small-block bucket, the allocations it could not serve, read
+ * with osal_mem_pro_miss().
+ */
+#define OSALMEM_PRO_CNT  8
+
+/* Optional scratch arena for buffers that live only while one event is
+ * handled, kept out of the heap. osal_mem_scratch() bumps a pointer, and
+ * osal_mem_scratch_release() drops everything taken since the matching
+ * osal_mem_scratch_mark() at once. The OSAL main loop also empties the
+ * arena after every task event handler. Task context only, not ISRs.
+ * The arena is OSALMEM_SCRATCH_LEN bytes of RAM of its own, held for
+ * good, to save a heap allocation and free per use: the MSA project
+ * enables it for the frame it forwards to the UART, which then costs no
+ * heap call.
+ */
+#if !defined ( OSALMEM_SCRATCH )
+  #define OSALMEM_SCRATCH  FALSE
+#endif
+
+#if ( OSALMEM_SCRATCH ) && !defined ( OSALMEM_SCRATCH_LEN )
+  #define OSALMEM_SCRATCH_LEN  128  // Largest MAC payload plus an LCD line.
+#endif
+
+/*********************************************************************
+ * MACROS
+ */
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+ 
+/*********************************************************************
+ * FUNCTIONS
+ */
+
+ /*
+  * Initialize memory manager.
+  */
+  void osal_mem_init( void );
+
+ /*
+  * Setup efficient search for the first free block of heap.
+  */
+  void osal_mem_kick( void );
+
+ /*
+  * Allocate a block of memory.
+  */
+  void *osal_mem_alloc( uint16 size );
+
+ /*
+  * Free a block of memory.
+  */
+  void osal_mem_free( void *ptr );
+
+ /*
+  * Grow a block, in place when possible.
+  */
+  void *osal_mem_realloc( void *ptr, uint16 size );
+
+#if ( OSALMEM_METRICS )
+ /*
+  * Return the maximum number of blocks ever allocated at once.
+  */
+  uint16 osal_heap_block_max( void );
+
+ /*
+  * Return the current number of blocks now allocated.
+  */
+  uint16 osal_heap_block_cnt( void );
+
+ /*
+  * Return the current number of free blocks.
+  */
+  uint16 osal_heap_block_free( void );
+
+ /*
+  * Return the current number of bytes allocated.
+  */
+  uint16 osal_heap_mem_used( void );
+
+ /*
+  * Return the payload bytes of the largest free block.
+  */
+  uint16 osal_heap_largest_free( void );
+
+#if ( OSALMEM_SCRATCH )
+ /*
+  * Return the most scratch arena bytes ever in use at once.
+  */
+  uint16 osal_heap_scratch_max( void );
+#endif
+#endif
+
+#if ( OSALMEM_PROFILER )
+ /*
+  * Return the size and counters of a profiler bin.
+  */
+  uint16 osal_mem_pro_bin( byte bin, uint16 *maxLive, uint16 *total );
+
+ /*
+  * Return the allocations a small-block bucket could not serve.
+  */
+  uint16 osal_mem_pro_miss( byte bkt );
+#endif
+
+#if ( OSALMEM_IRQOFF_STATS )
+ /*
+  * Return the longest interrupt-disabled window at a call site.
+  */
+  uint16 osal_mem_irqoff_max( byte site );
+#endif
+
+#if ( OSALMEM_OWNERS )
+ /*
+  * Hand a heap block over to another task.
+  */
+  void osal_mem_set_owner( void *ptr, byte task );
+
+ /*
+  * Return the task that holds a heap block.
+  */
+  byte osal_mem_owner( void *ptr );
+
+ /*
+  * Set the max bytes a task may hold; 0 for no limit.
+  */
+  void osal_mem_set_quota( byte task, uint16 quota );
+
+ /*
+  * Return the bytes a task holds.
+  */
+  uint16 osal_mem_task_used( byte task );
+
+ /*
+  * Return the number of allocations refused by a task's quota.
+  */
+  uint16 osal_mem_task_denied( byte task );
+
+ /*
+  * Charge the allocations that follow to the system, outside quotas.
+  */
+  void osal_mem_system( byte on );
+#endif
+
+#if ( OSALMEM_TRACE )
+ /*
+  * Return the oldest unsent trace bytes, contiguous in the ring.
+  */
+  byte *osal_mem_trace_peek( uint16 *len );
+
+ /*
+  * Release trace bytes that have been sent.
+  */
+  void osal_mem_trace_consume( uint16 len );
+#endif
+
+#if ( OSALMEM_SCRATCH )
+ /*
+  * Take a buffer from the scratch arena.
+  */
+  void *osal_mem_scratch( uint16 size );
+
+ /*
+  * Return the scratch arena position to release back to.
+  */
+  uint16 osal_mem_scratch_mark( void );
+
+ /*
+  * Release every scratch buffer taken since a mark.
+  */
+  void osal_mem_scratch_release( uint16 mark );
+#endif
+
+#if defined (ZTOOL_P1) || defined (ZTOOL_P2)
+ /*
+  * Return the highest number of bytes ever used in the heap.
+  */
+  uint16 osal_heap_high_water( void );
+#endif
+
+/*********************************************************************
+*********************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef OSAL_MEMORY_H */
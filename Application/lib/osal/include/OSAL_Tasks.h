@@ -1,115 +1,169 @@
-#ifndef OSAL_TASKS_H
-#define OSAL_TASKS_H
-
-/*********************************************************************
-    Filename:       OSAL_Tasks.h
-    Revised:        $Date: 2006-04-06 08:19:08 -0700 (Thu, 06 Apr 2006) $
-    Revision:       $Revision: 10396 $
-
-    Description:
-
-       This file contains the OSAL Task definition and manipulation
-       functions.
-
-    Notes:
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-/*********************************************************************
- * INCLUDES
- */
-
-/*********************************************************************
- * MACROS
- */
-
-/*********************************************************************
- * CONSTANTS
- */
-#define TASK_NO_TASK      0xFF
-
-/* Task priority level */
-#define OSAL_TASK_PRIORITY_LOW		50
-#define OSAL_TASK_PRIORITY_MED		130
-#define OSAL_TASK_PRIORITY_HIGH		230
-
-/*********************************************************************
- * TYPEDEFS
- */
-/*
- * Task Initialization function prototype
- */
-typedef void (*pTaskInitFn)( unsigned char task_id );
-
-/*
- * Event handler function prototype
- */
-typedef unsigned short (*pTaskEventHandlerFn)( unsigned char task_id, unsigned short event );
-
-typedef struct osalTaskRec
-{
-  struct osalTaskRec  *next;
-  pTaskInitFn          pfnInit;
-  pTaskEventHandlerFn  pfnEventProcessor;
-  byte                 taskID;
-  byte                 taskPriority;
-  uint16               events;
-
-} osalTaskRec_t;
-
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
-extern osalTaskRec_t *activeTask;
-
-/*********************************************************************
- * FUNCTIONS
- */
-
-/*
- * Initialization for the Tasking System.
- */
-extern void osalTaskInit( void );
-
-/*
- *  Add a task to the task list
- */
-extern void osalTaskAdd( pTaskInitFn pfnInit,
-                         pTaskEventHandlerFn pfnEventProcessor,
-                         byte taskPriority);
-
-/*
- * Call each of the tasks initailization functions.
- */
-extern void osalInitTasks( void );
-
-/*
- * This function will return the next active task.
- */
-extern osalTaskRec_t *osalNextActiveTask( void );
-
-/*
- * This function will return a task pointer to the task
- *       found with the passed in task ID.
- */
-extern osalTaskRec_t *osalFindTask( byte taskID );
-
-/*********************************************************************
-*********************************************************************/
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* OSAL_TASKS_H */
+#ifndef OSAL_TASKS_H
+#define OSAL_TASKS_H
+
+/*********************************************************************
+    Filename:       OSAL_Tasks.h
+    Revised:        $Date: 2006-04-06 08:19:08 -0700 (Thu, 06 Apr 2006) $
+    Revision:       $Revision: 10396 $
+
+    Description:
+
+       This file contains the OSAL Task definition and manipulation
+       functions.
+
+    Notes:
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+
+/*********************************************************************
+ * MACROS
+ */
+
+/*
+ * Mark a task ready after its events were set, or idle after they were
+ * taken. Ints must be disabled.
+ */
+#define OSAL_TASK_READY( pTask ) \
+  st( if ( (pTask)->events ) osalTaskCtx.ready |= (pTask)->readyBit; )
+#define OSAL_TASK_IDLE( pTask ) \
+  st( osalTaskCtx.ready &= ~(pTask)->readyBit; )
+
+/*
+ * TRUE if no task has events to process
+ */
+#define OSAL_TASKS_IDLE()  ( osalTaskCtx.ready == 0 )
+
+/*********************************************************************
+ * CONSTANTS
+ */
+#define TASK_NO_TASK      0xFF
+
+// Size of the task table: at least the tasks added by osalAddTasks()
+#if !defined ( OSAL_MAX_TASKS )
+  #define OSAL_MAX_TASKS  3
+#endif
+
+#if ( OSAL_MAX_TASKS > 16 )
+  #error "OSAL_MAX_TASKS: the ready bitmap holds at most 16 tasks"
+#endif
+
+/* Task priority level */
+#define OSAL_TASK_PRIORITY_LOW		50
+#define OSAL_TASK_PRIORITY_MED		130
+#define OSAL_TASK_PRIORITY_HIGH		230
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+
+/*
+ * One bit per task, in priority order: bit 0 is the highest priority task
+ */
+#if ( OSAL_MAX_TASKS > 8 )
+typedef uint16 osalTaskReady_t;
+#else
+typedef byte osalTaskReady_t;
+#endif
+
+/*
+ * Task Initialization function prototype
+ */
+typedef void (*pTaskInitFn)( unsigned char task_id );
+
+/*
+ * Event handler function prototype
+ */
+typedef unsigned short (*pTaskEventHandlerFn)( unsigned char task_id, unsigned short event );
+
+typedef struct osalTaskRec
+{
+  struct osalTaskRec  *next;
+  pTaskInitFn          pfnInit;
+  pTaskEventHandlerFn  pfnEventProcessor;
+  byte                 taskID;
+  byte                 taskPriority;
+  osalTaskReady_t      readyBit;    // Bit of the task in the ready bitmap
+  uint16               events;
+#if ( OSAL_DISPATCH_STATS )
+  uint16               readyAt;     // OSAL_DISPATCH_CLOCK() when events were set
+  osal_dispatch_stats_t dispatch;
+#endif
+
+} osalTaskRec_t;
+
+typedef struct
+{
+  osalTaskRec_t tasks[OSAL_MAX_TASKS];  // Task table, indexed by task ID.
+  osalTaskRec_t *tasksHead;  // Task list, in priority order.
+  osalTaskRec_t *ranked[OSAL_MAX_TASKS];  // Tasks by ready bit index.
+  osalTaskReady_t ready;     // Ready bits of the tasks with events.
+  osalTaskRec_t *active;     // Task being initialized or run, see activeTask.
+  byte taskIDs;              // ID of the next task added.
+} osalTaskCtx_t;
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+#if ( OSAL_MULTI_INSTANCE )
+  extern osalTaskCtx_t *osalTaskCur;
+  #define osalTaskCtx  (*osalTaskCur)
+#else
+  extern osalTaskCtx_t osalTaskCtx;
+#endif
+
+#define activeTask  (osalTaskCtx.active)
+
+/*********************************************************************
+ * FUNCTIONS
+ */
+
+/*
+ * Initialization for the Tasking System.
+ */
+extern void osalTaskInit( void );
+
+/*
+ *  Add a task to the task table and list
+ */
+extern void osalTaskAdd( pTaskInitFn pfnInit,
+                         pTaskEventHandlerFn pfnEventProcessor,
+                         byte taskPriority);
+
+/*
+ * Call each of the tasks initailization functions.
+ */
+extern void osalInitTasks( void );
+
+/*
+ * This function will return the next active task.
+ */
+extern osalTaskRec_t *osalNextActiveTask( void );
+
+/*
+ * This function will return a task pointer to the task
+ *       found with the passed in task ID.
+ */
+extern osalTaskRec_t *osalFindTask( byte taskID );
+
+/*********************************************************************
+*********************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OSAL_TASKS_H */
@@ -1,121 +1,195 @@
-#ifndef OSAL_TIMERS_H
-#define OSAL_TIMERS_H
-
-/*********************************************************************
-    Filename:       OSAL_Timers.h
-    Revised:        $Date: 2006-08-03 11:44:57 -0700 (Thu, 03 Aug 2006) $
-    Revision:       $Revision: 11593 $
-
-    Description:
-
-       This file contains the OSAL Timer definition and manipulation
-       functions.
-
-    Notes:
-
-    Copyright (c) 2006 by Texas Instruments, Inc.
-    All Rights Reserved.  Permission to use, reproduce, copy, prepare
-    derivative works, modify, distribute, perform, display or sell this
-    software and/or its documentation for any purpose is prohibited
-    without the express written consent of Texas Instruments, Inc.
-*********************************************************************/
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-/*********************************************************************
- * INCLUDES
- */
-
-/*********************************************************************
- * MACROS
- */
-
-/*********************************************************************
- * CONSTANTS
- */
-#define OSAL_TIMERS_MAX_TIMEOUT 0xFFFF
-
-/*********************************************************************
- * TYPEDEFS
- */
-
-/*********************************************************************
- * GLOBAL VARIABLES
- */
-
-/*********************************************************************
- * FUNCTIONS
- */
-
-  /*
-   * Initialization for the OSAL Timer System.
-   */
-  extern void osalTimerInit( void );
-
-  /*
-   * Set a Timer
-   */
-  extern byte osal_start_timer( UINT16 event_id, UINT16 timeout_value );
-  extern byte osal_start_timerEx( byte task_id, UINT16 event_id, UINT16 timeout_value );
-
-  /*
-   * Stop a Timer
-   */
-  extern byte osal_stop_timer( UINT16 event_id );
-  extern byte osal_stop_timerEx( byte task_id, UINT16 event_id );
-
-  /*
-   * Get the tick count of a Timer.
-   */
-  extern UINT16 osal_get_timeoutEx( byte task_id, UINT16 event_id );
-
-  /*
-   * Simulated Timer Interrupt Service Routine
-   */
-
-  extern void osal_timer_ISR( void );
-
-  /*
-   * Adjust timer tables
-   */
-  extern void osal_adjust_timers( void );
-
-  /*
-   * Update timer tables
-   */
-  extern void osal_update_timers( void );
-
-  /*
-   * Count active timers
-   */
-  extern byte osal_timer_num_active( void );
-
-  /*
-   * Set the hardware timer interrupts for sleep mode.
-   * These functions should only be called in OSAL_PwrMgr.c
-   */
-  extern void osal_sleep_timers( void );
-  extern void osal_unsleep_timers( void );
-
- /*
-  * Read the system clock - returns milliseconds
-  */
-  extern uint32 osal_GetSystemClock( void );
-
-  /*
-   * Get the next OSAL timer expiration.
-   * This function should only be called in OSAL_PwrMgr.c
-   */
-  extern uint16 osal_next_timeout( void );
-
-/*********************************************************************
-*********************************************************************/
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* OSAL_TIMERS_H */
+#ifndef OSAL_TIMERS_H
+#define OSAL_TIMERS_H
+
+/*********************************************************************
+    Filename:       OSAL_Timers.h
+    Revised:        $Date: 2006-08-03 11:44:57 -0700 (Thu, 03 Aug 2006) $
+    Revision:       $Revision: 11593 $
+
+    Description:
+
+       This file contains the OSAL Timer definition and manipulation
+       functions.
+
+    Notes:
+
+    Copyright (c) 2006 by Texas Instruments, Inc.
+    All Rights Reserved.  Permission to use, reproduce, copy, prepare
+    derivative works, modify, distribute, perform, display or sell this
+    software and/or its documentation for any purpose is prohibited
+    without the express written consent of Texas Instruments, Inc.
+*********************************************************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/*********************************************************************
+ * INCLUDES
+ */
+
+/*********************************************************************
+ * MACROS
+ */
+
+/*********************************************************************
+ * CONSTANTS
+ */
+#define OSAL_TIMERS_MAX_TIMEOUT 0xFFFF
+
+/*** Timer Wheel ***/
+// Keep the timers in a hierarchical timing wheel instead of a sorted
+// list: start, stop and expiry no longer depend on the number of timers.
+#if !defined ( OSAL_TIMER_WHEEL )
+  #define OSAL_TIMER_WHEEL  FALSE
+#endif
+
+/*** Timer Lookup ***/
+// Lookup buckets of the running timers, a power of 2.
+#if !defined ( OSAL_TIMER_HASH_CNT )
+  #define OSAL_TIMER_HASH_CNT  16
+#endif
+
+// Tasks, from task ID 0, that keep a bitmap of the events they have a
+// timer running for: looking up a timer that is not running takes no
+// search. The timers of the other tasks are searched in their bucket.
+#if !defined ( OSAL_TIMER_TASK_CNT )
+  #define OSAL_TIMER_TASK_CNT  8
+#endif
+
+/*** Tickless Timers ***/
+// Run OSAL_TIMER free and set its compare to the next timeout instead
+// of taking a tick every millisecond. The application must configure
+// OSAL_TIMER in HAL_TIMER_MODE_NORMAL.
+#if !defined ( OSAL_TICKLESS )
+  #define OSAL_TICKLESS  FALSE
+#endif
+
+/*********************************************************************
+ * TYPEDEFS
+ */
+
+/* Timer record. Declare one to keep a timer in caller storage with
+ * osal_start_timerRec(); the fields are private to OSAL_Timers.c.
+ */
+typedef struct
+{
+  void *next;
+  void **pprev;              // Link that points to this timer
+  void *hashNext;            // Next timer in the lookup bucket
+  UINT16 timeout;            // Wheel time of expiry (OSAL_TIMER_WHEEL), else delta to the previous timer
+  UINT16 laps;               // Laps of a long timer left after 'timeout'
+  UINT16 reloadTimeout;      // Period of a reload timer, else 0
+#if defined( POWER_SAVING )
+  UINT16 slack;              // How late it may expire to share a wakeup
+#endif
+  UINT16 event_flag;
+  byte task_id;
+  byte flags;
+} osalTimerRec_t;
+
+/*********************************************************************
+ * GLOBAL VARIABLES
+ */
+
+/*********************************************************************
+ * FUNCTIONS
+ */
+
+  /*
+   * Initialization for the OSAL Timer System.
+   */
+  extern void osalTimerInit( void );
+
+  /*
+   * Set a Timer
+   */
+  extern byte osal_start_timer( UINT16 event_id, UINT16 timeout_value );
+  extern byte osal_start_timerEx( byte task_id, UINT16 event_id, UINT16 timeout_value );
+
+  /*
+   * Set a Timer that restarts itself every timeout_value
+   */
+  extern byte osal_start_reload_timerEx( byte task_id, UINT16 event_id, UINT16 timeout_value );
+
+  /*
+   * Set a Timer that expires when the system clock reaches deadline
+   */
+  extern byte osal_start_timer_at( byte task_id, UINT16 event_id, uint32 deadline );
+
+  /*
+   * Stop a Timer
+   */
+  extern byte osal_stop_timer( UINT16 event_id );
+  extern byte osal_stop_timerEx( byte task_id, UINT16 event_id );
+
+  /*
+   * Set and Stop a Timer kept in caller storage
+   */
+  extern byte osal_start_timerRec( osalTimerRec_t *timer, byte task_id, UINT16 event_id, UINT16 timeout_value );
+  extern byte osal_start_reload_timerRec( osalTimerRec_t *timer, byte task_id, UINT16 event_id, UINT16 timeout_value );
+  extern byte osal_stop_timerRec( osalTimerRec_t *timer );
+
+  /*
+   * Let a running Timer expire late to share a wakeup
+   */
+  extern byte osal_timer_slack( byte task_id, UINT16 event_id, UINT16 slack );
+
+  /*
+   * Get the tick count of a Timer.
+   */
+  extern UINT16 osal_get_timeoutEx( byte task_id, UINT16 event_id );
+
+  /*
+   * Simulated Timer Interrupt Service Routine
+   */
+
+  extern void osal_timer_ISR( void );
+
+  /*
+   * Adjust timer tables
+   */
+  extern void osal_adjust_timers( void );
+
+  /*
+   * Update timer tables
+   */
+  extern void osal_update_timers( void );
+
+  /*
+   * Count active timers
+   */
+  extern uint16 osal_timer_num_active( void );
+
+  /*
+   * Set the hardware timer interrupts for sleep mode.
+   * These functions should only be called in OSAL_PwrMgr.c
+   */
+  extern void osal_sleep_timers( void );
+  extern void osal_unsleep_timers( void );
+
+ /*
+  * Read the system clock - returns milliseconds
+  */
+  extern uint32 osal_GetSystemClock( void );
+
+  /*
+   * Get the next OSAL timer expiration.
+   * This function should only be called in OSAL_PwrMgr.c
+   */
+  extern uint16 osal_next_timeout( void );
+
+  /*
+   * Count the timer expiries that shared a wakeup with an earlier one
+   */
+  extern uint16 osal_timer_wakeups_avoided( void );
+
+/*********************************************************************
+*********************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OSAL_TIMERS_H */
@@ -1,63 +1,144 @@
-/**************************************************************************************************
-    Filename:       msa_Osal.c
-    Revised:        $Date: 2006-03-10 15:05:25 -0800 (Fri, 10 Mar 2006) $
-    Revision:       $Revision: 10030 $
-
-    Description: This file contains function that allows user setup tasks
-
-    Notes:
-
-    Copyright (c) 2004 by Figure 8 Wireless, Inc., All Rights Reserved.
-    Permission to use, reproduce, copy, prepare derivative works,
-    modify, distribute, perform, display or sell this software and/or
-    its documentation for any purpose is prohibited without the express
-    written consent of Figure 8 Wireless, Inc.
-**************************************************************************************************/
-
-
-/**************************************************************************************************
- *                                            INCLUDES
- **************************************************************************************************/
-#include "hal_types.h"
-#include "OSAL.h"
-#include "OSAL_Tasks.h"
-#include "OSAL_Custom.h"
-#include "OnBoard.h"
-#include "mac_api.h"
-
-/* HAL */
-#include "hal_drivers.h"
-
-/* Application */
-#include "msa.h"
-
-
-
-/**************************************************************************************************
- *
- * @fn      osalAddTasks
- *
- * @brief   This function adds all the tasks to the task list.
- *          This is where to add new tasks.
- *
- * @param   void
- *
- * @return  none
- *
- **************************************************************************************************/
-void osalAddTasks( void )
-{
-
-  /* HAL Drivers Task */
-  osalTaskAdd (Hal_Init, Hal_ProcessEvent, OSAL_TASK_PRIORITY_LOW);
-
-  /* MAC Task */
-  osalTaskAdd( macTaskInit, macEventLoop, OSAL_TASK_PRIORITY_HIGH );
-
-  /* Application Task */
-  osalTaskAdd( MSA_Init, MSA_ProcessEvent, OSAL_TASK_PRIORITY_MED );
-
-}
-
-/**************************************************************************************************
-**************************************************************************************************/
+/**************************************************************************************************
+    Filename:       msa_Osal.c
+    Revised:        $Date: 2006-03-10 15:05:25 -0800 (Fri, 10 Mar 2006) $
+    Revision:       $Revision: 10030 $
+
+    Description: This file contains function that allows user setup tasks
+
+    Notes:
+
+    Copyright (c) 2004 by Figure 8 Wireless, Inc., All Rights Reserved.
+    Permission to use, reproduce, copy, prepare derivative works,
+    modify, distribute, perform, display or sell this software and/or
+    its documentation for any purpose is prohibited without the express
+    written consent of Figure 8 Wireless, Inc.
+**************************************************************************************************/
+
+
+/**************************************************************************************************
+ *                                            INCLUDES
+ **************************************************************************************************/
+#include "hal_types.h"
+#include "OSAL.h"
+#include "OSAL_Tasks.h"
+#include "OSAL_Custom.h"
+#include "OnBoard.h"
+#include "mac_api.h"
+#include "mac_high_level.h"
+
+/* HAL */
+#include "hal_drivers.h"
+
+/* Application */
+#include "msa.h"
+
+/**************************************************************************************************
+ *                                           Constant
+ **************************************************************************************************/
+
+/* MSA internal messages carry an event id and at most one parameter byte */
+#define MSA_MSG_POOL_CTRL_LEN     2
+
+/* Largest MAC callback event that MAC_CbackEvent() copies with a fixed length from
+ * msa_cbackSizeTable. Beacon notifications are variable length and use the heap. */
+#define MSA_MSG_POOL_MAC_LEN      sizeof(msaCbackFixed_t)
+
+/* MAC receive buffer for the largest frame the application exchanges */
+#define MSA_MSG_RESERVE_LEN       (sizeof(macRx_t) + MSA_PACKET_LENGTH)
+
+/* Tasks added by osalAddTasks(), all of which the OSAL task table must hold */
+#define MSA_OSAL_TASKS            3
+
+#if (OSAL_MAX_TASKS < MSA_OSAL_TASKS)
+#error "OSAL_MAX_TASKS is less than the number of tasks osalAddTasks() adds"
+#endif
+
+/**************************************************************************************************
+ *                                           Typedefs
+ **************************************************************************************************/
+
+/* The fixed-size entries of msa_cbackSizeTable */
+typedef union
+{
+  macEventHdr_t            hdr;
+  macMlmeAssociateInd_t    associateInd;
+  macMlmeAssociateCnf_t    associateCnf;
+  macMlmeDisassociateInd_t disassociateInd;
+  macMlmeDisassociateCnf_t disassociateCnf;
+  macMlmeOrphanInd_t       orphanInd;
+  macMlmeScanCnf_t         scanCnf;
+  macMlmeStartCnf_t        startCnf;
+  macMlmeSyncLossInd_t     syncLossInd;
+  macMlmePollCnf_t         pollCnf;
+  macMlmeCommStatusInd_t   commStatusInd;
+  macMcpsDataCnf_t         dataCnf;
+  macMcpsPurgeCnf_t        purgeCnf;
+} msaCbackFixed_t;
+
+/**************************************************************************************************
+ *                                        Local Variables
+ **************************************************************************************************/
+#if ( OSAL_MSG_POOLS )
+static uint8 msaMsgPoolCtrl[OSAL_MSG_POOL_BUF_SIZE(MSA_MSG_POOL_CTRL_LEN, MSA_MSG_POOL_CTRL_CNT)];
+static uint8 msaMsgPoolMac[OSAL_MSG_POOL_BUF_SIZE(MSA_MSG_POOL_MAC_LEN, MSA_MSG_POOL_MAC_CNT)];
+#endif
+
+
+
+/**************************************************************************************************
+ *
+ * @fn      osalAddTasks
+ *
+ * @brief   This function adds all the tasks to the task list.
+ *          This is where to add new tasks; OSAL_MAX_TASKS sizes the
+ *          task table that holds them.
+ *
+ * @param   void
+ *
+ * @return  none
+ *
+ **************************************************************************************************/
+void osalAddTasks( void )
+{
+
+  /* HAL Drivers Task */
+  osalTaskAdd (Hal_Init, Hal_ProcessEvent, OSAL_TASK_PRIORITY_LOW);
+
+  /* MAC Task */
+  osalTaskAdd( macTaskInit, macEventLoop, OSAL_TASK_PRIORITY_HIGH );
+
+  /* Application Task */
+  osalTaskAdd( MSA_Init, MSA_ProcessEvent, OSAL_TASK_PRIORITY_MED );
+
+}
+
+/**************************************************************************************************
+ *
+ * @fn      osalAddMsgPools
+ *
+ * @brief   This function adds the fixed-block message pools, smallest first,
+ *          and sizes the message reserve. This is where to size them.
+ *
+ * @param   void
+ *
+ * @return  none
+ *
+ **************************************************************************************************/
+void osalAddMsgPools( void )
+{
+#if ( OSAL_MSG_POOLS )
+  /* MSA internal messages */
+  osal_msg_pool_add( msaMsgPoolCtrl, MSA_MSG_POOL_CTRL_LEN, MSA_MSG_POOL_CTRL_CNT );
+
+  /* MAC callback events */
+  osal_msg_pool_add( msaMsgPoolMac, MSA_MSG_POOL_MAC_LEN, MSA_MSG_POOL_MAC_CNT );
+#endif
+
+#if ( OSAL_MSG_RESERVE )
+  /* MAC receive buffers for when the heap is full */
+  osal_msg_reserve_set( MSA_MSG_RESERVE_LEN, MSA_MSG_RESERVE_CNT );
+#endif
+}
+
+/**************************************************************************************************
+**************************************************************************************************/